@@ -0,0 +1,505 @@
+#include "pljit/Pljit.hpp"
+//---------------------------------------------------------------------------
+#include "pljit/backend/CCompiler.hpp"
+#include "pljit/management/Tracer.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <cassert>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler {
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    pair<optional<int64_t> , string> evaluate_lowered(const ir::Function& function , const backend::PatchedFunction* patchedFunction ,
+                                                      management::CodeManager& manager , const vector<int64_t>& parameterList)
+    /// execute machine code of lowered function if it is available , else interpret it
+    {
+        optional<int64_t> result ;
+        if(patchedFunction != nullptr) {
+            management::CodeReference reference ;
+            result = patchedFunction->evaluate(parameterList , reference) ;
+            if(!result.has_value())
+                return {nullopt , manager.runtimeErrorText(reference , "Divide by Zero")} ;
+            return {result , ""} ;
+        }
+        result = function.evaluate(parameterList) ;
+        if(!result.has_value())
+            // runtimeErrorMessage will be cleared immediately from output stream
+            return {nullopt , manager.runtimeErrorMessage()} ;
+        return {result , ""} ;
+    }
+    //---------------------------------------------------------------------------
+    string symbol_name(size_t index)
+    /// symbol of machine code of function in profilers and debuggers
+    {
+        return "pljit_function_" + to_string(index) ;
+    }
+    //---------------------------------------------------------------------------
+    template <typename Lock>
+    Lock acquire_lock(shared_mutex& mtx , size_t index , management::LockProfile::LockType type , management::LockProfile* profile)
+    /// lock mutex of function , blocked waits are traced and counted in profile (nullptr if lock profiling is disabled)
+    {
+        bool isTraced = management::Tracer::isEnabled() ;
+        if(!isTraced && profile == nullptr)
+            return Lock(mtx) ;
+        Lock lock(mtx , try_to_lock) ;
+        if(lock.owns_lock()) {
+            if(profile != nullptr)
+                profile->record(type , false , 0) ;
+            return lock ;
+        }
+        uint64_t begin = management::Tracer::now() ;
+        lock.lock() ;
+        uint64_t end = management::Tracer::now() ;
+        if(isTraced)
+            management::Tracer::record(type == management::LockProfile::EXCLUSIVE ? "exclusive lock wait" : "shared lock wait" , "lock" , index , begin , end) ;
+        if(profile != nullptr)
+            profile->record(type , true , end - begin) ;
+        return lock ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+size_t Pljit::MemoryUsage::total() const {
+    size_t total = 0 ;
+    for(size_t stageBytes : bytes)
+        total += stageBytes ;
+    return total ;
+}
+//---------------------------------------------------------------------------
+Pljit::FunctionHandle::FunctionHandle(Pljit* pljit , size_t index) : pljit(pljit) , index(index) {}
+//---------------------------------------------------------------------------
+std::pair<std::optional<int64_t> , std::string> Pljit::FunctionHandle::operator()(std::vector<int64_t> parameter_list) const {
+    return pljit->call(index , std::move(parameter_list)) ;
+}
+//---------------------------------------------------------------------------
+Pljit::FunctionHandle Pljit::addFunction(std::string_view code , std::unordered_map<size_t , int64_t> parameters , management::ArithmeticMode mode) {
+    // index for current registered function
+    size_t index = capacity;
+    ++capacity;
+
+    sourceCode.push_back(code) ;
+    boundParameters.push_back(parameters) ;
+    arithmeticMode.push_back(mode) ;
+    codeMutex.push_back(make_unique<shared_mutex>()) ;
+    lockProfile.push_back(make_unique<management::LockProfile>()) ;
+    compileTrigger.emplace_back(nullopt) ;
+
+    memoryAccounts.emplace_back(make_unique<array<management::MemoryAccount , MemoryUsage::NUM_STAGES>>()) ;
+    array<management::MemoryAccount , MemoryUsage::NUM_STAGES>& accounts = *memoryAccounts.back() ;
+    // each stage allocates its contents from the account of the stage
+    unique_ptr<management::CodeManager> codeManager = make_unique<management::CodeManager>(code , &accounts[MemoryUsage::SOURCE_LINES]) ;
+
+    lexicalAnalyzer.emplace_back(make_unique<syntax::TokenStream>(codeManager.get() , &accounts[MemoryUsage::TOKENS])) ;
+    syntaxAnalyzer.emplace_back(make_unique<syntax::FunctionDeclaration>(codeManager.get() , &accounts[MemoryUsage::PARSE_TREE]))  ;
+    semanticAnalyzer.emplace_back(make_unique<semantic::FunctionAST>(codeManager.get() , &accounts[MemoryUsage::AST])) ;
+    optimizer.emplace_back(make_unique<semantic::OptimizationVisitor>(semantic::OptimizationVisitor::ALL_PASSES , parameters , mode ,
+                                                                      &accounts[MemoryUsage::OPTIMIZER])) ;
+    closures.emplace_back(nullptr) ;
+    lowered.emplace_back(nullptr) ;
+    valueProfile.emplace_back(make_unique<management::ValueProfile>(profileCalls)) ;
+    patched.emplace_back(nullptr) ;
+    guarded.emplace_back(nullptr) ;
+    memoCache.emplace_back(nullptr) ;
+    callTelemetry.emplace_back(nullptr) ;
+    native.emplace_back(nullptr) ;
+    codeManagement.emplace_back(std::move(codeManager)) ;
+    return FunctionHandle(this , index) ;
+}
+//---------------------------------------------------------------------------
+std::optional<std::string> Pljit::compile(size_t index) {
+    // caller holds unique lock of function
+    if (!compileTrigger[index].has_value()) {
+        // uncomment to check if it is compiled for first time only
+//        std::cout << "compileCode\n" ;
+
+        management::CodeManager& manager = *codeManagement[index];
+        syntax::TokenStream& tokenStream = *lexicalAnalyzer[index] ;
+        management::CompileStatistics::Compilation compilation ;
+        compilation.function = index ;
+        management::CompileStatistics::PhaseTimer timer ;
+
+        bool isCompiled ;
+        {
+            management::Tracer::Span span("lexing" , "compile" , index) ;
+            isCompiled = tokenStream.compileCode() ;
+        }
+        compilation.phases[management::CompileStatistics::LEXING] = timer.finishPhase(tokenStream.size()) ;
+        if (!isCompiled) {
+            assert(!manager.error_message().empty()) ;
+            compileTrigger[index] = false;
+            compileStatistics->record(compilation) ;
+            return manager.error_message();
+        }
+        assert(manager.error_message().empty()) ;
+
+        syntax::FunctionDeclaration& parseTree = *syntaxAnalyzer[index] ;
+        {
+            management::Tracer::Span span("parsing" , "compile" , index) ;
+            isCompiled = parseTree.compileCode(tokenStream) ;
+        }
+        compilation.phases[management::CompileStatistics::PARSING] = timer.finishPhase(parseTree.num_nodes()) ;
+        if (!isCompiled) {
+            assert(!manager.error_message().empty()) ;
+            compileTrigger[index] = false;
+            compileStatistics->record(compilation) ;
+            return manager.error_message();
+        }
+        assert(manager.error_message().empty()) ;
+
+        semantic::FunctionAST& functionAst = *semanticAnalyzer[index] ;
+        {
+            management::Tracer::Span span("semantic analysis" , "compile" , index) ;
+            isCompiled = functionAst.compileCode(*syntaxAnalyzer[index]) ;
+        }
+        compilation.phases[management::CompileStatistics::SEMANTIC_ANALYSIS] = timer.finishPhase(isCompiled ? functionAst.num_nodes() : 0) ;
+        if (!isCompiled) {
+            assert(!manager.error_message().empty()) ;
+            compileTrigger[index] = false;
+            compileStatistics->record(compilation) ;
+            return manager.error_message();
+        }
+        assert(manager.error_message().empty()) ;
+
+        {
+            management::Tracer::Span span("optimization" , "compile" , index) ;
+            functionAst.acceptOptimization(*optimizer[index]);
+        }
+        compilation.phases[management::CompileStatistics::OPTIMIZATION] = timer.finishPhase(functionAst.num_nodes()) ;
+        // closures are several times cheaper to build than lowering and patching , functions which are called only once
+        // never get machine code
+        {
+            management::Tracer::Span span("closure compilation" , "compile" , index) ;
+            closures[index] = make_unique<semantic::ClosureFunction>(functionAst , arithmeticMode[index]) ;
+        }
+        compilation.phases[management::CompileStatistics::CLOSURE_COMPILATION] = timer.finishPhase(functionAst.num_nodes()) ;
+        compileStatistics->record(compilation) ;
+
+        compileTrigger[index] = true;
+    }
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+void Pljit::lower(size_t index) {
+    // caller holds unique lock of function
+    assert(compileTrigger[index].value() && lowered[index] == nullptr) ;
+    array<management::MemoryAccount , MemoryUsage::NUM_STAGES>& accounts = *memoryAccounts[index] ;
+    management::CompileStatistics::Compilation compilation ;
+    compilation.function = index ;
+    management::CompileStatistics::PhaseTimer timer ;
+    {
+        management::Tracer::Span span("lowering" , "compile" , index) ;
+        lowered[index] = make_unique<ir::Function>(*semanticAnalyzer[index] , arithmeticMode[index] , &accounts[MemoryUsage::COMPILED_CODE]) ;
+    }
+    compilation.phases[management::CompileStatistics::LOWERING] = timer.finishPhase(lowered[index]->getInstructions().size()) ;
+    // patching stencils is about as cheap as lowering , so every lowered function gets machine code .
+    // a function whose profile completed before it was lowered is hot already and never patched again
+    {
+        management::Tracer::Span span("code generation" , "compile" , index) ;
+        backend::CodeHeap::Temperature temperature = valueProfile[index]->isComplete() ? backend::CodeHeap::Temperature::HOT : backend::CodeHeap::Temperature::COLD ;
+        patched[index] = backend::PatchedFunction::compile(*lowered[index] , *codeHeap , temperature , symbol_name(index)) ;
+    }
+    compilation.phases[management::CompileStatistics::CODE_GENERATION] = timer.finishPhase(patched[index] != nullptr ? patched[index]->getCodeSize() : 0) ;
+    compileStatistics->record(compilation) ;
+    closures[index].reset() ;
+}
+//---------------------------------------------------------------------------
+std::unique_ptr<Pljit::GuardedFunction> Pljit::compileGuarded(size_t index , std::unordered_map<size_t , int64_t> parameters) const {
+    // parameters which are bound anyway do not need a guard
+    for(auto &[parameter , value] : boundParameters[index])
+        parameters.erase(parameter) ;
+    if(parameters.empty())
+        return nullptr ;
+
+    // guarded version is charged to compiled code , temporaries of its compilation are freed before it is returned
+    management::MemoryAccount* account = &(*memoryAccounts[index])[MemoryUsage::COMPILED_CODE] ;
+    unique_ptr<GuardedFunction> guardedFunction = make_unique<GuardedFunction>() ;
+    guardedFunction->guards.assign(parameters.begin() , parameters.end()) ;
+    for(auto &[parameter , value] : boundParameters[index])
+        parameters.emplace(parameter , value) ;
+
+    // source code is already compiled successfully by generic version
+    guardedFunction->codeManager = make_unique<management::CodeManager>(sourceCode[index] , account) ;
+    management::CompileStatistics::Compilation compilation ;
+    compilation.function = index ;
+    compilation.guarded = true ;
+    management::CompileStatistics::PhaseTimer timer ;
+    syntax::TokenStream tokenStream(guardedFunction->codeManager.get() , account) ;
+    bool isCompiled = tokenStream.compileCode() ;
+    compilation.phases[management::CompileStatistics::LEXING] = timer.finishPhase(tokenStream.size()) ;
+    syntax::FunctionDeclaration parseTree(guardedFunction->codeManager.get() , account) ;
+    isCompiled = isCompiled && parseTree.compileCode(tokenStream) ;
+    compilation.phases[management::CompileStatistics::PARSING] = timer.finishPhase(parseTree.num_nodes()) ;
+    semantic::FunctionAST functionAst(guardedFunction->codeManager.get() , account) ;
+    isCompiled = isCompiled && functionAst.compileCode(parseTree) ;
+    assert(isCompiled) ;
+    if(!isCompiled)
+        return nullptr ;
+    compilation.phases[management::CompileStatistics::SEMANTIC_ANALYSIS] = timer.finishPhase(functionAst.num_nodes()) ;
+    semantic::OptimizationVisitor optimizationVisitor(semantic::OptimizationVisitor::ALL_PASSES , parameters , arithmeticMode[index] , account) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    compilation.phases[management::CompileStatistics::OPTIMIZATION] = timer.finishPhase(functionAst.num_nodes()) ;
+    guardedFunction->function = make_unique<ir::Function>(functionAst , arithmeticMode[index] , account) ;
+    compilation.phases[management::CompileStatistics::LOWERING] = timer.finishPhase(guardedFunction->function->getInstructions().size()) ;
+    // function is hot since all profiled calls are done
+    guardedFunction->patched = backend::PatchedFunction::compile(*guardedFunction->function , *codeHeap , backend::CodeHeap::Temperature::HOT ,
+                                                                 symbol_name(index) + "_guarded") ;
+    compilation.phases[management::CompileStatistics::CODE_GENERATION] =
+        timer.finishPhase(guardedFunction->patched != nullptr ? guardedFunction->patched->getCodeSize() : 0) ;
+    compileStatistics->record(compilation) ;
+    return guardedFunction ;
+}
+//---------------------------------------------------------------------------
+std::unique_lock<std::shared_mutex> Pljit::lockExclusive(size_t index) {
+    management::LockProfile* profile = lockProfiling.load(memory_order_relaxed) ? lockProfile[index].get() : nullptr ;
+    return acquire_lock<unique_lock<shared_mutex>>(*codeMutex[index] , index , management::LockProfile::EXCLUSIVE , profile) ;
+}
+//---------------------------------------------------------------------------
+std::shared_lock<std::shared_mutex> Pljit::lockShared(size_t index) {
+    management::LockProfile* profile = lockProfiling.load(memory_order_relaxed) ? lockProfile[index].get() : nullptr ;
+    return acquire_lock<shared_lock<shared_mutex>>(*codeMutex[index] , index , management::LockProfile::SHARED , profile) ;
+}
+//---------------------------------------------------------------------------
+std::pair<std::optional<int64_t> , std::string> Pljit::evaluate(size_t index , const std::vector<int64_t>& parameter_list) {
+    if(const NativeFunction* nativeFunction = native[index].get()) {
+        // error message is a string literal of the native code
+        const char* error = nullptr ;
+        int64_t result = nativeFunction->entry(parameter_list.data() , &error) ;
+        if(error != nullptr)
+            return {nullopt , error} ;
+        return {result , ""} ;
+    }
+    const GuardedFunction* guardedFunction = guarded[index].get() ;
+    bool isGuarded = guardedFunction != nullptr ;
+    for(size_t guard = 0 ; isGuarded && guard < guardedFunction->guards.size() ; ++guard)
+    {
+        auto [parameter , value] = guardedFunction->guards[guard] ;
+        isGuarded = parameter < parameter_list.size() && parameter_list[parameter] == value ;
+    }
+    if(isGuarded)
+        return evaluate_lowered(*guardedFunction->function , guardedFunction->patched.get() , *guardedFunction->codeManager , parameter_list) ;
+    if(lowered[index] == nullptr) {
+        // first call is evaluated by closures
+        optional<int64_t> result = closures[index]->evaluate(parameter_list) ;
+        if(!result.has_value())
+            return {nullopt , codeManagement[index]->runtimeErrorMessage()} ;
+        return {result , ""} ;
+    }
+    return evaluate_lowered(*lowered[index] , patched[index].get() , *codeManagement[index] , parameter_list) ;
+}
+//---------------------------------------------------------------------------
+std::pair<std::optional<int64_t> , std::string> Pljit::evaluateCached(size_t index , const std::vector<int64_t>& parameter_list) {
+    management::MemoCache* cache = memoCache[index].get() ;
+    if(cache == nullptr)
+        return evaluate(index , parameter_list) ;
+    optional<management::MemoCache::Result> cached = cache->lookup(parameter_list) ;
+    if(cached.has_value())
+        return std::move(cached.value()) ;
+    std::pair<std::optional<int64_t> , std::string> result = evaluate(index , parameter_list) ;
+    cache->insert(parameter_list , result) ;
+    return result ;
+}
+//---------------------------------------------------------------------------
+std::pair<std::optional<int64_t> , std::string> Pljit::call(size_t index , std::vector<int64_t> parameter_list) {
+    // assume user will add correct number of parameters => will not trigger an error
+
+    bool isCompiled ;
+    bool isTierUp = false ;
+    // lowered function whose cold machine code is patched again into the hot arena (nullptr if there is none yet)
+    const ir::Function* hotSource = nullptr ;
+    {
+        unique_lock lock = lockExclusive(index) ;
+        bool isFirstCall = !compileTrigger[index].has_value() ;
+        optional<string> compileError = compile(index) ;
+        if(compileError.has_value())
+            return {nullopt , std::move(compileError.value())} ;
+        isCompiled = compileTrigger[index].value() ;
+        // function is lowered once it is called again
+        if(isCompiled && !isFirstCall && lowered[index] == nullptr)
+            lower(index) ;
+        isTierUp = isCompiled && valueProfile[index]->record(parameter_list) ;
+        // lowered function is never replaced , so it outlives the lock
+        if(isTierUp && patched[index] != nullptr)
+            hotSource = lowered[index].get() ;
+    }
+    if(isCompiled) {
+        if(isTierUp) {
+            unique_ptr<GuardedFunction> guardedFunction ;
+            unique_ptr<backend::PatchedFunction> hotFunction ;
+            {
+                management::Tracer::Span span("tier-up" , "tier-up" , index) ;
+                // last profiled call compiles guarded version without blocking other calls
+                guardedFunction = compileGuarded(index , valueProfile[index]->stableParameters()) ;
+                // hot functions are patched again next to each other , code of the cold copy is reused by later functions
+                if(hotSource != nullptr)
+                    hotFunction = backend::PatchedFunction::compile(*hotSource , *codeHeap , backend::CodeHeap::Temperature::HOT , symbol_name(index)) ;
+            }
+            unique_lock lock = lockExclusive(index) ;
+            guarded[index] = std::move(guardedFunction) ;
+            if(hotFunction != nullptr)
+                patched[index] = std::move(hotFunction) ;
+        }
+        shared_lock lock = lockShared(index) ;
+        management::Tracer::Span span("evaluate" , "evaluate" , index) ;
+        management::CallTelemetry* telemetry = callTelemetry[index].get() ;
+        if(telemetry == nullptr)
+            return evaluateCached(index , parameter_list) ;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now() ;
+        std::pair<std::optional<int64_t> , std::string> result = evaluateCached(index , parameter_list) ;
+        telemetry->record(start , !result.first.has_value()) ;
+        return result ;
+    }
+    else {
+        string errorMessage  ;
+        {
+            shared_lock lock = lockShared(index) ;
+            errorMessage = codeManagement[index]->error_message();
+        }
+        assert(!errorMessage.empty()) ;
+        return {nullopt , errorMessage} ;
+    }
+}
+//---------------------------------------------------------------------------
+Pljit::Pljit() : codeHeap(make_unique<backend::CodeHeap>()) , compileStatistics(make_unique<management::CompileStatistics>()) {}
+//---------------------------------------------------------------------------
+Pljit::Pljit(uint64_t profileCalls , bool hugePages)
+    : profileCalls(profileCalls) , codeHeap(make_unique<backend::CodeHeap>(hugePages)) , compileStatistics(make_unique<management::CompileStatistics>()) {}
+//---------------------------------------------------------------------------
+Pljit::FunctionHandle Pljit::registerFunction(std::string_view code , management::ArithmeticMode mode) {
+    return addFunction(code , {} , mode) ;
+}
+//---------------------------------------------------------------------------
+Pljit::FunctionHandle Pljit::specialize(const FunctionHandle& handle , std::unordered_map<size_t , int64_t> parameters) {
+    assert(handle.pljit == this) ;
+    // new bindings override bindings of specialized function
+    for(auto &[index , value] : boundParameters[handle.index])
+        parameters.try_emplace(index , value) ;
+    // specialized function is compiled from the same source code , so it is compiled lazily as well
+    return addFunction(sourceCode[handle.index] , std::move(parameters) , arithmeticMode[handle.index]) ;
+}
+//---------------------------------------------------------------------------
+void Pljit::enableMemoization(const FunctionHandle& handle , size_t capacity) {
+    assert(handle.pljit == this) ;
+    unique_lock lock(*codeMutex[handle.index]) ;
+    memoCache[handle.index] = capacity == 0 ? nullptr : make_unique<management::MemoCache>(capacity) ;
+}
+//---------------------------------------------------------------------------
+void Pljit::enableTelemetry(const FunctionHandle& handle) {
+    assert(handle.pljit == this) ;
+    unique_lock lock(*codeMutex[handle.index]) ;
+    if(callTelemetry[handle.index] == nullptr)
+        callTelemetry[handle.index] = make_unique<management::CallTelemetry>() ;
+}
+//---------------------------------------------------------------------------
+std::optional<management::CallTelemetry::Snapshot> Pljit::getTelemetry(const FunctionHandle& handle) {
+    assert(handle.pljit == this) ;
+    shared_lock lock(*codeMutex[handle.index]) ;
+    if(callTelemetry[handle.index] == nullptr)
+        return nullopt ;
+    return callTelemetry[handle.index]->snapshot() ;
+}
+//---------------------------------------------------------------------------
+std::string Pljit::dumpTelemetry() {
+    vector<pair<string , management::CallTelemetry::Snapshot>> functions ;
+    for(size_t index = 0 ; index < capacity ; ++index) {
+        shared_lock lock(*codeMutex[index]) ;
+        if(callTelemetry[index] != nullptr)
+            functions.emplace_back(symbol_name(index) , callTelemetry[index]->snapshot()) ;
+    }
+    return management::CallTelemetry::format(functions) ;
+}
+//---------------------------------------------------------------------------
+std::optional<std::string> Pljit::compileNative(const FunctionHandle& handle) {
+    assert(handle.pljit == this) ;
+    size_t index = handle.index ;
+    {
+        unique_lock lock = lockExclusive(index) ;
+        optional<string> compileError = compile(index) ;
+        if(compileError.has_value())
+            return compileError ;
+        if(!compileTrigger[index].value())
+            return codeManagement[index]->error_message() ;
+        if(lowered[index] == nullptr)
+            lower(index) ;
+    }
+    // lowered function is not changed after compilation , so C compiler runs without blocking calls
+    management::Tracer::Span span("compile native" , "tier-up" , index) ;
+    constexpr string_view symbol = "pljit_function" ;
+    backend::CEmitter emitter ;
+    emitter.emitFunction(*lowered[index] , symbol) ;
+    string directory = backend::CCompiler::createTemporaryDirectory() ;
+    if(directory.empty())
+        return string("cannot create temporary directory") ;
+    string path = directory + "/function.so" ;
+    unique_ptr<NativeFunction> nativeFunction = make_unique<NativeFunction>() ;
+    optional<string> error = backend::CCompiler::compile(emitter.getSource() , path , backend::CCompiler::Output::SHARED_OBJECT) ;
+    if(!error.has_value()) {
+        string loadError ;
+        nativeFunction->library = backend::SharedObject::load(path , loadError) ;
+        if(nativeFunction->library == nullptr)
+            error = loadError ;
+        else
+            nativeFunction->entry = reinterpret_cast<backend::CEmitter::Entry>(nativeFunction->library->getSymbol(string(symbol))) ;
+    }
+    // loaded object stays mapped after its file is removed
+    backend::CCompiler::removeTemporaryDirectory(directory) ;
+    if(error.has_value())
+        return error ;
+    assert(nativeFunction->entry != nullptr) ;
+
+    unique_lock lock = lockExclusive(index) ;
+    native[index] = std::move(nativeFunction) ;
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+const management::CompileStatistics& Pljit::getCompileStatistics() const {
+    return *compileStatistics ;
+}
+//---------------------------------------------------------------------------
+Pljit::MemoryUsage Pljit::getMemoryUsage(const FunctionHandle& handle) {
+    assert(handle.pljit == this) ;
+    size_t index = handle.index ;
+    shared_lock lock(*codeMutex[index]) ;
+    MemoryUsage usage ;
+    for(size_t stage = 0 ; stage < MemoryUsage::NUM_STAGES ; ++stage)
+        usage.bytes[stage] = (*memoryAccounts[index])[stage].getBytes() ;
+    // executable memory is mapped by the code heap , not allocated from an account
+    if(patched[index] != nullptr)
+        usage.bytes[MemoryUsage::COMPILED_CODE] += patched[index]->getBlockSize() ;
+    if(guarded[index] != nullptr && guarded[index]->patched != nullptr)
+        usage.bytes[MemoryUsage::COMPILED_CODE] += guarded[index]->patched->getBlockSize() ;
+    return usage ;
+}
+//---------------------------------------------------------------------------
+void Pljit::enableLockProfiling(bool enabled) {
+    lockProfiling.store(enabled , memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+std::vector<Pljit::LockContention> Pljit::getLockContention(size_t limit) const {
+    vector<LockContention> contention ;
+    for(size_t index = 0 ; index < capacity ; ++index)
+        for(uint8_t type = 0 ; type < management::LockProfile::NUM_LOCK_TYPES ; ++type) {
+            LockContention entry {index , static_cast<management::LockProfile::LockType>(type) ,
+                                  lockProfile[index]->getCounters(static_cast<management::LockProfile::LockType>(type))} ;
+            if(entry.counters.acquisitions != 0)
+                contention.push_back(entry) ;
+        }
+    sort(contention.begin() , contention.end() , [](const LockContention& left , const LockContention& right) {
+        if(left.counters.waitNanoseconds != right.counters.waitNanoseconds)
+            return left.counters.waitNanoseconds > right.counters.waitNanoseconds ;
+        return left.counters.contended > right.counters.contended ;
+    }) ;
+    if(contention.size() > limit)
+        contention.resize(limit) ;
+    return contention ;
+}
+//---------------------------------------------------------------------------
+backend::CodeHeap::Statistics Pljit::getCodeHeapStatistics() const {
+    return codeHeap->getStatistics() ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler
+//---------------------------------------------------------------------------
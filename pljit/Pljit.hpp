@@ -1,27 +1,122 @@
 #ifndef PLJIT_PLJIT_HPP
 #define PLJIT_PLJIT_HPP
 //---------------------------------------------------------------------------
+#include "pljit/backend/CEmitter.hpp"
+#include "pljit/backend/CodeHeap.hpp"
+#include "pljit/backend/PatchedFunction.hpp"
+#include "pljit/backend/SharedObject.hpp"
+#include "pljit/ir/IR.hpp"
+#include "pljit/management/CallTelemetry.hpp"
+#include "pljit/management/CompileStatistics.hpp"
+#include "pljit/management/LockProfile.hpp"
+#include "pljit/management/MemoCache.hpp"
+#include "pljit/management/MemoryAccount.hpp"
+#include "pljit/management/ValueProfile.hpp"
 #include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/ClosureFunction.hpp"
 #include "pljit/semantic/OptimizationASTVisitor.hpp"
 //---------------------------------------------------------------------------
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 //---------------------------------------------------------------------------
 namespace jitcompiler {
 //---------------------------------------------------------------------------
 
 class Pljit {
+    public:
+    /// handle of registered function , code is compiled to closures when it is called for the first time and lowered to
+    /// machine code when it is called again
+    class FunctionHandle {
+        Pljit* pljit ;
+        // index of function within pljit
+        size_t index ;
+
+        friend class Pljit ;
+        FunctionHandle(Pljit* pljit , size_t index) ;
+
+        public:
+        /// call function with different parameters each time
+        /// return pair (value , error_message)
+        std::pair<std::optional<int64_t> /*value*/ , std::string /*error message*/> operator()(std::vector<int64_t> parameter_list) const ;
+    };
+
+    /// resident bytes of a function by pipeline stage
+    struct MemoryUsage {
+        enum Stage : uint8_t {
+            SOURCE_LINES ,    // code manager with line table of source code and its error streams
+            TOKENS ,          // token stream
+            PARSE_TREE ,      // parse tree
+            AST ,             // AST including symbol tables
+            OPTIMIZER ,       // optimizer and AST nodes created by it
+            COMPILED_CODE ,   // IR , machine code (including executable memory) , guarded and native versions
+            NUM_STAGES
+        };
+        std::array<size_t , NUM_STAGES> bytes {} ;
+
+        /// sum of bytes of all stages
+        size_t total() const ;
+    };
+
+    /// contention of one lock type of the mutex of a function
+    struct LockContention {
+        size_t function = 0 ;
+        management::LockProfile::LockType type = management::LockProfile::EXCLUSIVE ;
+        management::LockProfile::Counters counters ;
+    };
+
+    private:
+    /// version of a function whose stable parameters are folded , valid if guards hold
+    struct GuardedFunction {
+        // (parameter index , expected value)
+        std::vector<std::pair<size_t , int64_t>> guards ;
+        // own code manager , used to print runtime errors of specialized function
+        std::unique_ptr<management::CodeManager> codeManager ;
+        std::unique_ptr<ir::Function> function ;
+        // machine code of function (nullptr if copy-and-patch does not support it)
+        std::unique_ptr<backend::PatchedFunction> patched ;
+    };
+
+    /// version of a function compiled to machine code by the system C compiler
+    struct NativeFunction {
+        // loaded shared object , code is unloaded with it
+        std::unique_ptr<backend::SharedObject> library ;
+        backend::CEmitter::Entry entry = nullptr ;
+    };
+
     // number of registered functions
     size_t capacity = 0;
-
+    // number of calls which are profiled for each function before guarded version is compiled
+    uint64_t profileCalls = management::ValueProfile::DEFAULT_PROFILE_CALLS ;
+    // executable memory of patched code of all functions , declared first so it outlives the code
+    std::unique_ptr<backend::CodeHeap> codeHeap ;
+    // measurements of compile phases of all functions
+    std::unique_ptr<management::CompileStatistics> compileStatistics ;
+    // count acquisitions of mutexes of functions in lockProfile
+    std::atomic<bool> lockProfiling = false ;
+
+    // source code of each function
+    std::vector<std::string_view> sourceCode ;
+    // heap memory of each stage of each function
+    std::vector<std::unique_ptr<std::array<management::MemoryAccount , MemoryUsage::NUM_STAGES>>> memoryAccounts ;
+    // parameters bound to constant values for each function (empty if function is not specialized)
+    std::vector<std::unordered_map<size_t , int64_t>> boundParameters ;
+    // semantics of overflowing operators for each function
+    std::vector<management::ArithmeticMode> arithmeticMode ;
     // for each function check if code not compiled (nullopt) , compilation success(true) , compilation failure (false)
     std::vector<std::optional<bool>> compileTrigger ;
     // mutex for each function
     std::vector<std::unique_ptr<std::shared_mutex>> codeMutex ;
+    // acquisitions of mutex of each function while lock profiling is enabled
+    std::vector<std::unique_ptr<management::LockProfile>> lockProfile ;
     // code manager for source code of each function
     std::vector<std::unique_ptr<management::CodeManager>> codeManagement ;
     // token stream for each function
@@ -32,98 +127,101 @@ class Pljit {
     std::vector<std::unique_ptr<semantic::FunctionAST>> semanticAnalyzer ;
     // AST Optimizer for each function
     std::vector<std::unique_ptr<semantic::OptimizationVisitor>> optimizer ;
+    // closures of optimized AST for each function , evaluate its first call and are freed once it is lowered
+    std::vector<std::unique_ptr<semantic::ClosureFunction>> closures ;
+    // SSA form of optimized AST for each function , used for evaluation from its second call on
+    std::vector<std::unique_ptr<ir::Function>> lowered ;
+    // machine code of lowered function built by copy-and-patch (nullptr if it is not supported) ,
+    // it is moved to the hot arena of the code heap once profiling of the function is complete
+    std::vector<std::unique_ptr<backend::PatchedFunction>> patched ;
+    // argument values observed for each function
+    std::vector<std::unique_ptr<management::ValueProfile>> valueProfile ;
+    // guarded version of each function (nullptr if no parameter is stable)
+    std::vector<std::unique_ptr<GuardedFunction>> guarded ;
+    // cached results of each function (nullptr if memoization is disabled)
+    std::vector<std::unique_ptr<management::MemoCache>> memoCache ;
+    // calls , errors and latencies of each function (nullptr if telemetry is disabled)
+    std::vector<std::unique_ptr<management::CallTelemetry>> callTelemetry ;
+    // native code of each function (nullptr if it is not compiled by the C compiler)
+    std::vector<std::unique_ptr<NativeFunction>> native ;
+
+    /// lock mutex of function for compilation or installation of code , blocked waits are traced and profiled
+    std::unique_lock<std::shared_mutex> lockExclusive(size_t index) ;
+    /// lock mutex of function for evaluation , blocked waits are traced and profiled
+    std::shared_lock<std::shared_mutex> lockShared(size_t index) ;
+    /// initialize all resources of a function (without any compilation of code)
+    FunctionHandle addFunction(std::string_view code , std::unordered_map<size_t , int64_t> parameters , management::ArithmeticMode mode) ;
+    /// compile function to closures if it is not compiled yet , return compile error message on failure
+    std::optional<std::string> compile(size_t index) ;
+    /// lower compiled function to SSA form and patch its machine code (placed in the cold arena of the code heap)
+    void lower(size_t index) ;
+    /// compile version of a compiled function whose stable parameters are folded (placed in the hot arena of the code heap)
+    std::unique_ptr<GuardedFunction> compileGuarded(size_t index , std::unordered_map<size_t , int64_t> parameters) const ;
+    /// evaluate compiled function (native code if available , else guarded version if its guards hold) ,
+    /// caller holds shared lock of function
+    std::pair<std::optional<int64_t> , std::string> evaluate(size_t index , const std::vector<int64_t>& parameter_list) ;
+    /// evaluate compiled function or look up its result in the memoization cache , caller holds shared lock of function
+    std::pair<std::optional<int64_t> , std::string> evaluateCached(size_t index , const std::vector<int64_t>& parameter_list) ;
+    /// compile and evaluate function
+    std::pair<std::optional<int64_t> , std::string> call(size_t index , std::vector<int64_t> parameter_list) ;
 
     public:
-    auto registerFunction(std::string_view code) {
-
-        // index for current registered function
-        size_t index = capacity;
-        ++capacity;
-
-        // initialize all resources of registered function (without any compilation of code)
-
-        codeMutex.push_back(std::make_unique<std::shared_mutex>()) ;
-        compileTrigger.emplace_back(std::nullopt) ;
-
-        std::unique_ptr<management::CodeManager> codeManager = make_unique<management::CodeManager>(code) ;
-
-        lexicalAnalyzer.emplace_back(std::make_unique<syntax::TokenStream>(codeManager.get())) ;
-        syntaxAnalyzer.emplace_back(std::make_unique<syntax::FunctionDeclaration>(codeManager.get()))  ;
-        semanticAnalyzer.emplace_back(std::make_unique<semantic::FunctionAST>(codeManager.get())) ;
-        optimizer.emplace_back(std::make_unique<semantic::OptimizationVisitor>()) ;
-        codeManagement.emplace_back(std::move(codeManager)) ;
-
-        //lambda function for compiling code and calling registered function each time with different parameters
-        /// return pair (value , error_message)
-        /// capture all declaration by reference except index by value
-
-        return [& , index](std::vector<int64_t> parameter_list) -> std::pair<std::optional<int64_t> /*value*/ , std::string /*error message*/> {
-            // assume user will add correct number of parameters => will not trigger an error
-
-            std::shared_mutex& mtx = *codeMutex[index] ; // synchronized shared resources
-            bool isCompiled ;
-            {
-                std::unique_lock lock(mtx);
-                if (!compileTrigger[index].has_value()) {
-                    // uncomment to check if it is compiled for first time only
-//                    std::cout << "compileCode\n" ;
-
-                    management::CodeManager& manager = *codeManagement[index];
-                    syntax::TokenStream& tokenStream = *lexicalAnalyzer[index] ;
-
-                    if (!tokenStream.compileCode()) {
-                        assert(!manager.error_message().empty()) ;
-                        compileTrigger[index] = false;
-                        return {std::nullopt , manager.error_message()};
-                    }
-                    assert(manager.error_message().empty()) ;
-
-                    syntax::FunctionDeclaration& parseTree = *syntaxAnalyzer[index] ;
-                    if (!parseTree.compileCode(tokenStream)) {
-                        assert(!manager.error_message().empty()) ;
-                        compileTrigger[index] = false;
-                        return {std::nullopt , manager.error_message()};
-                    }
-                    assert(manager.error_message().empty()) ;
-
-                    semantic::FunctionAST& functionAst = *semanticAnalyzer[index] ;
-                    if (!functionAst.compileCode(*syntaxAnalyzer[index])) {
-                        assert(!manager.error_message().empty()) ;
-                        compileTrigger[index] = false;
-                        return {std::nullopt , manager.error_message()};
-                    }
-                    assert(manager.error_message().empty()) ;
-
-                    functionAst.acceptOptimization(*optimizer[index]);
-
-                    compileTrigger[index] = true;
-                }
-                isCompiled = compileTrigger[index].value() ;
-            }
-            if(isCompiled) {
-                std::optional<int64_t> result ;
-                {
-                    std::shared_lock lock(mtx);
-                    semantic::EvaluationContext evaluationContext(std::move(parameter_list), semanticAnalyzer[index]->getSymbolTable());
-                    result = semanticAnalyzer[index]->evaluate(evaluationContext);
-                    if (!result.has_value()) {
-                        // runtimeErrorMessage will be cleared immediately from output stream
-                        return {std::nullopt, codeManagement[index]->runtimeErrorMessage()};
-                    }
-                }
-                return {result , ""};
-            }
-            else {
-                std::string errorMessage  ;
-                {
-                    std::shared_lock lock(mtx);
-                    errorMessage = codeManagement[index]->error_message();
-                }
-                assert(!errorMessage.empty()) ;
-                return {std::nullopt , errorMessage} ;
-            }
-        } ;
-    }
+    Pljit() ;
+    /// profile given number of calls of each function (0 disables guarded specialization) ,
+    /// machine code of functions is placed in huge pages if requested and provided by the system
+    explicit Pljit(uint64_t profileCalls , bool hugePages = false) ;
+
+    /// register source code of function , code must outlive pljit .
+    /// in checked arithmetic , an overflowing operator (including INT64_MIN / -1) triggers a runtime error ,
+    /// otherwise results wrap around in two's complement . machine code of the i-th registered function is named
+    /// pljit_function_<i> (pljit_function_<i>_guarded for its guarded version) in profilers and debuggers , see backend::CodeRegistry
+    FunctionHandle registerFunction(std::string_view code , management::ArithmeticMode mode = management::ArithmeticMode::WRAPAROUND) ;
+
+    /// register a copy of function whose parameters given by index are replaced by constant values .
+    /// the copy is optimized with these constants , it expects the same parameter list (values of bound
+    /// parameters are ignored) and reports the same compile errors as the original function .
+    /// specializing a specialized function keeps its bound parameters unless they are bound again , the arithmetic mode is kept
+    FunctionHandle specialize(const FunctionHandle& handle , std::unordered_map<size_t , int64_t> parameters) ;
+
+    /// cache up to capacity results of function (including runtime errors) , functions have no side effects so
+    /// results depend on parameters only . capacity 0 disables memoization
+    void enableMemoization(const FunctionHandle& handle , size_t capacity) ;
+
+    /// record calls , runtime errors and latency of evaluation of function (compilation is not included) .
+    /// counters are kept when telemetry is enabled again
+    void enableTelemetry(const FunctionHandle& handle) ;
+
+    /// merged counters of function , nullopt if telemetry is disabled for it
+    std::optional<management::CallTelemetry::Snapshot> getTelemetry(const FunctionHandle& handle) ;
+
+    /// Prometheus text exposition of telemetry of all functions , labeled function="pljit_function_<i>"
+    std::string dumpTelemetry() ;
+
+    /// compile function with the system C compiler at -O2 and load it with dlopen , later calls execute the native code .
+    /// compilation is slow , so it is meant for the hottest functions . return compile error of the source code or
+    /// failure of the C compiler , the function is still evaluated without native code on failure
+    std::optional<std::string> compileNative(const FunctionHandle& handle) ;
+
+    /// wall time , allocations charged to the memory accounts of the function and output size of each compile phase of
+    /// each compilation (including guarded versions) , use CompileStatistics::summarize() for percentiles over all
+    /// functions
+    const management::CompileStatistics& getCompileStatistics() const ;
+
+    /// resident bytes of function by pipeline stage , each stage allocates its contents from its own memory account
+    /// (see management::MemoryAccount) . stages which did not run yet hold only their initial state
+    MemoryUsage getMemoryUsage(const FunctionHandle& handle) ;
+
+    /// start or stop counting acquisitions of the mutex of each function per lock type , and time spent blocked on it .
+    /// every call takes an exclusive lock (compilation check) and a shared lock (evaluation) . counters are kept when
+    /// profiling is stopped
+    void enableLockProfiling(bool enabled) ;
+
+    /// lock types of functions which were acquired while profiling , most time spent blocked first (worst offenders) ,
+    /// at most limit entries
+    std::vector<LockContention> getLockContention(size_t limit = 10) const ;
+
+    /// usage of executable memory by machine code of all functions
+    backend::CodeHeap::Statistics getCodeHeapStatistics() const ;
 };
 //---------------------------------------------------------------------------
 } // namespace jitcompiler
@@ -0,0 +1,589 @@
+#ifndef PLJIT_STATICPLJIT_HPP
+#define PLJIT_STATICPLJIT_HPP
+//---------------------------------------------------------------------------
+#include "pljit/ir/IR.hpp"
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/CodeManager.hpp"
+#include "pljit/syntax/Grammar.hpp"
+#include "pljit/syntax/TokenStream.hpp"
+//---------------------------------------------------------------------------
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+//---------------------------------------------------------------------------
+namespace jitcompiler {
+//---------------------------------------------------------------------------
+/// source code passed as template argument of compile<"...">()
+template<size_t N>
+struct StaticSource {
+    char code[N] {} ;
+
+    consteval StaticSource(const char (&source)[N]) {
+        for(size_t index = 0 ; index < N ; ++index)
+            code[index] = source[index] ;
+    }
+    /// source code without terminating null character
+    constexpr std::string_view view() const {
+        return {code , N - 1} ;
+    }
+};
+//---------------------------------------------------------------------------
+namespace static_compilation {
+//---------------------------------------------------------------------------
+/// zero-based position of a token (same convention as management::CodeReference)
+struct StaticReference {
+    size_t line = 0 ;
+    size_t begin = 0 ;
+    size_t end = 0 ;
+};
+//---------------------------------------------------------------------------
+/// fixed size copy of a compile error message , usable as template argument (longer messages are truncated)
+struct StaticMessage {
+    char text[64] {} ;
+
+    constexpr StaticMessage() = default ;
+    //---------------------------------------------------------------------------
+    constexpr void append(std::string_view part) {
+        size_t size = view().size() ;
+        for(size_t index = 0 ; index < part.size() && size + 1 < sizeof(text) ; ++index)
+            text[size++] = part[index] ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr std::string_view view() const {
+        size_t size = 0 ;
+        while(size < sizeof(text) && text[size] != '\0')
+            ++size ;
+        return {text , size} ;
+    }
+};
+//---------------------------------------------------------------------------
+/// first compile error of the source , kind is NONE if the source compiled
+struct StaticError {
+    enum class Kind : uint8_t { NONE , UNEXPECTED_TOKEN , EXPECTED_TOKEN , SEMANTIC } ;
+    Kind kind = Kind::NONE ;
+    // unexpected token , expected token or message of semantic error (entries of syntax::Grammar)
+    std::string_view token ;
+    StaticReference reference {} ;
+    // marker length of an expected token which is missing at end of file , 0 otherwise
+    size_t endOfFileLength = 0 ;
+    // message as printed by CodeManager behind the position of the error
+    StaticMessage message {} ;
+
+    constexpr bool failed() const {
+        return kind != Kind::NONE ;
+    }
+};
+//---------------------------------------------------------------------------
+/// linear SSA form (instructions of ir::Function) of fixed capacity , built during constant evaluation
+template<size_t Capacity>
+struct StaticProgram {
+    std::array<ir::Instruction , Capacity> instructions {} ;
+    // code reference of each instruction which may trap
+    std::array<StaticReference , Capacity> references {} ;
+    // number of instructions , last instruction is RETURN
+    size_t size = 0 ;
+    size_t numParameters = 0 ;
+    StaticError error {} ;
+};
+//---------------------------------------------------------------------------
+/// lexer , parser , semantic analysis and constant folding of ir::Function usable in constant evaluation .
+/// it accepts the same language and reports the errors of syntax::Grammar like the runtime pipeline , but produces
+/// a StaticProgram in a single pass instead of parse tree and AST (which need dynamic allocation)
+template<size_t Capacity>
+class StaticCompiler {
+    using TokenType = syntax::TokenStream::TokenType ;
+    using Opcode = ir::Instruction::Opcode ;
+
+    struct Token {
+        TokenType type = TokenType::KEYWORD ;
+        StaticReference reference {} ;
+        std::string_view text ;
+    };
+    enum class SymbolType : uint8_t { PARAMETER , VARIABLE , CONSTANT } ;
+    struct Symbol {
+        std::string_view name ;
+        SymbolType type = SymbolType::PARAMETER ;
+        // value of constant
+        int64_t constant = 0 ;
+        // current value of parameter or variable
+        uint32_t value = 0 ;
+        bool initialized = false ;
+    };
+
+    std::string_view source ;
+    std::array<Token , Capacity> tokens {} ;
+    size_t numTokens = 0 ;
+    size_t position = 0 ;
+    // position after last character of source (reference of errors at end of file)
+    StaticReference endOfFile {} ;
+    std::array<Symbol , Capacity> symbols {} ;
+    size_t numSymbols = 0 ;
+    // index of first RETURN instruction , instructions behind it are never evaluated
+    std::optional<size_t> returnIndex ;
+    // first semantic error , reported unless a syntax error is found later
+    StaticError semanticError {} ;
+    StaticProgram<Capacity> program {} ;
+
+    constexpr bool failUnexpected(std::string_view token , StaticReference reference) {
+        program.error = {StaticError::Kind::UNEXPECTED_TOKEN , token , reference} ;
+        return false ;
+    }
+    //---------------------------------------------------------------------------
+    /// expected token is reported at the current token or behind the end of file
+    constexpr bool failExpected(const syntax::ExpectedToken& expected) {
+        if(position < numTokens)
+            program.error = {StaticError::Kind::EXPECTED_TOKEN , expected.text , tokens[position].reference} ;
+        else
+            program.error = {StaticError::Kind::EXPECTED_TOKEN , expected.text , endOfFile , expected.length} ;
+        return false ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr void failSemantic(std::string_view message , StaticReference reference) {
+        if(!semanticError.failed())
+            semanticError = {StaticError::Kind::SEMANTIC , message , reference} ;
+    }
+    //---------------------------------------------------------------------------
+    /// message of error like CodeManager prints it , expected tokens at end of file are quoted
+    static constexpr StaticMessage describe(const StaticError& error) {
+        StaticMessage message ;
+        switch (error.kind) {
+            case StaticError::Kind::UNEXPECTED_TOKEN:
+                message.append("unexpected token \"") ;
+                message.append(error.token) ;
+                message.append("\"") ;
+                break ;
+            case StaticError::Kind::EXPECTED_TOKEN:
+                message.append("expected ") ;
+                if(error.endOfFileLength != 0)
+                    message.append("\"") ;
+                message.append(error.token) ;
+                if(error.endOfFileLength != 0)
+                    message.append("\"") ;
+                break ;
+            case StaticError::Kind::SEMANTIC: message.append(error.token) ; break ;
+            case StaticError::Kind::NONE: break ;
+        }
+        return message ;
+    }
+    //---------------------------------------------------------------------------
+    /// split source into tokens , false on unexpected token
+    constexpr bool tokenize() {
+        size_t line = 0 , lineBegin = 0 ;
+        for(size_t index = 0 ; index < source.size() ;) {
+            char c = source[index] ;
+            if(c == '\n') {
+                ++line ;
+                lineBegin = ++index ;
+                continue ;
+            }
+            if(syntax::Grammar::isWhiteSpace(c)) {
+                ++index ;
+                continue ;
+            }
+            size_t end = index + 1 ;
+            TokenType type = TokenType::KEYWORD ;
+            if(syntax::Grammar::isLetter(c) || syntax::Grammar::isDigit(c)) {
+                while(end < source.size() && (syntax::Grammar::isLetter(source[end]) || syntax::Grammar::isDigit(source[end])))
+                    ++end ;
+                bool letters = true , digits = true ;
+                for(size_t current = index ; current < end ; ++current) {
+                    letters &= syntax::Grammar::isLetter(source[current]) ;
+                    digits &= syntax::Grammar::isDigit(source[current]) ;
+                }
+                std::string_view text = source.substr(index , end - index) ;
+                if(syntax::Grammar::isKeyword(text))
+                    type = TokenType::KEYWORD ;
+                else if(letters)
+                    type = TokenType::IDENTIFIER ;
+                else if(digits)
+                    type = TokenType::LITERAL ;
+                else
+                    return failUnexpected(text , {line , index - lineBegin , end - lineBegin - 1}) ;
+            }
+            else if(c == ':' && end < source.size() && source[end] == '=') {
+                type = TokenType::VAR_ASSIGNMENT ;
+                ++end ;
+            }
+            else {
+                switch (c) {
+                    case ',': type = TokenType::COMMA_SEPARATOR ; break ;
+                    case '.': type = TokenType::TERMINATOR ; break ;
+                    case ';': type = TokenType::SEMI_COLON_SEPARATOR ; break ;
+                    case '=': type = TokenType::CONST_ASSIGNMENT ; break ;
+                    case '+': type = TokenType::PLUS_OPERATOR ; break ;
+                    case '-': type = TokenType::MINUS_OPERATOR ; break ;
+                    case '*': type = TokenType::MULTIPLY_OPERATOR ; break ;
+                    case '/': type = TokenType::DIVIDE_OPERATOR ; break ;
+                    case '(': type = TokenType::OPEN_BRACKET ; break ;
+                    case ')': type = TokenType::CLOSE_BRACKET ; break ;
+                    default: return failUnexpected(source.substr(index , 1) , {line , index - lineBegin , index - lineBegin}) ;
+                }
+            }
+            tokens[numTokens++] = {type , {line , index - lineBegin , end - lineBegin - 1} , source.substr(index , end - index)} ;
+            index = end ;
+        }
+        // errors at end of file point behind the last character of the last line (like CodeManager)
+        std::string_view code = source ;
+        if(!code.empty() && code.back() == '\n')
+            code.remove_suffix(1) ;
+        size_t lastLine = 0 , lastBegin = 0 ;
+        for(size_t index = 0 ; index < code.size() ; ++index)
+            if(code[index] == '\n')
+                ++lastLine , lastBegin = index + 1 ;
+        endOfFile = {lastLine , code.size() - lastBegin , code.size() - lastBegin} ;
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool check(TokenType type , std::string_view text = {}) const {
+        return position < numTokens && tokens[position].type == type && (text.empty() || tokens[position].text == text) ;
+    }
+    //---------------------------------------------------------------------------
+    /// consume token if it matches
+    constexpr bool accept(TokenType type , std::string_view text = {}) {
+        if(!check(type , text))
+            return false ;
+        ++position ;
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    /// consume expected token , report it as expected token otherwise
+    constexpr bool expect(TokenType type , const syntax::ExpectedToken& expected , std::string_view text = {}) {
+        if(!check(type , text))
+            return failExpected(expected) ;
+        ++position ;
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr std::optional<size_t> lookup(std::string_view name) const {
+        for(size_t index = 0 ; index < numSymbols ; ++index)
+            if(symbols[index].name == name)
+                return index ;
+        return std::nullopt ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr uint32_t emit(ir::Instruction instruction , StaticReference reference = {}) {
+        program.instructions[program.size] = instruction ;
+        program.references[program.size] = reference ;
+        return static_cast<uint32_t>(program.size++) ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr uint32_t emitConstant(int64_t value) {
+        return emit({.opcode = Opcode::CONSTANT , .constant = value}) ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr std::optional<int64_t> getConstant(uint32_t value) const {
+        if(program.instructions[value].opcode != Opcode::CONSTANT)
+            return std::nullopt ;
+        return program.instructions[value].constant ;
+    }
+    //---------------------------------------------------------------------------
+    /// emit binary operation , operations with constant operands are folded unless they trap
+    constexpr uint32_t emitBinary(Opcode opcode , uint32_t left , uint32_t right , StaticReference reference) {
+        std::optional<int64_t> leftConstant = getConstant(left) , rightConstant = getConstant(right) ;
+        if(opcode == Opcode::DIVIDE && rightConstant.has_value() && rightConstant.value() != 0)
+            opcode = Opcode::DIVIDE_NONZERO ;
+        if(leftConstant.has_value() && rightConstant.has_value() && opcode != Opcode::DIVIDE) {
+            int64_t a = leftConstant.value() , b = rightConstant.value() ;
+            switch (opcode) {
+                case Opcode::ADD: return emitConstant(management::wrapping_add(a , b)) ;
+                case Opcode::SUBTRACT: return emitConstant(management::wrapping_subtract(a , b)) ;
+                case Opcode::MULTIPLY: return emitConstant(management::wrapping_multiply(a , b)) ;
+                default: return emitConstant(management::wrapping_divide(a , b)) ;
+            }
+        }
+        return emit({.opcode = opcode , .left = left , .right = right} , reference) ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parseDeclarators(SymbolType type) {
+        do {
+            if(!check(TokenType::IDENTIFIER))
+                return failExpected(syntax::Grammar::IDENTIFIER) ;
+            const Token& identifier = tokens[position++] ;
+            Symbol symbol {identifier.text , type} ;
+            if(type == SymbolType::PARAMETER)
+                symbol.value = emit({.opcode = Opcode::PARAMETER , .constant = static_cast<int64_t>(program.numParameters++)}) ;
+            else if(type == SymbolType::CONSTANT) {
+                if(!expect(TokenType::CONST_ASSIGNMENT , syntax::Grammar::CONST_ASSIGNMENT))
+                    return false ;
+                if(!check(TokenType::LITERAL))
+                    return failExpected(syntax::Grammar::LITERAL) ;
+                for(char c : tokens[position++].text)
+                    symbol.constant = management::wrapping_add(management::wrapping_multiply(symbol.constant , 10) , c - '0') ;
+            }
+            if(lookup(identifier.text).has_value())
+                failSemantic(syntax::Grammar::ALREADY_DECLARED , identifier.reference) ;
+            else
+                symbols[numSymbols++] = symbol ;
+        } while(accept(TokenType::COMMA_SEPARATOR)) ;
+        return expect(TokenType::SEMI_COLON_SEPARATOR , syntax::Grammar::SEMI_COLON) ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parsePrimary(uint32_t& result) {
+        if(check(TokenType::IDENTIFIER)) {
+            const Token& identifier = tokens[position++] ;
+            std::optional<size_t> index = lookup(identifier.text) ;
+            if(!index.has_value()) {
+                failSemantic(syntax::Grammar::UNDECLARED_IDENTIFIER , identifier.reference) ;
+                result = emitConstant(0) ;
+            }
+            else if(symbols[index.value()].type == SymbolType::CONSTANT)
+                result = emitConstant(symbols[index.value()].constant) ;
+            else {
+                if(symbols[index.value()].type == SymbolType::VARIABLE && !symbols[index.value()].initialized)
+                    failSemantic(syntax::Grammar::UNINITIALIZED_IDENTIFIER , identifier.reference) ;
+                result = symbols[index.value()].value ;
+            }
+            return true ;
+        }
+        if(check(TokenType::LITERAL)) {
+            int64_t value = 0 ;
+            for(char c : tokens[position++].text)
+                value = management::wrapping_add(management::wrapping_multiply(value , 10) , c - '0') ;
+            result = emitConstant(value) ;
+            return true ;
+        }
+        if(!accept(TokenType::OPEN_BRACKET))
+            return failExpected(syntax::Grammar::PRIMARY_EXPRESSION) ;
+        return parseAdditive(result) && expect(TokenType::CLOSE_BRACKET , syntax::Grammar::CLOSE_BRACKET) ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parseUnary(uint32_t& result) {
+        if(!check(TokenType::PLUS_OPERATOR) && !check(TokenType::MINUS_OPERATOR))
+            return parsePrimary(result) ;
+        bool negate = tokens[position++].type == TokenType::MINUS_OPERATOR ;
+        if(!parsePrimary(result))
+            return false ;
+        if(negate) {
+            std::optional<int64_t> constant = getConstant(result) ;
+            result = constant.has_value() ? emitConstant(management::wrapping_negate(constant.value())) : emit({.opcode = Opcode::NEGATE , .left = result}) ;
+        }
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    /// binary operators are right associative like in the runtime parser
+    constexpr bool parseMultiplicative(uint32_t& result) {
+        if(!parseUnary(result))
+            return false ;
+        if(!check(TokenType::MULTIPLY_OPERATOR) && !check(TokenType::DIVIDE_OPERATOR))
+            return true ;
+        const Token& tokenOperator = tokens[position++] ;
+        uint32_t right = 0 ;
+        if(!parseMultiplicative(right))
+            return false ;
+        result = emitBinary(tokenOperator.type == TokenType::MULTIPLY_OPERATOR ? Opcode::MULTIPLY : Opcode::DIVIDE , result , right , tokenOperator.reference) ;
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parseAdditive(uint32_t& result) {
+        if(!parseMultiplicative(result))
+            return false ;
+        if(!check(TokenType::PLUS_OPERATOR) && !check(TokenType::MINUS_OPERATOR))
+            return true ;
+        const Token& tokenOperator = tokens[position++] ;
+        uint32_t right = 0 ;
+        if(!parseAdditive(right))
+            return false ;
+        result = emitBinary(tokenOperator.type == TokenType::PLUS_OPERATOR ? Opcode::ADD : Opcode::SUBTRACT , result , right , tokenOperator.reference) ;
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parseStatement() {
+        if(accept(TokenType::KEYWORD , "RETURN")) {
+            uint32_t value = 0 ;
+            if(!parseAdditive(value))
+                return false ;
+            uint32_t returnValue = emit({.opcode = Opcode::RETURN , .left = value}) ;
+            if(!returnIndex.has_value())
+                returnIndex = returnValue ;
+            return true ;
+        }
+        if(position == numTokens)
+            return failExpected(syntax::Grammar::STATEMENT_AT_END) ;
+        if(check(TokenType::KEYWORD))
+            return failExpected(syntax::Grammar::STATEMENT_AT_KEYWORD) ;
+        if(!check(TokenType::IDENTIFIER))
+            return failExpected(syntax::Grammar::STATEMENT) ;
+        const Token& identifier = tokens[position++] ;
+        if(!expect(TokenType::VAR_ASSIGNMENT , syntax::Grammar::VAR_ASSIGNMENT))
+            return false ;
+        std::optional<size_t> index = lookup(identifier.text) ;
+        if(!index.has_value())
+            failSemantic(syntax::Grammar::UNDECLARED_IDENTIFIER , identifier.reference) ;
+        else if(symbols[index.value()].type == SymbolType::CONSTANT)
+            failSemantic(syntax::Grammar::CONSTANT_ASSIGNMENT , identifier.reference) ;
+        uint32_t value = 0 ;
+        if(!parseAdditive(value))
+            return false ;
+        if(index.has_value() && symbols[index.value()].type != SymbolType::CONSTANT) {
+            symbols[index.value()].value = value ;
+            symbols[index.value()].initialized = true ;
+        }
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    constexpr bool parseFunction() {
+        if(accept(TokenType::KEYWORD , "PARAM") && !parseDeclarators(SymbolType::PARAMETER))
+            return false ;
+        if(accept(TokenType::KEYWORD , "VAR") && !parseDeclarators(SymbolType::VARIABLE))
+            return false ;
+        if(accept(TokenType::KEYWORD , "CONST") && !parseDeclarators(SymbolType::CONSTANT))
+            return false ;
+        if(!expect(TokenType::KEYWORD , syntax::Grammar::BEGIN , syntax::Grammar::BEGIN.text))
+            return false ;
+        do {
+            if(!parseStatement())
+                return false ;
+        } while(accept(TokenType::SEMI_COLON_SEPARATOR)) ;
+        StaticReference endReference = position < numTokens ? tokens[position].reference : endOfFile ;
+        if(!expect(TokenType::KEYWORD , syntax::Grammar::END , syntax::Grammar::END.text) || !expect(TokenType::TERMINATOR , syntax::Grammar::TERMINATOR))
+            return false ;
+        if(position < numTokens)
+            return failUnexpected(tokens[position].text , tokens[position].reference) ;
+        if(!returnIndex.has_value())
+            failSemantic(syntax::Grammar::MISSING_RETURN , endReference) ;
+        return true ;
+    }
+
+    public:
+    constexpr explicit StaticCompiler(std::string_view source) : source(source) {}
+    //---------------------------------------------------------------------------
+    /// compile source , program.error is set on the first syntax or semantic error
+    constexpr StaticProgram<Capacity> compile() {
+        if(tokenize() && parseFunction() && semanticError.failed())
+            program.error = semanticError ;
+        if(!program.error.failed())
+            program.size = returnIndex.value() + 1 ;
+        program.error.message = describe(program.error) ;
+        return program ;
+    }
+};
+//---------------------------------------------------------------------------
+/// compile source during constant evaluation
+template<StaticSource Source>
+consteval auto compile_program() {
+    // each token defines at most one instruction
+    return StaticCompiler<Source.view().size() + 2>(Source.view()).compile() ;
+}
+//---------------------------------------------------------------------------
+/// full compile error message of source as returned by Pljit (empty if the source compiled) , it is printed by
+/// CodeManager like the errors of the runtime pipeline
+inline std::string compile_error_text(std::string_view source , const StaticError& error) {
+    management::CodeManager manager(source) ;
+    management::CodeReference reference({error.reference.line , error.reference.begin} , {error.reference.line , error.reference.end}) ;
+    switch (error.kind) {
+        case StaticError::Kind::UNEXPECTED_TOKEN: manager.printTokenFailure(reference) ; break ;
+        case StaticError::Kind::EXPECTED_TOKEN: {
+            if(error.endOfFileLength != 0)
+                manager.printCompileError(error.endOfFileLength , error.token) ;
+            else
+                manager.printCompileError(reference , error.token) ;
+        }
+        break ;
+        case StaticError::Kind::SEMANTIC: manager.printSemanticError(reference , error.token) ; break ;
+        case StaticError::Kind::NONE: break ;
+    }
+    return manager.error_message() ;
+}
+//---------------------------------------------------------------------------
+/// instantiated with the first compile error of a StaticFunction (line 0 if the source compiled) , the failing
+/// assertion makes the compiler print message , line and column as template arguments
+template<StaticMessage Message , size_t Line , size_t Column>
+struct CompileError {
+    static_assert(Line == 0 , "PL source does not compile , see message , line and column in the template arguments") ;
+    static constexpr bool compiled = true ;
+};
+//---------------------------------------------------------------------------
+} // namespace static_compilation
+//---------------------------------------------------------------------------
+/// function compiled while compiling the C++ program , syntax and semantic errors fail the build .
+/// calling it evaluates straight line C++ arithmetic , one statement per instruction , without any
+/// compilation or interpretation at runtime
+template<StaticSource Source>
+class StaticFunction {
+    static constexpr auto program = static_compilation::compile_program<Source>() ;
+    static_assert(static_compilation::CompileError<program.error.message ,
+                                                   program.error.failed() ? program.error.reference.line + 1 : 0 ,
+                                                   program.error.reference.begin + 1>::compiled) ;
+
+    public:
+    static constexpr size_t numParameters = program.numParameters ;
+
+    private:
+    using Values = std::array<int64_t , program.size> ;
+    using Parameters = std::array<int64_t , numParameters> ;
+
+    /// evaluate I-th instruction , false if evaluation stops (RETURN or runtime error)
+    template<size_t I>
+    static constexpr bool execute(Values& values , const Parameters& parameters , std::optional<int64_t>& result) {
+        using Opcode = ir::Instruction::Opcode ;
+        constexpr ir::Instruction instruction = program.instructions[I] ;
+        if constexpr (instruction.opcode == Opcode::PARAMETER)
+            values[I] = parameters[instruction.constant] ;
+        else if constexpr (instruction.opcode == Opcode::CONSTANT)
+            values[I] = instruction.constant ;
+        else if constexpr (instruction.opcode == Opcode::NEGATE)
+            values[I] = management::wrapping_negate(values[instruction.left]) ;
+        else if constexpr (instruction.opcode == Opcode::ADD)
+            values[I] = management::wrapping_add(values[instruction.left] , values[instruction.right]) ;
+        else if constexpr (instruction.opcode == Opcode::SUBTRACT)
+            values[I] = management::wrapping_subtract(values[instruction.left] , values[instruction.right]) ;
+        else if constexpr (instruction.opcode == Opcode::MULTIPLY)
+            values[I] = management::wrapping_multiply(values[instruction.left] , values[instruction.right]) ;
+        else if constexpr (instruction.opcode == Opcode::DIVIDE) {
+            if(values[instruction.right] == 0)
+                return false ;
+            values[I] = management::wrapping_divide(values[instruction.left] , values[instruction.right]) ;
+        }
+        else if constexpr (instruction.opcode == Opcode::DIVIDE_NONZERO)
+            values[I] = management::wrapping_divide(values[instruction.left] , values[instruction.right]) ;
+        else {
+            static_assert(instruction.opcode == Opcode::RETURN) ;
+            result = values[instruction.left] ;
+            return false ;
+        }
+        return true ;
+    }
+    //---------------------------------------------------------------------------
+    /// index of the instruction which stopped the evaluation
+    template<size_t... I>
+    static constexpr std::pair<std::optional<int64_t> , size_t> evaluate(const Parameters& parameters , std::index_sequence<I...>) {
+        Values values {} ;
+        std::optional<int64_t> result ;
+        size_t stopped = 0 ;
+        static_cast<void>(((stopped = I , execute<I>(values , parameters , result)) && ...)) ;
+        return {result , stopped} ;
+    }
+    //---------------------------------------------------------------------------
+    /// runtime error message of division at instruction index (cold path)
+    static std::string divideByZero(size_t index) {
+        static_compilation::StaticReference reference = program.references[index] ;
+        management::CodeManager manager(Source.view()) ;
+        return manager.runtimeErrorText({{reference.line , reference.begin} , {reference.line , reference.end}} , "Divide by Zero") ;
+    }
+
+    public:
+    /// call function with exactly numParameters arguments
+    /// return pair (value , error_message) like Pljit::FunctionHandle
+    template<typename... Arguments>
+        requires(sizeof...(Arguments) == numParameters && (std::convertible_to<Arguments , int64_t> && ...))
+    constexpr std::pair<std::optional<int64_t> /*value*/ , std::string /*error message*/> operator()(Arguments... arguments) const {
+        auto [result , stopped] = evaluate(Parameters {static_cast<int64_t>(arguments)...} , std::make_index_sequence<program.size>()) ;
+        if(result.has_value())
+            return {result , {}} ;
+        return {std::nullopt , divideByZero(stopped)} ;
+    }
+};
+//---------------------------------------------------------------------------
+/// compile PL source while compiling the C++ program , e.g. compile<"PARAM a; BEGIN RETURN a * a END.">()(3)
+template<StaticSource Source>
+constexpr StaticFunction<Source> compile() {
+    return {} ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler
+//---------------------------------------------------------------------------
+#endif //PLJIT_STATICPLJIT_HPP
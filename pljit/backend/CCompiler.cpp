@@ -0,0 +1,92 @@
+#include "pljit/backend/CCompiler.hpp"
+//---------------------------------------------------------------------------
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <spawn.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+//---------------------------------------------------------------------------
+extern char** environ ;
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+std::string CCompiler::createTemporaryDirectory() {
+    const char* base = getenv("TMPDIR") ;
+    string pattern = string(base != nullptr && *base != '\0' ? base : "/tmp") + "/pljit-XXXXXX" ;
+    vector<char> buffer(pattern.begin() , pattern.end()) ;
+    buffer.push_back('\0') ;
+    if(mkdtemp(buffer.data()) == nullptr)
+        return "" ;
+    return buffer.data() ;
+}
+//---------------------------------------------------------------------------
+void CCompiler::removeTemporaryDirectory(const std::string& directory) {
+    if(DIR* entries = opendir(directory.c_str())) {
+        while(dirent* entry = readdir(entries)) {
+            if(strcmp(entry->d_name , ".") != 0 && strcmp(entry->d_name , "..") != 0)
+                unlink((directory + "/" + entry->d_name).c_str()) ;
+        }
+        closedir(entries) ;
+    }
+    rmdir(directory.c_str()) ;
+}
+//---------------------------------------------------------------------------
+std::optional<std::string> CCompiler::compile(std::string_view source , const std::string& outputPath , Output output) {
+    string directory = createTemporaryDirectory() ;
+    if(directory.empty())
+        return string("cannot create temporary directory: ") + strerror(errno) ;
+    string sourcePath = directory + "/function.c" ;
+    string diagnosticsPath = directory + "/diagnostics.txt" ;
+    {
+        ofstream sourceFile(sourcePath) ;
+        sourceFile << source ;
+        if(!sourceFile) {
+            removeTemporaryDirectory(directory) ;
+            return string("cannot write ") + sourcePath ;
+        }
+    }
+
+    vector<string> arguments = {"cc" , "-O2" , "-fPIC" , "-w"} ;
+    arguments.emplace_back(output == Output::SHARED_OBJECT ? "-shared" : "-c") ;
+    arguments.insert(arguments.end() , {"-o" , outputPath , sourcePath}) ;
+    vector<char*> argv ;
+    for(string& argument : arguments)
+        argv.push_back(argument.data()) ;
+    argv.push_back(nullptr) ;
+
+    // compiler diagnostics are written to a file instead of stderr of the host process
+    posix_spawn_file_actions_t actions ;
+    posix_spawn_file_actions_init(&actions) ;
+    posix_spawn_file_actions_addopen(&actions , STDOUT_FILENO , diagnosticsPath.c_str() , O_WRONLY | O_CREAT | O_TRUNC , 0600) ;
+    posix_spawn_file_actions_adddup2(&actions , STDOUT_FILENO , STDERR_FILENO) ;
+    pid_t pid ;
+    int spawnError = posix_spawnp(&pid , argv[0] , &actions , nullptr , argv.data() , environ) ;
+    posix_spawn_file_actions_destroy(&actions) ;
+
+    optional<string> error ;
+    if(spawnError != 0)
+        error = string("cannot execute cc: ") + strerror(spawnError) ;
+    else {
+        int status = 0 ;
+        while(waitpid(pid , &status , 0) < 0 && errno == EINTR) {}
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            ifstream diagnosticsFile(diagnosticsPath) ;
+            ostringstream diagnostics ;
+            diagnostics << diagnosticsFile.rdbuf() ;
+            error = diagnostics.str().empty() ? string("cc failed") : diagnostics.str() ;
+        }
+    }
+    removeTemporaryDirectory(directory) ;
+    return error ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
@@ -0,0 +1,32 @@
+#ifndef PLJIT_CCOMPILER_HPP
+#define PLJIT_CCOMPILER_HPP
+//---------------------------------------------------------------------------
+#include <optional>
+#include <string>
+#include <string_view>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// invoke the system C compiler ("cc") , which must be installed locally (no network access is needed)
+class CCompiler {
+    public:
+    enum class Output {
+        // position independent shared object , loaded with SharedObject
+        SHARED_OBJECT ,
+        // relocatable ELF object , linked into another binary
+        OBJECT_FILE
+    };
+
+    /// compile C source at -O2 into outputPath , return diagnostics of the compiler on failure
+    static std::optional<std::string> compile(std::string_view source , const std::string& outputPath , Output output) ;
+
+    /// create a private temporary directory (in $TMPDIR or /tmp) , empty string on failure
+    static std::string createTemporaryDirectory() ;
+
+    /// remove directory created by createTemporaryDirectory together with its files
+    static void removeTemporaryDirectory(const std::string& directory) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_CCOMPILER_HPP
@@ -0,0 +1,119 @@
+#include "pljit/backend/CEmitter.hpp"
+//---------------------------------------------------------------------------
+#include <cstdio>
+#include <limits>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    string value(uint32_t index) {
+        return "v" + to_string(index) ;
+    }
+    //---------------------------------------------------------------------------
+    string literal(int64_t constant)
+    /// C literal of constant , INT64_MIN cannot be written as negated literal
+    {
+        if(constant == numeric_limits<int64_t>::min())
+            return "INT64_MIN" ;
+        return "INT64_C(" + to_string(constant) + ")" ;
+    }
+    //---------------------------------------------------------------------------
+    string string_literal(string_view text) {
+        string result = "\"" ;
+        for(char character : text) {
+            if(character == '"' || character == '\\')
+                result += {'\\' , character} ;
+            else if(character == '\n')
+                result += "\\n" ;
+            else if(static_cast<unsigned char>(character) < 0x20 || static_cast<unsigned char>(character) >= 0x7f) {
+                // octal escape sequence has at most three digits , so it cannot swallow next character
+                char escape[5] ;
+                snprintf(escape , sizeof(escape) , "\\%03o" , static_cast<unsigned char>(character)) ;
+                result += escape ;
+            }
+            else
+                result += character ;
+        }
+        return result + "\"" ;
+    }
+    //---------------------------------------------------------------------------
+    string wrap(string_view expression)
+    /// convert unsigned result back to int64_t (two's complement)
+    {
+        return "(int64_t) (" + string(expression) + ")" ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+CEmitter::CEmitter() {
+    source = "/* generated by pljit */\n"
+             "#include <stdint.h>\n" ;
+}
+//---------------------------------------------------------------------------
+void CEmitter::emitFunction(const ir::Function& function , std::string_view symbol) {
+    using Opcode = ir::Instruction::Opcode ;
+    const management::CodeManager& manager = *function.getManager() ;
+    source += "\nint64_t " + string(symbol) + "(const int64_t* parameterList , const char** error) {\n" ;
+    source += "    (void) parameterList ;\n" ;
+    source += "    *error = 0 ;\n" ;
+    const std::pmr::vector<ir::Instruction>& instructions = function.getInstructions() ;
+    for(uint32_t index = 0 ; index < instructions.size() ; ++index) {
+        const ir::Instruction& instruction = instructions[index] ;
+        string target = value(index) , left = value(instruction.left) , right = value(instruction.right) ;
+        string unsignedLeft = "(uint64_t) " + left , unsignedRight = "(uint64_t) " + right ;
+        // runtime error leaves function , the branch is marked as unlikely
+        auto trap = [&](string_view condition , string_view message) {
+            string text = manager.runtimeErrorText(function.getReference(instruction) , message) ;
+            source += "    if(__builtin_expect(" + string(condition) + " , 0)) { *error = " + string_literal(text) + " ; return 0 ; }\n" ;
+        } ;
+        switch (instruction.opcode) {
+            case Opcode::PARAMETER: source += "    const int64_t " + target + " = parameterList[" + to_string(instruction.constant) + "] ;\n" ; break ;
+            case Opcode::CONSTANT: source += "    const int64_t " + target + " = " + literal(instruction.constant) + " ;\n" ; break ;
+            case Opcode::NEGATE: source += "    const int64_t " + target + " = " + wrap("0 - " + unsignedLeft) + " ;\n" ; break ;
+            case Opcode::ADD: source += "    const int64_t " + target + " = " + wrap(unsignedLeft + " + " + unsignedRight) + " ;\n" ; break ;
+            case Opcode::SUBTRACT: source += "    const int64_t " + target + " = " + wrap(unsignedLeft + " - " + unsignedRight) + " ;\n" ; break ;
+            case Opcode::MULTIPLY: source += "    const int64_t " + target + " = " + wrap(unsignedLeft + " * " + unsignedRight) + " ;\n" ; break ;
+            case Opcode::SHIFT_LEFT: source += "    const int64_t " + target + " = " + wrap(unsignedLeft + " << " + to_string(instruction.constant)) + " ;\n" ; break ;
+            // the C compiler strength reduces division by constant itself
+            case Opcode::DIVIDE_CONSTANT: source += "    const int64_t " + target + " = " + left + " / " + literal(instruction.constant) + " ;\n" ; break ;
+            case Opcode::DIVIDE:
+            case Opcode::DIVIDE_NONZERO: {
+                if(instruction.opcode == Opcode::DIVIDE)
+                    trap(right + " == 0" , "Divide by Zero") ;
+                // INT64_MIN / -1 wraps around
+                source += "    const int64_t " + target + " = " + right + " == -1 ? " + wrap("0 - " + unsignedLeft) + " : " + left + " / " + right + " ;\n" ;
+            }
+            break ;
+            case Opcode::CHECKED_DIVIDE: {
+                trap(right + " == 0" , "Divide by Zero") ;
+                trap("(" + left + " == INT64_MIN && " + right + " == -1)" , "Integer Overflow") ;
+                source += "    const int64_t " + target + " = " + left + " / " + right + " ;\n" ;
+            }
+            break ;
+            case Opcode::CHECKED_NEGATE:
+            case Opcode::CHECKED_ADD:
+            case Opcode::CHECKED_SUBTRACT:
+            case Opcode::CHECKED_MULTIPLY: {
+                source += "    int64_t " + target + " ;\n" ;
+                string operands = instruction.opcode == Opcode::CHECKED_NEGATE ? "INT64_C(0) , " + left : left + " , " + right ;
+                string builtin = instruction.opcode == Opcode::CHECKED_ADD ? "__builtin_add_overflow" :
+                                 instruction.opcode == Opcode::CHECKED_MULTIPLY ? "__builtin_mul_overflow" : "__builtin_sub_overflow" ;
+                trap(builtin + "(" + operands + " , &" + target + ")" , "Integer Overflow") ;
+            }
+            break ;
+            case Opcode::RETURN: source += "    return " + left + " ;\n" ; break ;
+        }
+    }
+    source += "}\n" ;
+}
+//---------------------------------------------------------------------------
+const std::string& CEmitter::getSource() const {
+    return source ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
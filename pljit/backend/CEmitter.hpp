@@ -0,0 +1,35 @@
+#ifndef PLJIT_CEMITTER_HPP
+#define PLJIT_CEMITTER_HPP
+//---------------------------------------------------------------------------
+#include "pljit/ir/IR.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <string_view>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// translate lowered functions into a C translation unit which is compiled by the system C compiler .
+/// each function is defined as int64_t symbol(const int64_t* parameterList , const char** error) , error is set to
+/// the runtime error message (nullptr on success) . arithmetic follows the IR exactly : unchecked operations wrap
+/// around , checked operations use __builtin_*_overflow
+class CEmitter {
+    // emitted source code
+    std::string source ;
+
+    public:
+    // signature of emitted functions
+    using Entry = int64_t (*)(const int64_t* parameterList , const char** error) ;
+
+    CEmitter() ;
+
+    /// append definition of function with external linkage , symbol must be a valid C identifier
+    void emitFunction(const ir::Function& function , std::string_view symbol) ;
+
+    /// get emitted translation unit
+    const std::string& getSource() const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_CEMITTER_HPP
@@ -0,0 +1,241 @@
+#include "pljit/backend/CodeHeap.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#define PLJIT_CODE_HEAP 1
+#endif
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // int3 , executing released code traps immediately
+    constexpr uint8_t TRAP_INSTRUCTION = 0xCC ;
+    //---------------------------------------------------------------------------
+    constexpr size_t class_size(size_t sizeClass) {
+        return CodeHeap::MIN_BLOCK_SIZE << sizeClass ;
+    }
+    //---------------------------------------------------------------------------
+    size_t size_class(size_t size)
+    /// smallest size class which holds size bytes
+    {
+        size_t sizeClass = 0 ;
+        while(class_size(sizeClass) < size)
+            ++sizeClass ;
+        return sizeClass ;
+    }
+#ifdef PLJIT_CODE_HEAP
+    //---------------------------------------------------------------------------
+    pair<int , void*> open_chunk(bool hugePages)
+    /// memory file of CHUNK_SIZE bytes and its read+execute mapping , file is -1 on failure
+    {
+        int file = memfd_create("pljit-code" , MFD_CLOEXEC | (hugePages ? MFD_HUGETLB : 0u)) ;
+        if(file < 0)
+            return {-1 , nullptr} ;
+        if(ftruncate(file , CodeHeap::CHUNK_SIZE) == 0) {
+            void* begin = mmap(nullptr , CodeHeap::CHUNK_SIZE , PROT_READ | PROT_EXEC , MAP_SHARED , file , 0) ;
+            if(begin != MAP_FAILED)
+                return {file , begin} ;
+        }
+        close(file) ;
+        return {-1 , nullptr} ;
+    }
+#endif
+    //---------------------------------------------------------------------------
+    bool write_block(int file , bool hugePages , size_t offset , const uint8_t* code , size_t size , size_t blockSize)
+    /// copy code to block at offset of memory file and fill the rest of the block with traps ,
+    /// the writable mapping covers only the pages of the block (the whole chunk for huge pages) and exists only while copying
+    {
+#ifdef PLJIT_CODE_HEAP
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE)) ;
+        size_t begin = hugePages ? 0 : offset & ~(pageSize - 1) ;
+        size_t end = hugePages ? CodeHeap::CHUNK_SIZE : (offset + blockSize + pageSize - 1) & ~(pageSize - 1) ;
+        void* alias = mmap(nullptr , end - begin , PROT_READ | PROT_WRITE , MAP_SHARED , file , static_cast<off_t>(begin)) ;
+        if(alias == MAP_FAILED)
+            return false ;
+        uint8_t* block = static_cast<uint8_t*>(alias) + (offset - begin) ;
+        if(size > 0)
+            memcpy(block , code , size) ;
+        memset(block + size , TRAP_INSTRUCTION , blockSize - size) ;
+        munmap(alias , end - begin) ;
+        return true ;
+#else
+        (void) file ; (void) hugePages ; (void) offset ; (void) code ; (void) size ; (void) blockSize ;
+        return false ;
+#endif
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+CodeHeap::CodeHeap(bool hugePages) : useHugePages(hugePages) {}
+//---------------------------------------------------------------------------
+CodeHeap::~CodeHeap() {
+#ifdef PLJIT_CODE_HEAP
+    for(Chunk& chunk : chunks) {
+        munmap(chunk.begin , CHUNK_SIZE) ;
+        close(chunk.file) ;
+    }
+#endif
+}
+//---------------------------------------------------------------------------
+bool CodeHeap::isSupported() {
+#ifdef PLJIT_CODE_HEAP
+    return true ;
+#else
+    return false ;
+#endif
+}
+//---------------------------------------------------------------------------
+std::optional<size_t> CodeHeap::mapChunk() {
+#ifdef PLJIT_CODE_HEAP
+    bool hugePages = useHugePages ;
+    auto [file , begin] = open_chunk(hugePages) ;
+    if(file < 0 && hugePages) {
+        // no huge pages are reserved
+        hugePages = false ;
+        tie(file , begin) = open_chunk(false) ;
+    }
+    if(file < 0)
+        return nullopt ;
+    chunks.push_back({file , static_cast<uint8_t*>(begin) , hugePages}) ;
+    return chunks.size() - 1 ;
+#else
+    return nullopt ;
+#endif
+}
+//---------------------------------------------------------------------------
+const CodeHeap::Chunk& CodeHeap::findChunk(const uint8_t* address) const {
+    for(const Chunk& chunk : chunks)
+        if(address >= chunk.begin && address < chunk.begin + CHUNK_SIZE)
+            return chunk ;
+    assert(false && "address is not within code heap") ;
+    return chunks.front() ;
+}
+//---------------------------------------------------------------------------
+void CodeHeap::insertFree(Arena& arena , uint8_t* chunkBegin , uint8_t* block , size_t sizeClass) {
+    // merge with free buddy as long as possible , buddies differ only in the bit of their size
+    for(; sizeClass + 1 < NUM_SIZE_CLASSES ; ++sizeClass) {
+        uint8_t* buddy = chunkBegin + (static_cast<size_t>(block - chunkBegin) ^ class_size(sizeClass)) ;
+        if(arena.freeBlocks[sizeClass].erase(buddy) == 0)
+            break ;
+        block = min(block , buddy) ;
+    }
+    arena.freeBlocks[sizeClass].insert(block) ;
+}
+//---------------------------------------------------------------------------
+void CodeHeap::releaseRange(Arena& arena , size_t end) {
+    // largest size class which is aligned at top and fits (all sizes are multiples of MIN_BLOCK_SIZE)
+    while(arena.top < end) {
+        size_t sizeClass = NUM_SIZE_CLASSES - 1 ;
+        while(arena.top % class_size(sizeClass) != 0 || arena.top + class_size(sizeClass) > end)
+            --sizeClass ;
+        insertFree(arena , chunks[arena.current.value()].begin , chunks[arena.current.value()].begin + arena.top , sizeClass) ;
+        arena.top += class_size(sizeClass) ;
+        freeBytes += class_size(sizeClass) ;
+    }
+}
+//---------------------------------------------------------------------------
+uint8_t* CodeHeap::takeBlock(Arena& arena , size_t sizeClass) {
+    if(!arena.freeBlocks[sizeClass].empty()) {
+        uint8_t* block = *arena.freeBlocks[sizeClass].begin() ;
+        arena.freeBlocks[sizeClass].erase(arena.freeBlocks[sizeClass].begin()) ;
+        freeBytes -= class_size(sizeClass) ;
+        return block ;
+    }
+    // fresh memory of current chunk keeps consecutively allocated code adjacent , blocks are aligned to their size
+    if(arena.current.has_value()) {
+        size_t alignedTop = (arena.top + class_size(sizeClass) - 1) & ~(class_size(sizeClass) - 1) ;
+        if(alignedTop + class_size(sizeClass) <= CHUNK_SIZE) {
+            releaseRange(arena , alignedTop) ;
+            uint8_t* block = chunks[arena.current.value()].begin + arena.top ;
+            arena.top += class_size(sizeClass) ;
+            return block ;
+        }
+    }
+    // split a free block of a larger size class , upper halves are kept in the free lists
+    for(size_t larger = sizeClass + 1 ; larger < NUM_SIZE_CLASSES ; ++larger) {
+        if(arena.freeBlocks[larger].empty())
+            continue ;
+        uint8_t* block = *arena.freeBlocks[larger].begin() ;
+        arena.freeBlocks[larger].erase(arena.freeBlocks[larger].begin()) ;
+        for(size_t half = larger ; half > sizeClass ; --half)
+            arena.freeBlocks[half - 1].insert(block + class_size(half - 1)) ;
+        freeBytes -= class_size(sizeClass) ;
+        return block ;
+    }
+    optional<size_t> chunk = mapChunk() ;
+    if(!chunk.has_value())
+        return nullptr ;
+    // remainder of previous chunk is split into free blocks
+    if(arena.current.has_value())
+        releaseRange(arena , CHUNK_SIZE) ;
+    arena.current = chunk ;
+    arena.top = class_size(sizeClass) ;
+    return chunks[chunk.value()].begin ;
+}
+//---------------------------------------------------------------------------
+std::optional<CodeHeap::Block> CodeHeap::allocate(const uint8_t* code , size_t size , Temperature temperature) {
+    if(size == 0 || size > CHUNK_SIZE)
+        return nullopt ;
+    size_t sizeClass = size_class(size) ;
+    uint8_t* block ;
+    Chunk chunk {} ;
+    {
+        unique_lock lock(heapMutex) ;
+        block = takeBlock(arenas[static_cast<size_t>(temperature)] , sizeClass) ;
+        if(block == nullptr)
+            return nullopt ;
+        chunk = findChunk(block) ;
+        allocatedBytes += class_size(sizeClass) ;
+        if(temperature == Temperature::HOT)
+            hotBytes += class_size(sizeClass) ;
+    }
+    Block result {block , class_size(sizeClass) , temperature} ;
+    if(!write_block(chunk.file , chunk.hugePages , static_cast<size_t>(block - chunk.begin) , code , size , result.size)) {
+        release(result) ;
+        return nullopt ;
+    }
+    __builtin___clear_cache(reinterpret_cast<char*>(block) , reinterpret_cast<char*>(block + size)) ;
+    return result ;
+}
+//---------------------------------------------------------------------------
+void CodeHeap::release(const Block& block) {
+    // block is owned by caller until it is within a free list
+    uint8_t* address = static_cast<uint8_t*>(const_cast<void*>(block.code)) ;
+    Chunk chunk {} ;
+    {
+        unique_lock lock(heapMutex) ;
+        chunk = findChunk(address) ;
+    }
+    write_block(chunk.file , chunk.hugePages , static_cast<size_t>(address - chunk.begin) , nullptr , 0 , block.size) ;
+
+    unique_lock lock(heapMutex) ;
+    allocatedBytes -= block.size ;
+    if(block.temperature == Temperature::HOT)
+        hotBytes -= block.size ;
+    freeBytes += block.size ;
+    insertFree(arenas[static_cast<size_t>(block.temperature)] , chunk.begin , address , size_class(block.size)) ;
+}
+//---------------------------------------------------------------------------
+CodeHeap::Statistics CodeHeap::getStatistics() {
+    unique_lock lock(heapMutex) ;
+    Statistics statistics ;
+    statistics.mappedBytes = chunks.size() * CHUNK_SIZE ;
+    statistics.allocatedBytes = allocatedBytes ;
+    statistics.hotBytes = hotBytes ;
+    statistics.freeBytes = freeBytes ;
+    for(const Chunk& chunk : chunks)
+        statistics.hugePageChunks += chunk.hugePages ;
+    return statistics ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
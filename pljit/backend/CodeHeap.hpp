@@ -0,0 +1,117 @@
+#ifndef PLJIT_CODEHEAP_HPP
+#define PLJIT_CODEHEAP_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// executable memory shared by the machine code of many functions . chunks of CHUNK_SIZE bytes are split into blocks
+/// of power-of-two size classes which are aligned to their size (buddy blocks) , blocks of released code are kept in a
+/// free list of their size class and reused , a released block is merged with its free buddy into the next larger class .
+/// memory is never writable and executable at the same address (W^X) : chunks are memory files mapped read+execute ,
+/// code is copied through a temporary writable mapping of the same file . hot and cold code are allocated from
+/// separate chunks , so frequently called functions are adjacent and share cache lines , pages and iTLB entries
+class CodeHeap {
+    public:
+    /// arena of a block
+    enum class Temperature : uint8_t {
+        COLD ,
+        HOT
+    };
+    // size of a chunk (size of a huge page on x86-64)
+    static constexpr size_t CHUNK_SIZE = size_t(2) << 20 ;
+    // size of smallest size class (cache line)
+    static constexpr size_t MIN_BLOCK_SIZE = 64 ;
+    // number of size classes , largest class is a whole chunk
+    static constexpr size_t NUM_SIZE_CLASSES = 16 ;
+
+    /// block of executable memory which holds code
+    struct Block {
+        const void* code = nullptr ;
+        // size of size class of block
+        size_t size = 0 ;
+        Temperature temperature = Temperature::COLD ;
+    };
+    /// usage of heap in bytes
+    struct Statistics {
+        // size of all chunks
+        size_t mappedBytes = 0 ;
+        // size of blocks which hold code
+        size_t allocatedBytes = 0 ;
+        // size of blocks of hot arena which hold code
+        size_t hotBytes = 0 ;
+        // size of blocks within free lists
+        size_t freeBytes = 0 ;
+        // number of chunks backed by huge pages
+        size_t hugePageChunks = 0 ;
+    };
+
+    private:
+    struct Chunk {
+        // memory file of chunk
+        int file ;
+        // read+execute mapping of file
+        uint8_t* begin ;
+        bool hugePages ;
+    };
+    struct Arena {
+        // index of chunk which blocks are carved from (nullopt before first allocation)
+        std::optional<size_t> current ;
+        // offset of first unused byte of current chunk
+        size_t top = 0 ;
+        // released blocks of each size class ordered by address
+        std::array<std::set<uint8_t*> , NUM_SIZE_CLASSES> freeBlocks ;
+    };
+
+    // try to back chunks by huge pages
+    bool useHugePages ;
+    // guards all members below
+    std::mutex heapMutex ;
+    std::vector<Chunk> chunks ;
+    std::array<Arena , 2> arenas ;
+    size_t allocatedBytes = 0 ;
+    size_t hotBytes = 0 ;
+    size_t freeBytes = 0 ;
+
+    /// map a new chunk , nullopt on failure
+    std::optional<size_t> mapChunk() ;
+    /// chunk which contains address
+    const Chunk& findChunk(const uint8_t* address) const ;
+    /// take a block of size class from arena , nullptr on failure
+    uint8_t* takeBlock(Arena& arena , size_t sizeClass) ;
+    /// put free block of size class into free list of arena , merged with its free buddies
+    void insertFree(Arena& arena , uint8_t* chunkBegin , uint8_t* block , size_t sizeClass) ;
+    /// split [top , end) of current chunk of arena into free blocks , top is advanced to end
+    void releaseRange(Arena& arena , size_t end) ;
+
+    public:
+    /// use huge pages for chunks if the system provides them (falls back to normal pages)
+    explicit CodeHeap(bool hugePages = false) ;
+
+    CodeHeap(const CodeHeap&) = delete ;
+    CodeHeap& operator=(const CodeHeap&) = delete ;
+    /// unmap all chunks , code of the heap must not be executed anymore
+    ~CodeHeap() ;
+
+    /// check if executable memory can be allocated on this platform (Linux)
+    static bool isSupported() ;
+
+    /// copy code into a block of arena , nullopt if code is larger than a chunk or memory cannot be mapped
+    std::optional<Block> allocate(const uint8_t* code , size_t size , Temperature temperature) ;
+
+    /// return block to free list of its size class , block is filled with trapping instructions
+    void release(const Block& block) ;
+
+    /// current usage of heap
+    Statistics getStatistics() ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_CODEHEAP_HPP
@@ -0,0 +1,475 @@
+#include "pljit/backend/CodeRegistry.hpp"
+//---------------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <mutex>
+#ifdef __linux__
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#define PLJIT_CODE_REGISTRY 1
+#endif
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+extern "C" {
+// weak , another JIT compiler of the process may define the interface as well
+__attribute__((noinline , weak)) void __jit_debug_register_code() {
+    // gdb sets a breakpoint here , the call must not be optimized away
+    __asm__ volatile("" ::: "memory") ;
+}
+__attribute__((weak)) jit_descriptor __jit_debug_descriptor = {1 , JIT_NOACTION , nullptr , nullptr} ;
+}
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // guards files , entries of GDB JIT interface and enabled outputs
+    mutex registryMutex ;
+    atomic<uint8_t> enabledOutputs = 0 ;
+#ifdef PLJIT_CODE_REGISTRY
+    FILE* perfMap = nullptr ;
+    int jitdumpFile = -1 ;
+    // executable mapping of jitdump file , perf record finds the file by this mapping
+    void* jitdumpMarker = nullptr ;
+    size_t jitdumpMarkerSize = 0 ;
+    // index of next code load record
+    uint64_t codeIndex = 0 ;
+    //---------------------------------------------------------------------------
+    // records of jitdump format (perf: tools/perf/Documentation/jitdump-specification.txt)
+    constexpr uint32_t JITDUMP_MAGIC = 0x4A695444 ;
+    constexpr uint32_t JITDUMP_VERSION = 1 ;
+    constexpr uint32_t JIT_CODE_LOAD = 0 ;
+    constexpr uint32_t JIT_CODE_DEBUG_INFO = 2 ;
+    struct JitdumpHeader {
+        uint32_t magic ;
+        uint32_t version ;
+        uint32_t totalSize ;
+        uint32_t elfMachine ;
+        uint32_t padding ;
+        uint32_t pid ;
+        uint64_t timestamp ;
+        uint64_t flags ;
+    };
+    struct RecordHeader {
+        uint32_t id ;
+        // size of record including header and padding
+        uint32_t totalSize ;
+        uint64_t timestamp ;
+    };
+    //---------------------------------------------------------------------------
+    // DWARF constants of a minimal compilation unit
+    constexpr uint8_t DW_TAG_compile_unit = 0x11 , DW_TAG_subprogram = 0x2e ;
+    constexpr uint8_t DW_AT_name = 0x03 , DW_AT_stmt_list = 0x10 , DW_AT_low_pc = 0x11 , DW_AT_high_pc = 0x12 , DW_AT_producer = 0x25 ;
+    constexpr uint8_t DW_FORM_addr = 0x01 , DW_FORM_data4 = 0x06 , DW_FORM_string = 0x08 ;
+    constexpr uint8_t DW_LNS_copy = 0x01 , DW_LNS_advance_pc = 0x02 , DW_LNS_advance_line = 0x03 ;
+    constexpr uint8_t DW_LNE_end_sequence = 0x01 , DW_LNE_set_address = 0x02 ;
+    //---------------------------------------------------------------------------
+    template<typename T>
+    void append(vector<char>& bytes , const T& value) {
+        const char* begin = reinterpret_cast<const char*>(&value) ;
+        bytes.insert(bytes.end() , begin , begin + sizeof(T)) ;
+    }
+    //---------------------------------------------------------------------------
+    template<typename T>
+    void patch(vector<char>& bytes , size_t offset , const T& value) {
+        memcpy(bytes.data() + offset , &value , sizeof(T)) ;
+    }
+    //---------------------------------------------------------------------------
+    uint32_t append_string(vector<char>& bytes , string_view text)
+    /// append zero terminated string , return its offset
+    {
+        uint32_t offset = static_cast<uint32_t>(bytes.size()) ;
+        bytes.insert(bytes.end() , text.begin() , text.end()) ;
+        bytes.push_back('\0') ;
+        return offset ;
+    }
+    //---------------------------------------------------------------------------
+    void append_uleb128(vector<char>& bytes , uint64_t value) {
+        do {
+            uint8_t byte = value & 0x7f ;
+            value >>= 7 ;
+            bytes.push_back(static_cast<char>(value != 0 ? byte | 0x80 : byte)) ;
+        } while(value != 0) ;
+    }
+    //---------------------------------------------------------------------------
+    void append_sleb128(vector<char>& bytes , int64_t value) {
+        bool more = true ;
+        while(more) {
+            uint8_t byte = value & 0x7f ;
+            // arithmetic shift keeps sign
+            value >>= 7 ;
+            more = !((value == 0 && (byte & 0x40) == 0) || (value == -1 && (byte & 0x40) != 0)) ;
+            bytes.push_back(static_cast<char>(more ? byte | 0x80 : byte)) ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    void align(vector<char>& bytes , size_t alignment) {
+        bytes.resize((bytes.size() + alignment - 1) / alignment * alignment , '\0') ;
+    }
+    //---------------------------------------------------------------------------
+    vector<char> debug_abbrev()
+    /// compilation unit with one subprogram
+    {
+        vector<char> bytes ;
+        for(uint8_t byte : initializer_list<uint8_t>{1 , DW_TAG_compile_unit , 1 /*children*/ , DW_AT_name , DW_FORM_string , DW_AT_producer , DW_FORM_string ,
+                            DW_AT_stmt_list , DW_FORM_data4 , DW_AT_low_pc , DW_FORM_addr , DW_AT_high_pc , DW_FORM_addr , 0 , 0 ,
+                            2 , DW_TAG_subprogram , 0 /*no children*/ , DW_AT_name , DW_FORM_string , DW_AT_low_pc , DW_FORM_addr ,
+                            DW_AT_high_pc , DW_FORM_addr , 0 , 0 , 0})
+            bytes.push_back(static_cast<char>(byte)) ;
+        return bytes ;
+    }
+    //---------------------------------------------------------------------------
+    vector<char> debug_info(string_view symbol , string_view fileName , uint64_t begin , uint64_t end) {
+        vector<char> bytes ;
+        append(bytes , uint32_t(0)) ;
+        append(bytes , uint16_t(2)) ;
+        // offset of abbreviations , size of address
+        append(bytes , uint32_t(0)) ;
+        append(bytes , uint8_t(8)) ;
+        bytes.push_back(1) ;
+        append_string(bytes , fileName) ;
+        append_string(bytes , "pljit") ;
+        append(bytes , uint32_t(0)) ;
+        append(bytes , begin) ;
+        append(bytes , end) ;
+        bytes.push_back(2) ;
+        append_string(bytes , symbol) ;
+        append(bytes , begin) ;
+        append(bytes , end) ;
+        // end of children
+        bytes.push_back(0) ;
+        patch(bytes , 0 , static_cast<uint32_t>(bytes.size() - 4)) ;
+        return bytes ;
+    }
+    //---------------------------------------------------------------------------
+    vector<char> debug_line(string_view fileName , uint64_t begin , size_t size , const CodeRegistry::LineTable& lines)
+    /// line number program (version 2) which uses standard opcodes only
+    {
+        vector<char> bytes ;
+        append(bytes , uint32_t(0)) ;
+        append(bytes , uint16_t(2)) ;
+        append(bytes , uint32_t(0)) ;
+        size_t headerBegin = bytes.size() ;
+        // minimum instruction length , default is_stmt , line base , line range , opcode base
+        for(int8_t byte : {1 , 1 , -5 , 14 , 13})
+            append(bytes , byte) ;
+        for(uint8_t length : {0 , 1 , 1 , 1 , 1 , 0 , 0 , 0 , 1 , 0 , 0 , 1})
+            append(bytes , length) ;
+        // no include directories , one file (directory , modification time , length)
+        bytes.push_back(0) ;
+        append_string(bytes , fileName) ;
+        append_uleb128(bytes , 0) ;
+        append_uleb128(bytes , 0) ;
+        append_uleb128(bytes , 0) ;
+        bytes.push_back(0) ;
+        patch(bytes , headerBegin - 4 , static_cast<uint32_t>(bytes.size() - headerBegin)) ;
+
+        bytes.push_back(0) ;
+        append_uleb128(bytes , 9) ;
+        bytes.push_back(DW_LNE_set_address) ;
+        append(bytes , begin) ;
+        size_t offset = 0 ;
+        int64_t line = 1 ;
+        for(auto [codeOffset , sourceLine] : lines) {
+            if(codeOffset > offset) {
+                bytes.push_back(DW_LNS_advance_pc) ;
+                append_uleb128(bytes , codeOffset - offset) ;
+                offset = codeOffset ;
+            }
+            int64_t target = static_cast<int64_t>(sourceLine) + 1 ;
+            if(target != line) {
+                bytes.push_back(DW_LNS_advance_line) ;
+                append_sleb128(bytes , target - line) ;
+                line = target ;
+            }
+            bytes.push_back(DW_LNS_copy) ;
+        }
+        if(size > offset) {
+            bytes.push_back(DW_LNS_advance_pc) ;
+            append_uleb128(bytes , size - offset) ;
+        }
+        bytes.push_back(0) ;
+        append_uleb128(bytes , 1) ;
+        bytes.push_back(DW_LNE_end_sequence) ;
+        patch(bytes , 0 , static_cast<uint32_t>(bytes.size() - 4)) ;
+        return bytes ;
+    }
+    //---------------------------------------------------------------------------
+    uint64_t monotonic_time()
+    /// timestamp of jitdump records , matches perf record -k mono
+    {
+        timespec time {} ;
+        clock_gettime(CLOCK_MONOTONIC , &time) ;
+        return static_cast<uint64_t>(time.tv_sec) * 1000000000 + static_cast<uint64_t>(time.tv_nsec) ;
+    }
+    //---------------------------------------------------------------------------
+    void write_record(vector<char>& record)
+    /// pad record , fill in its size and append it to jitdump file
+    {
+        align(record , 8) ;
+        patch(record , offsetof(RecordHeader , totalSize) , static_cast<uint32_t>(record.size())) ;
+        size_t written = 0 ;
+        while(written < record.size()) {
+            ssize_t result = write(jitdumpFile , record.data() + written , record.size() - written) ;
+            if(result <= 0)
+                return ;
+            written += static_cast<size_t>(result) ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    uint32_t elf_machine() {
+#if defined(__x86_64__)
+        return EM_X86_64 ;
+#elif defined(__aarch64__)
+        return EM_AARCH64 ;
+#else
+        return EM_NONE ;
+#endif
+    }
+    //---------------------------------------------------------------------------
+    void open_jitdump() {
+        jitdumpFile = open(CodeRegistry::getJitdumpPath().c_str() , O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC , 0666) ;
+        if(jitdumpFile < 0)
+            return ;
+        JitdumpHeader header {JITDUMP_MAGIC , JITDUMP_VERSION , sizeof(JitdumpHeader) , elf_machine() , 0 ,
+                              static_cast<uint32_t>(getpid()) , monotonic_time() , 0} ;
+        vector<char> bytes ;
+        append(bytes , header) ;
+        if(write(jitdumpFile , bytes.data() , bytes.size()) != static_cast<ssize_t>(bytes.size())) {
+            close(jitdumpFile) ;
+            jitdumpFile = -1 ;
+            return ;
+        }
+        jitdumpMarkerSize = static_cast<size_t>(sysconf(_SC_PAGESIZE)) ;
+        jitdumpMarker = mmap(nullptr , jitdumpMarkerSize , PROT_READ | PROT_EXEC , MAP_PRIVATE , jitdumpFile , 0) ;
+        if(jitdumpMarker == MAP_FAILED)
+            jitdumpMarker = nullptr ;
+    }
+    //---------------------------------------------------------------------------
+    void close_jitdump() {
+        if(jitdumpMarker != nullptr)
+            munmap(jitdumpMarker , jitdumpMarkerSize) ;
+        jitdumpMarker = nullptr ;
+        close(jitdumpFile) ;
+        jitdumpFile = -1 ;
+    }
+    //---------------------------------------------------------------------------
+    void write_jitdump(string_view symbol , string_view fileName , const void* code , size_t size , const CodeRegistry::LineTable& lines) {
+        uint64_t address = reinterpret_cast<uintptr_t>(code) ;
+        uint64_t time = monotonic_time() ;
+        if(!lines.empty()) {
+            // debug info precedes code load record of its code
+            vector<char> record ;
+            append(record , RecordHeader{JIT_CODE_DEBUG_INFO , 0 , time}) ;
+            append(record , address) ;
+            append(record , static_cast<uint64_t>(lines.size())) ;
+            for(auto [offset , line] : lines) {
+                append(record , address + offset) ;
+                append(record , static_cast<int32_t>(line + 1)) ;
+                append(record , int32_t(0)) ;
+                append_string(record , fileName) ;
+            }
+            write_record(record) ;
+        }
+        vector<char> record ;
+        append(record , RecordHeader{JIT_CODE_LOAD , 0 , time}) ;
+        append(record , static_cast<uint32_t>(getpid())) ;
+        append(record , static_cast<uint32_t>(syscall(SYS_gettid))) ;
+        // virtual address and address of code are the same
+        append(record , address) ;
+        append(record , address) ;
+        append(record , static_cast<uint64_t>(size)) ;
+        append(record , codeIndex++) ;
+        append_string(record , symbol) ;
+        const char* bytes = static_cast<const char*>(code) ;
+        record.insert(record.end() , bytes , bytes + size) ;
+        write_record(record) ;
+    }
+#endif
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+CodeRegistry::Registration::~Registration() {
+    if(symfile.empty())
+        return ;
+    unique_lock lock(registryMutex) ;
+    if(entry.prev_entry != nullptr)
+        entry.prev_entry->next_entry = entry.next_entry ;
+    else
+        __jit_debug_descriptor.first_entry = entry.next_entry ;
+    if(entry.next_entry != nullptr)
+        entry.next_entry->prev_entry = entry.prev_entry ;
+    __jit_debug_descriptor.relevant_entry = &entry ;
+    __jit_debug_descriptor.action_flag = JIT_UNREGISTER_FN ;
+    __jit_debug_register_code() ;
+    __jit_debug_descriptor.action_flag = JIT_NOACTION ;
+}
+//---------------------------------------------------------------------------
+void CodeRegistry::enable(uint8_t outputs) {
+#ifdef PLJIT_CODE_REGISTRY
+    unique_lock lock(registryMutex) ;
+    if((outputs & PERF_MAP) && perfMap == nullptr)
+        perfMap = fopen(getPerfMapPath().c_str() , "a") ;
+    else if(!(outputs & PERF_MAP) && perfMap != nullptr) {
+        fclose(perfMap) ;
+        perfMap = nullptr ;
+    }
+    if((outputs & JITDUMP) && jitdumpFile < 0)
+        open_jitdump() ;
+    else if(!(outputs & JITDUMP) && jitdumpFile >= 0)
+        close_jitdump() ;
+    // outputs whose file cannot be created stay disabled
+    enabledOutputs.store(static_cast<uint8_t>((perfMap != nullptr ? PERF_MAP : 0) | (jitdumpFile >= 0 ? JITDUMP : 0) | (outputs & GDB))) ;
+#else
+    (void) outputs ;
+#endif
+}
+//---------------------------------------------------------------------------
+uint8_t CodeRegistry::getOutputs() {
+    return enabledOutputs.load() ;
+}
+//---------------------------------------------------------------------------
+std::unique_ptr<CodeRegistry::Registration> CodeRegistry::registerCode(std::string_view symbol , std::string_view fileName , const void* code ,
+                                                                      size_t size , const LineTable& lines) {
+    uint8_t outputs = enabledOutputs.load() ;
+    if(outputs == 0)
+        return nullptr ;
+    unique_ptr<Registration> registration(new Registration()) ;
+    if(outputs & GDB)
+        registration->symfile = buildSymfile(symbol , fileName , code , size , lines) ;
+
+#ifdef PLJIT_CODE_REGISTRY
+    unique_lock lock(registryMutex) ;
+    if(perfMap != nullptr) {
+        fprintf(perfMap , "%llx %llx %.*s\n" , static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(code)) ,
+                static_cast<unsigned long long>(size) , static_cast<int>(symbol.size()) , symbol.data()) ;
+        fflush(perfMap) ;
+    }
+    if(jitdumpFile >= 0)
+        write_jitdump(symbol , fileName , code , size , lines) ;
+    if(!registration->symfile.empty()) {
+        jit_code_entry& entry = registration->entry ;
+        entry.symfile_addr = registration->symfile.data() ;
+        entry.symfile_size = registration->symfile.size() ;
+        entry.prev_entry = nullptr ;
+        entry.next_entry = __jit_debug_descriptor.first_entry ;
+        if(entry.next_entry != nullptr)
+            entry.next_entry->prev_entry = &entry ;
+        __jit_debug_descriptor.first_entry = &entry ;
+        __jit_debug_descriptor.relevant_entry = &entry ;
+        __jit_debug_descriptor.action_flag = JIT_REGISTER_FN ;
+        __jit_debug_register_code() ;
+        __jit_debug_descriptor.action_flag = JIT_NOACTION ;
+    }
+#endif
+    return registration ;
+}
+//---------------------------------------------------------------------------
+std::string CodeRegistry::getPerfMapPath() {
+#ifdef PLJIT_CODE_REGISTRY
+    return "/tmp/perf-" + to_string(getpid()) + ".map" ;
+#else
+    return "" ;
+#endif
+}
+//---------------------------------------------------------------------------
+std::string CodeRegistry::getJitdumpPath() {
+#ifdef PLJIT_CODE_REGISTRY
+    return "/tmp/jit-" + to_string(getpid()) + ".dump" ;
+#else
+    return "" ;
+#endif
+}
+//---------------------------------------------------------------------------
+std::vector<char> CodeRegistry::buildSymfile(std::string_view symbol , std::string_view fileName , const void* code , size_t size ,
+                                             const LineTable& lines) {
+#ifdef PLJIT_CODE_REGISTRY
+    // relocatable object whose .text is not stored but placed at address of code (as gdb expects for JIT code)
+    enum Section : uint16_t { NULL_SECTION , TEXT , SYMTAB , STRTAB , DEBUG_ABBREV , DEBUG_INFO , DEBUG_LINE , SHSTRTAB , NUM_SECTIONS } ;
+    uint64_t begin = reinterpret_cast<uintptr_t>(code) ;
+    vector<char> names(1 , '\0') ;
+    array<uint32_t , NUM_SECTIONS> nameOffsets {} ;
+    const array<string_view , NUM_SECTIONS> sectionNames = {"" , ".text" , ".symtab" , ".strtab" , ".debug_abbrev" , ".debug_info" , ".debug_line" , ".shstrtab"} ;
+    for(uint16_t section = TEXT ; section < NUM_SECTIONS ; ++section)
+        nameOffsets[section] = append_string(names , sectionNames[section]) ;
+
+    vector<char> strings(1 , '\0') ;
+    uint32_t fileOffset = append_string(strings , fileName) ;
+    uint32_t symbolOffset = append_string(strings , symbol) ;
+    vector<char> symbols ;
+    append(symbols , Elf64_Sym{}) ;
+    append(symbols , Elf64_Sym{fileOffset , ELF64_ST_INFO(STB_LOCAL , STT_FILE) , 0 , SHN_ABS , 0 , 0}) ;
+    append(symbols , Elf64_Sym{symbolOffset , ELF64_ST_INFO(STB_GLOBAL , STT_FUNC) , 0 , TEXT , 0 , size}) ;
+
+    array<vector<char> , NUM_SECTIONS> contents ;
+    contents[SYMTAB] = std::move(symbols) ;
+    contents[STRTAB] = std::move(strings) ;
+    contents[DEBUG_ABBREV] = debug_abbrev() ;
+    contents[DEBUG_INFO] = debug_info(symbol , fileName , begin , begin + size) ;
+    contents[DEBUG_LINE] = debug_line(fileName , begin , size , lines) ;
+    contents[SHSTRTAB] = std::move(names) ;
+
+    vector<char> object(sizeof(Elf64_Ehdr) , '\0') ;
+    array<Elf64_Shdr , NUM_SECTIONS> headers {} ;
+    for(uint16_t section = TEXT ; section < NUM_SECTIONS ; ++section) {
+        Elf64_Shdr& header = headers[section] ;
+        header.sh_name = nameOffsets[section] ;
+        header.sh_type = SHT_PROGBITS ;
+        header.sh_addralign = 1 ;
+        if(section != TEXT) {
+            align(object , 8) ;
+            header.sh_offset = object.size() ;
+            header.sh_size = contents[section].size() ;
+            object.insert(object.end() , contents[section].begin() , contents[section].end()) ;
+        }
+    }
+    headers[TEXT].sh_type = SHT_NOBITS ;
+    headers[TEXT].sh_flags = SHF_ALLOC | SHF_EXECINSTR ;
+    headers[TEXT].sh_addr = begin ;
+    headers[TEXT].sh_size = size ;
+    headers[TEXT].sh_addralign = 16 ;
+    headers[SYMTAB].sh_type = SHT_SYMTAB ;
+    headers[SYMTAB].sh_link = STRTAB ;
+    // index of first global symbol
+    headers[SYMTAB].sh_info = 2 ;
+    headers[SYMTAB].sh_entsize = sizeof(Elf64_Sym) ;
+    headers[SYMTAB].sh_addralign = 8 ;
+    headers[STRTAB].sh_type = SHT_STRTAB ;
+    headers[SHSTRTAB].sh_type = SHT_STRTAB ;
+
+    align(object , 8) ;
+    Elf64_Ehdr elfHeader {} ;
+    memcpy(elfHeader.e_ident , ELFMAG , SELFMAG) ;
+    elfHeader.e_ident[EI_CLASS] = ELFCLASS64 ;
+    elfHeader.e_ident[EI_DATA] = ELFDATA2LSB ;
+    elfHeader.e_ident[EI_VERSION] = EV_CURRENT ;
+    elfHeader.e_type = ET_REL ;
+    elfHeader.e_machine = static_cast<Elf64_Half>(elf_machine()) ;
+    elfHeader.e_version = EV_CURRENT ;
+    elfHeader.e_shoff = object.size() ;
+    elfHeader.e_ehsize = sizeof(Elf64_Ehdr) ;
+    elfHeader.e_shentsize = sizeof(Elf64_Shdr) ;
+    elfHeader.e_shnum = NUM_SECTIONS ;
+    elfHeader.e_shstrndx = SHSTRTAB ;
+    patch(object , 0 , elfHeader) ;
+    for(const Elf64_Shdr& header : headers)
+        append(object , header) ;
+    return object ;
+#else
+    (void) symbol ; (void) fileName ; (void) code ; (void) size ; (void) lines ;
+    return {} ;
+#endif
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
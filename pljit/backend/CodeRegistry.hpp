@@ -0,0 +1,94 @@
+#ifndef PLJIT_CODEREGISTRY_HPP
+#define PLJIT_CODEREGISTRY_HPP
+//---------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+// GDB JIT compilation interface , gdb sets a breakpoint in __jit_debug_register_code and reads the
+// in-memory object files of __jit_debug_descriptor (symbols must not be renamed)
+extern "C" {
+enum jit_actions_t : uint32_t {
+    JIT_NOACTION = 0 ,
+    JIT_REGISTER_FN ,
+    JIT_UNREGISTER_FN
+};
+struct jit_code_entry {
+    jit_code_entry* next_entry ;
+    jit_code_entry* prev_entry ;
+    const char* symfile_addr ;
+    uint64_t symfile_size ;
+};
+struct jit_descriptor {
+    uint32_t version ;
+    // jit_actions_t
+    uint32_t action_flag ;
+    jit_code_entry* relevant_entry ;
+    jit_code_entry* first_entry ;
+};
+void __jit_debug_register_code() ;
+extern jit_descriptor __jit_debug_descriptor ;
+}
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// publish machine code of functions to profilers and debuggers , which otherwise only see anonymous addresses .
+/// outputs are process wide and disabled by default :
+/// PERF_MAP appends "address size symbol" to /tmp/perf-<pid>.map (read by perf report) ,
+/// JITDUMP writes code and line records to /tmp/jit-<pid>.dump (merged by perf inject --jit , record with -k mono) ,
+/// GDB registers an in-memory ELF object with symbol , DWARF line table and address range at the GDB JIT interface
+class CodeRegistry {
+    public:
+    enum Output : uint8_t {
+        PERF_MAP = 1 ,
+        JITDUMP = 2 ,
+        GDB = 4
+    };
+    /// (offset of machine code , source line (0-based)) sorted by offset
+    using LineTable = std::vector<std::pair<size_t , size_t>> ;
+
+    /// registered code , it is removed from the GDB JIT interface when registration is destroyed
+    /// (perf map and jitdump are append-only)
+    class Registration {
+        // in-memory object file (empty if GDB output is disabled)
+        std::vector<char> symfile ;
+        jit_code_entry entry {} ;
+
+        friend class CodeRegistry ;
+        Registration() = default ;
+
+        public:
+        Registration(const Registration&) = delete ;
+        Registration& operator=(const Registration&) = delete ;
+        ~Registration() ;
+    };
+
+    /// enable given outputs (bitwise or of Output) and disable all others , files of enabled outputs are created
+    static void enable(uint8_t outputs) ;
+
+    /// currently enabled outputs
+    static uint8_t getOutputs() ;
+
+    /// register code [code , code + size) as function symbol defined in source file fileName ,
+    /// nullptr if no output is enabled
+    static std::unique_ptr<Registration> registerCode(std::string_view symbol , std::string_view fileName , const void* code ,
+                                                      size_t size , const LineTable& lines) ;
+
+    /// path of perf map of this process
+    static std::string getPerfMapPath() ;
+
+    /// path of jitdump file of this process
+    static std::string getJitdumpPath() ;
+
+    /// build ELF object file which describes code for the GDB JIT interface
+    static std::vector<char> buildSymfile(std::string_view symbol , std::string_view fileName , const void* code , size_t size ,
+                                          const LineTable& lines) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_CODEREGISTRY_HPP
@@ -0,0 +1,65 @@
+#include "pljit/backend/ObjectCompiler.hpp"
+#include "pljit/backend/CCompiler.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+//---------------------------------------------------------------------------
+#include <cctype>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+bool ObjectCompiler::isIdentifier(std::string_view symbol) {
+    if(symbol.empty() || isdigit(static_cast<unsigned char>(symbol[0])))
+        return false ;
+    for(char character : symbol)
+        if(!isalnum(static_cast<unsigned char>(character)) && character != '_')
+            return false ;
+    return true ;
+}
+//---------------------------------------------------------------------------
+std::optional<std::string> ObjectCompiler::addFunction(std::string_view symbol , std::string_view code , management::ArithmeticMode mode) {
+    if(!isIdentifier(symbol))
+        return "invalid symbol name: " + string(symbol) ;
+    if(symbols.contains(string(symbol)))
+        return "duplicate symbol name: " + string(symbol) ;
+
+    management::CodeManager manager(code) ;
+    syntax::TokenStream tokenStream(&manager) ;
+    if(!tokenStream.compileCode())
+        return manager.error_message() ;
+    syntax::FunctionDeclaration parseTree(&manager) ;
+    if(!parseTree.compileCode(tokenStream))
+        return manager.error_message() ;
+    semantic::FunctionAST functionAst(&manager) ;
+    if(!functionAst.compileCode(parseTree))
+        return manager.error_message() ;
+    semantic::OptimizationVisitor optimizationVisitor(semantic::OptimizationVisitor::ALL_PASSES , {} , mode) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    // runtime error messages are embedded into emitted code , so code manager is not needed afterwards
+    ir::Function function(functionAst , mode) ;
+    emitter.emitFunction(function , symbol) ;
+
+    symbols.emplace(symbol) ;
+    header += "/* " + to_string(function.num_parameters()) + " parameters */\n" ;
+    header += "int64_t " + string(symbol) + "(const int64_t* parameterList , const char** error) ;\n" ;
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+std::optional<std::string> ObjectCompiler::writeObject(const std::string& path) const {
+    return CCompiler::compile(emitter.getSource() , path , CCompiler::Output::OBJECT_FILE) ;
+}
+//---------------------------------------------------------------------------
+std::string ObjectCompiler::getHeader() const {
+    return "/* generated by pljit */\n"
+           "#include <stdint.h>\n"
+           "#ifdef __cplusplus\n"
+           "extern \"C\" {\n"
+           "#endif\n" + header +
+           "#ifdef __cplusplus\n"
+           "}\n"
+           "#endif\n" ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
@@ -0,0 +1,40 @@
+#ifndef PLJIT_OBJECTCOMPILER_HPP
+#define PLJIT_OBJECTCOMPILER_HPP
+//---------------------------------------------------------------------------
+#include "pljit/backend/CEmitter.hpp"
+#include "pljit/management/Arithmetic.hpp"
+//---------------------------------------------------------------------------
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// ahead of time compilation of PL functions into a relocatable ELF object which is linked into another binary .
+/// each function is exported with C linkage as int64_t symbol(const int64_t* parameterList , const char** error) ,
+/// error is set to the runtime error message (nullptr on success)
+class ObjectCompiler {
+    CEmitter emitter ;
+    // exported symbols
+    std::unordered_set<std::string> symbols ;
+    // declarations of exported symbols
+    std::string header ;
+
+    public:
+    /// compile and optimize source code of function , return compile error message on failure
+    std::optional<std::string> addFunction(std::string_view symbol , std::string_view code , management::ArithmeticMode mode) ;
+
+    /// write relocatable object of all added functions (compiled by system C compiler) , return error message on failure
+    std::optional<std::string> writeObject(const std::string& path) const ;
+
+    /// C header declaring all added functions
+    std::string getHeader() const ;
+
+    /// check if symbol is a valid C identifier
+    static bool isIdentifier(std::string_view symbol) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_OBJECTCOMPILER_HPP
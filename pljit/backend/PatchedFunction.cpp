@@ -0,0 +1,217 @@
+#include "pljit/backend/PatchedFunction.hpp"
+#include "pljit/management/DivisionTrap.hpp"
+//---------------------------------------------------------------------------
+#include <cassert>
+#include <cstring>
+#include <array>
+#include <string>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    using Opcode = ir::Instruction::Opcode ;
+    //---------------------------------------------------------------------------
+    // kind of a hole within a stencil
+    enum class Hole : uint8_t {
+        LEFT ,          // disp32 of left operand slot relative to rbp
+        RIGHT ,         // disp32 of right operand slot relative to rbp
+        DESTINATION ,   // disp32 of result slot relative to rbp
+        PARAMETER ,     // disp32 of parameter relative to parameter list (rdi)
+        FRAME_SIZE ,    // imm32 size of stack frame
+        IMMEDIATE64 ,   // imm64 constant or magic multiplier
+        IMMEDIATE8      // imm8 shift amount
+    };
+    //---------------------------------------------------------------------------
+    /// machine code with holes , entry state : rdi = parameter list , rbp = frame pointer
+    struct Stencil {
+        const uint8_t* code ;
+        size_t size ;
+        // (offset , kind) of holes
+        array<pair<uint8_t , Hole> , 3> holes ;
+        size_t numHoles ;
+        // offset of idiv instruction , 0 if stencil does not divide
+        size_t division = 0 ;
+    };
+    //---------------------------------------------------------------------------
+    // push rbp ; mov rbp , rsp ; sub rsp , FRAME_SIZE
+    constexpr uint8_t prologue_code[] = {0x55 , 0x48 , 0x89 , 0xE5 , 0x48 , 0x81 , 0xEC , 0 , 0 , 0 , 0} ;
+    // mov rax , [rdi + PARAMETER] ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t parameter_code[] = {0x48 , 0x8B , 0x87 , 0 , 0 , 0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // movabs rax , IMMEDIATE64 ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t constant_code[] = {0x48 , 0xB8 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; neg rax ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t negate_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0xF7 , 0xD8 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; add rax , [rbp + RIGHT] ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t add_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x03 , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; sub rax , [rbp + RIGHT] ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t subtract_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x2B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; imul rax , [rbp + RIGHT] ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t multiply_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x0F , 0xAF , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; mov rcx , [rbp + RIGHT] ; cqo ; idiv rcx ; mov [rbp + DESTINATION] , rax
+    // (INT64_MIN / -1 traps and is wrapped around by DivisionTrap)
+    constexpr uint8_t divide_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0x8B , 0x8D , 0 , 0 , 0 , 0 , 0x48 , 0x99 , 0x48 , 0xF7 , 0xF9 ,
+                                       0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; shl rax , IMMEDIATE8 ; mov [rbp + DESTINATION] , rax
+    constexpr uint8_t shift_left_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0x48 , 0xC1 , 0xE0 , 0 , 0x48 , 0x89 , 0x85 , 0 , 0 , 0 , 0} ;
+    // mov rcx , [rbp + LEFT] ; movabs rax , IMMEDIATE64 ; imul rcx   (rdx = high half of magic * value)
+    constexpr uint8_t multiply_high_code[] = {0x48 , 0x8B , 0x8D , 0 , 0 , 0 , 0 , 0x48 , 0xB8 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0x48 , 0xF7 , 0xE9} ;
+    // add rdx , rcx
+    constexpr uint8_t add_high_code[] = {0x48 , 0x01 , 0xCA} ;
+    // sub rdx , rcx
+    constexpr uint8_t subtract_high_code[] = {0x48 , 0x29 , 0xCA} ;
+    // sar rdx , IMMEDIATE8 ; mov rax , rdx ; shr rax , 63 ; add rdx , rax ; mov [rbp + DESTINATION] , rdx
+    constexpr uint8_t shift_round_code[] = {0x48 , 0xC1 , 0xFA , 0 , 0x48 , 0x89 , 0xD0 , 0x48 , 0xC1 , 0xE8 , 0x3F , 0x48 , 0x01 , 0xC2 ,
+                                            0x48 , 0x89 , 0x95 , 0 , 0 , 0 , 0} ;
+    // mov rax , [rbp + LEFT] ; leave ; ret
+    constexpr uint8_t return_code[] = {0x48 , 0x8B , 0x85 , 0 , 0 , 0 , 0 , 0xC9 , 0xC3} ;
+    //---------------------------------------------------------------------------
+    const Stencil prologue_stencil {prologue_code , sizeof(prologue_code) , {{{7 , Hole::FRAME_SIZE}}} , 1} ;
+    const Stencil parameter_stencil {parameter_code , sizeof(parameter_code) , {{{3 , Hole::PARAMETER} , {10 , Hole::DESTINATION}}} , 2} ;
+    const Stencil constant_stencil {constant_code , sizeof(constant_code) , {{{2 , Hole::IMMEDIATE64} , {13 , Hole::DESTINATION}}} , 2} ;
+    const Stencil negate_stencil {negate_code , sizeof(negate_code) , {{{3 , Hole::LEFT} , {13 , Hole::DESTINATION}}} , 2} ;
+    const Stencil add_stencil {add_code , sizeof(add_code) , {{{3 , Hole::LEFT} , {10 , Hole::RIGHT} , {17 , Hole::DESTINATION}}} , 3} ;
+    const Stencil subtract_stencil {subtract_code , sizeof(subtract_code) , {{{3 , Hole::LEFT} , {10 , Hole::RIGHT} , {17 , Hole::DESTINATION}}} , 3} ;
+    const Stencil multiply_stencil {multiply_code , sizeof(multiply_code) , {{{3 , Hole::LEFT} , {11 , Hole::RIGHT} , {18 , Hole::DESTINATION}}} , 3} ;
+    const Stencil divide_stencil {divide_code , sizeof(divide_code) , {{{3 , Hole::LEFT} , {10 , Hole::RIGHT} , {22 , Hole::DESTINATION}}} , 3 , 16} ;
+    const Stencil shift_left_stencil {shift_left_code , sizeof(shift_left_code) , {{{3 , Hole::LEFT} , {10 , Hole::IMMEDIATE8} , {14 , Hole::DESTINATION}}} , 3} ;
+    const Stencil multiply_high_stencil {multiply_high_code , sizeof(multiply_high_code) , {{{3 , Hole::LEFT} , {9 , Hole::IMMEDIATE64}}} , 2} ;
+    const Stencil add_high_stencil {add_high_code , sizeof(add_high_code) , {} , 0} ;
+    const Stencil subtract_high_stencil {subtract_high_code , sizeof(subtract_high_code) , {} , 0} ;
+    const Stencil shift_round_stencil {shift_round_code , sizeof(shift_round_code) , {{{3 , Hole::IMMEDIATE8} , {17 , Hole::DESTINATION}}} , 2} ;
+    const Stencil return_stencil {return_code , sizeof(return_code) , {{{3 , Hole::LEFT}}} , 1} ;
+    //---------------------------------------------------------------------------
+    int32_t slot_offset(uint32_t value)
+    /// offset of stack slot of value relative to rbp
+    {
+        return -8 * static_cast<int32_t>(value + 1) ;
+    }
+    //---------------------------------------------------------------------------
+    template<typename T>
+    void patch(vector<uint8_t>& code , size_t offset , T value) {
+        memcpy(code.data() + offset , &value , sizeof(T)) ;
+    }
+    //---------------------------------------------------------------------------
+    size_t copy_and_patch(vector<uint8_t>& code , const Stencil& stencil , const ir::Instruction& instruction , uint32_t destination , int32_t frameSize = 0)
+    /// append stencil with holes patched for instruction , return offset of its division instruction (0 if none)
+    {
+        size_t begin = code.size() ;
+        code.insert(code.end() , stencil.code , stencil.code + stencil.size) ;
+        for(size_t index = 0 ; index < stencil.numHoles ; ++index) {
+            auto [offset , hole] = stencil.holes[index] ;
+            switch (hole) {
+                case Hole::LEFT: patch(code , begin + offset , slot_offset(instruction.left)) ; break ;
+                case Hole::RIGHT: patch(code , begin + offset , slot_offset(instruction.right)) ; break ;
+                case Hole::DESTINATION: patch(code , begin + offset , slot_offset(destination)) ; break ;
+                case Hole::PARAMETER: patch(code , begin + offset , static_cast<int32_t>(8 * instruction.constant)) ; break ;
+                case Hole::FRAME_SIZE: patch(code , begin + offset , frameSize) ; break ;
+                case Hole::IMMEDIATE64:
+                    patch(code , begin + offset , instruction.opcode == Opcode::DIVIDE_CONSTANT ? instruction.magic : instruction.constant) ;
+                    break ;
+                case Hole::IMMEDIATE8:
+                    patch(code , begin + offset , static_cast<uint8_t>(instruction.opcode == Opcode::DIVIDE_CONSTANT ? instruction.auxiliary : instruction.constant)) ;
+                    break ;
+            }
+        }
+        return stencil.division == 0 ? 0 : begin + stencil.division ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+PatchedFunction::~PatchedFunction() {
+    // debuggers must not see code after its block is released
+    registration.reset() ;
+    if(region.has_value())
+        management::DivisionTrap::unregisterCode(region.value()) ;
+    if(heap != nullptr)
+        heap->release(block) ;
+}
+//---------------------------------------------------------------------------
+bool PatchedFunction::isSupported() {
+#if defined(__x86_64__) && defined(__linux__)
+    return management::DivisionTrap::isSupported() && CodeHeap::isSupported() ;
+#else
+    return false ;
+#endif
+}
+//---------------------------------------------------------------------------
+std::unique_ptr<PatchedFunction> PatchedFunction::compile(const ir::Function& function , CodeHeap& heap , CodeHeap::Temperature temperature ,
+                                                          std::string_view symbol) {
+    if(!isSupported())
+        return nullptr ;
+    const std::pmr::vector<ir::Instruction>& instructions = function.getInstructions() ;
+    // one stack slot per value , rsp stays 16 byte aligned
+    int32_t frameSize = static_cast<int32_t>((8 * instructions.size() + 15) / 16 * 16) ;
+    vector<uint8_t> code ;
+    vector<pair<size_t , management::CodeReference>> divisions ;
+    // (offset of first stencil , source line) for each line of instructions
+    CodeRegistry::LineTable lines ;
+    copy_and_patch(code , prologue_stencil , {} , 0 , frameSize) ;
+    for(uint32_t index = 0 ; index < instructions.size() ; ++index) {
+        const ir::Instruction& instruction = instructions[index] ;
+        if(lines.empty() || lines.back().second != function.getLine(index))
+            lines.emplace_back(lines.empty() ? 0 : code.size() , function.getLine(index)) ;
+        switch (instruction.opcode) {
+            case Opcode::PARAMETER: copy_and_patch(code , parameter_stencil , instruction , index) ; break ;
+            case Opcode::CONSTANT: copy_and_patch(code , constant_stencil , instruction , index) ; break ;
+            case Opcode::NEGATE: copy_and_patch(code , negate_stencil , instruction , index) ; break ;
+            case Opcode::ADD: copy_and_patch(code , add_stencil , instruction , index) ; break ;
+            case Opcode::SUBTRACT: copy_and_patch(code , subtract_stencil , instruction , index) ; break ;
+            case Opcode::MULTIPLY: copy_and_patch(code , multiply_stencil , instruction , index) ; break ;
+            case Opcode::DIVIDE:
+                divisions.emplace_back(copy_and_patch(code , divide_stencil , instruction , index) , function.getReference(instruction)) ;
+                break ;
+            case Opcode::DIVIDE_NONZERO:
+                // divisor is never zero , but INT64_MIN / -1 traps as well
+                divisions.emplace_back(copy_and_patch(code , divide_stencil , instruction , index) , management::CodeReference {}) ;
+                break ;
+            case Opcode::SHIFT_LEFT: copy_and_patch(code , shift_left_stencil , instruction , index) ; break ;
+            case Opcode::DIVIDE_CONSTANT:
+                copy_and_patch(code , multiply_high_stencil , instruction , index) ;
+                // correction when magic does not fit into signed 64 bits (see ir::Function::divideConstant())
+                if(instruction.constant > 0 && instruction.magic < 0)
+                    copy_and_patch(code , add_high_stencil , instruction , index) ;
+                else if(instruction.constant < 0 && instruction.magic > 0)
+                    copy_and_patch(code , subtract_high_stencil , instruction , index) ;
+                copy_and_patch(code , shift_round_stencil , instruction , index) ;
+                break ;
+            case Opcode::RETURN: copy_and_patch(code , return_stencil , instruction , index) ; break ;
+            default:
+                // checked arithmetic
+                return nullptr ;
+        }
+    }
+
+    optional<CodeHeap::Block> block = heap.allocate(code.data() , code.size() , temperature) ;
+    if(!block.has_value())
+        return nullptr ;
+    unique_ptr<PatchedFunction> patchedFunction(new PatchedFunction()) ;
+    patchedFunction->heap = &heap ;
+    patchedFunction->block = block.value() ;
+    patchedFunction->codeSize = code.size() ;
+    patchedFunction->region = management::DivisionTrap::registerCode(block->code , code.size() , std::move(divisions)) ;
+    if(!patchedFunction->region.has_value())
+        return nullptr ;
+    if(CodeRegistry::getOutputs() != 0)
+        patchedFunction->registration = CodeRegistry::registerCode(symbol , string(symbol) + ".pl" , block->code , code.size() , lines) ;
+    return patchedFunction ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> PatchedFunction::evaluate(const std::vector<int64_t>& parameterList , management::CodeReference& reference) const {
+    auto entry = reinterpret_cast<management::DivisionTrap::NativeFunction>(block.code) ;
+    return management::DivisionTrap::call(entry , parameterList.data() , reference) ;
+}
+//---------------------------------------------------------------------------
+size_t PatchedFunction::getCodeSize() const {
+    return codeSize ;
+}
+//---------------------------------------------------------------------------
+size_t PatchedFunction::getBlockSize() const {
+    return block.size ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+#ifndef PLJIT_PATCHEDFUNCTION_HPP
+#define PLJIT_PATCHEDFUNCTION_HPP
+//---------------------------------------------------------------------------
+#include "pljit/backend/CodeHeap.hpp"
+#include "pljit/backend/CodeRegistry.hpp"
+#include "pljit/ir/IR.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// machine code of an ir::Function built by copy-and-patch . each instruction is a precompiled x86-64 stencil
+/// which is copied into a block of a CodeHeap and whose holes (frame offsets , immediates) are patched . stencils are
+/// concatenated , so the continuation of each stencil is the next one . values live in stack slots and divisions
+/// by zero trap into management::DivisionTrap , which maps them back to the "/" operator
+class PatchedFunction {
+    // heap which owns block of code
+    CodeHeap* heap = nullptr ;
+    // executable memory of code
+    CodeHeap::Block block ;
+    // number of bytes of code
+    size_t codeSize = 0 ;
+    // region of divisions registered at DivisionTrap
+    std::optional<size_t> region ;
+    // symbol of code published to profilers and debuggers (nullptr if CodeRegistry is disabled)
+    std::unique_ptr<CodeRegistry::Registration> registration ;
+
+    PatchedFunction() = default ;
+
+    public:
+    PatchedFunction(const PatchedFunction&) = delete ;
+    PatchedFunction& operator=(const PatchedFunction&) = delete ;
+    ~PatchedFunction() ;
+
+    /// check if copy-and-patch is supported on this platform (x86-64 Linux)
+    static bool isSupported() ;
+
+    /// copy and patch stencils of all instructions into arena of heap , nullptr if platform or function is not supported
+    /// (checked arithmetic is left to the interpreter of ir::Function) . heap must outlive the patched function .
+    /// code is registered at CodeRegistry as symbol with a line table of the source lines of its instructions
+    static std::unique_ptr<PatchedFunction> compile(const ir::Function& function , CodeHeap& heap ,
+                                                    CodeHeap::Temperature temperature = CodeHeap::Temperature::COLD ,
+                                                    std::string_view symbol = "pljit_function") ;
+
+    /// evaluate function , !has_value() if a division by zero is triggered (its code reference is stored in reference)
+    std::optional<int64_t> evaluate(const std::vector<int64_t>& parameterList , management::CodeReference& reference) const ;
+
+    /// number of bytes of machine code
+    size_t getCodeSize() const ;
+    /// number of bytes of executable memory held by function (size class of its block)
+    size_t getBlockSize() const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_PATCHEDFUNCTION_HPP
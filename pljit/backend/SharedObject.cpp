@@ -0,0 +1,31 @@
+#include "pljit/backend/SharedObject.hpp"
+//---------------------------------------------------------------------------
+#include <dlfcn.h>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+SharedObject::SharedObject(void* handle) : handle(handle) {}
+//---------------------------------------------------------------------------
+std::unique_ptr<SharedObject> SharedObject::load(const std::string& path , std::string& errorMessage) {
+    // symbols stay private to the object , so objects of different functions may use the same symbol names
+    void* handle = dlopen(path.c_str() , RTLD_NOW | RTLD_LOCAL) ;
+    if(handle == nullptr) {
+        const char* error = dlerror() ;
+        errorMessage = error != nullptr ? error : "dlopen failed" ;
+        return nullptr ;
+    }
+    return unique_ptr<SharedObject>(new SharedObject(handle)) ;
+}
+//---------------------------------------------------------------------------
+SharedObject::~SharedObject() {
+    dlclose(handle) ;
+}
+//---------------------------------------------------------------------------
+void* SharedObject::getSymbol(const std::string& symbol) const {
+    return dlsym(handle , symbol.c_str()) ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
@@ -0,0 +1,30 @@
+#ifndef PLJIT_SHAREDOBJECT_HPP
+#define PLJIT_SHAREDOBJECT_HPP
+//---------------------------------------------------------------------------
+#include <memory>
+#include <string>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::backend{
+//---------------------------------------------------------------------------
+/// shared object loaded with dlopen , it is unloaded when the object is destroyed
+class SharedObject {
+    // handle returned by dlopen
+    void* handle ;
+
+    explicit SharedObject(void* handle) ;
+
+    public:
+    /// load shared object from path , nullptr on failure (message of dlerror is stored in errorMessage)
+    static std::unique_ptr<SharedObject> load(const std::string& path , std::string& errorMessage) ;
+
+    SharedObject(const SharedObject&) = delete ;
+    SharedObject& operator=(const SharedObject&) = delete ;
+    ~SharedObject() ;
+
+    /// address of symbol , nullptr if it is not defined
+    void* getSymbol(const std::string& symbol) const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::backend
+//---------------------------------------------------------------------------
+#endif //PLJIT_SHAREDOBJECT_HPP
@@ -0,0 +1,217 @@
+#include "pljit/ir/IR.hpp"
+#include "pljit/ir/LowerASTVisitor.hpp"
+#include "pljit/semantic/AST.hpp"
+//---------------------------------------------------------------------------
+#include <cassert>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::ir{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // number of value operands of each opcode
+    size_t operand_count(Instruction::Opcode opcode) {
+        switch (opcode) {
+            case Instruction::Opcode::PARAMETER:
+            case Instruction::Opcode::CONSTANT: return 0 ;
+            case Instruction::Opcode::NEGATE:
+            case Instruction::Opcode::CHECKED_NEGATE:
+            case Instruction::Opcode::SHIFT_LEFT:
+            case Instruction::Opcode::DIVIDE_CONSTANT:
+            case Instruction::Opcode::RETURN: return 1 ;
+            default: return 2 ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    string_view mnemonic(Instruction::Opcode opcode) {
+        switch (opcode) {
+            case Instruction::Opcode::PARAMETER: return "param" ;
+            case Instruction::Opcode::CONSTANT: return "const" ;
+            case Instruction::Opcode::NEGATE: return "neg" ;
+            case Instruction::Opcode::ADD: return "add" ;
+            case Instruction::Opcode::SUBTRACT: return "sub" ;
+            case Instruction::Opcode::MULTIPLY: return "mul" ;
+            case Instruction::Opcode::DIVIDE: return "div" ;
+            case Instruction::Opcode::DIVIDE_NONZERO: return "divnz" ;
+            case Instruction::Opcode::SHIFT_LEFT: return "shl" ;
+            case Instruction::Opcode::DIVIDE_CONSTANT: return "divc" ;
+            case Instruction::Opcode::CHECKED_NEGATE: return "cneg" ;
+            case Instruction::Opcode::CHECKED_ADD: return "cadd" ;
+            case Instruction::Opcode::CHECKED_SUBTRACT: return "csub" ;
+            case Instruction::Opcode::CHECKED_MULTIPLY: return "cmul" ;
+            case Instruction::Opcode::CHECKED_DIVIDE: return "cdiv" ;
+            case Instruction::Opcode::RETURN: return "ret" ;
+        }
+        return "" ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+Function::Function(const semantic::FunctionAST& functionAst , management::ArithmeticMode arithmeticMode , std::pmr::memory_resource* resource)
+    : instructions(resource) , lines(resource) , references(resource) {
+    LowerASTVisitor lowerASTVisitor(*this , arithmeticMode) ;
+    functionAst.accept(lowerASTVisitor) ;
+    eliminateDeadCode() ;
+}
+//---------------------------------------------------------------------------
+void Function::eliminateDeadCode() {
+    // mark needed instructions backwards , operands are always defined before their uses
+    vector<bool> live(instructions.size() , false) ;
+    for(size_t index = instructions.size() ; index-- > 0 ;) {
+        const Instruction& instruction = instructions[index] ;
+        if(instruction.opcode == Instruction::Opcode::RETURN || mayTrap(instruction.opcode))
+            live[index] = true ;
+        if(!live[index])
+            continue ;
+        size_t count = operand_count(instruction.opcode) ;
+        if(count >= 1)
+            live[instruction.left] = true ;
+        if(count >= 2)
+            live[instruction.right] = true ;
+    }
+    // compact instructions and rename operands
+    vector<uint32_t> renamed(instructions.size() , 0) ;
+    size_t size = 0 ;
+    for(size_t index = 0 ; index < instructions.size() ; ++index) {
+        if(!live[index])
+            continue ;
+        Instruction instruction = instructions[index] ;
+        instruction.left = renamed[instruction.left] ;
+        instruction.right = renamed[instruction.right] ;
+        renamed[index] = static_cast<uint32_t>(size) ;
+        lines[size] = lines[index] ;
+        instructions[size++] = instruction ;
+    }
+    instructions.resize(size) ;
+    lines.resize(size) ;
+}
+//---------------------------------------------------------------------------
+const std::pmr::vector<Instruction>& Function::getInstructions() const {
+    return instructions ;
+}
+//---------------------------------------------------------------------------
+bool Function::mayTrap(Instruction::Opcode opcode) {
+    switch (opcode) {
+        case Instruction::Opcode::DIVIDE:
+        case Instruction::Opcode::CHECKED_NEGATE:
+        case Instruction::Opcode::CHECKED_ADD:
+        case Instruction::Opcode::CHECKED_SUBTRACT:
+        case Instruction::Opcode::CHECKED_MULTIPLY:
+        case Instruction::Opcode::CHECKED_DIVIDE: return true ;
+        default: return false ;
+    }
+}
+//---------------------------------------------------------------------------
+size_t Function::getLine(size_t index) const {
+    return lines[index] ;
+}
+//---------------------------------------------------------------------------
+management::CodeReference Function::getReference(const Instruction& instruction) const {
+    assert(mayTrap(instruction.opcode)) ;
+    return references[instruction.auxiliary] ;
+}
+//---------------------------------------------------------------------------
+size_t Function::num_parameters() const {
+    return numParameters ;
+}
+//---------------------------------------------------------------------------
+management::CodeManager* Function::getManager() const {
+    return codeManager ;
+}
+//---------------------------------------------------------------------------
+int64_t Function::divideConstant(int64_t value , const Instruction& instruction) {
+    assert(instruction.opcode == Instruction::Opcode::DIVIDE_CONSTANT) ;
+    __extension__ using int128 = __int128 ;
+    // high half of product , corrected when magic does not fit into signed 64 bits
+    uint64_t quotient = static_cast<uint64_t>((static_cast<int128>(instruction.magic) * value) >> 64) ;
+    if(instruction.constant > 0 && instruction.magic < 0)
+        quotient += static_cast<uint64_t>(value) ;
+    else if(instruction.constant < 0 && instruction.magic > 0)
+        quotient -= static_cast<uint64_t>(value) ;
+    int64_t result = static_cast<int64_t>(quotient) >> instruction.auxiliary ;
+    // round towards zero
+    return result + static_cast<int64_t>(static_cast<uint64_t>(result) >> 63) ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> Function::evaluate(const std::vector<int64_t>& parameterList) const {
+    assert(parameterList.size() >= numParameters) ;
+    vector<int64_t> values(instructions.size()) ;
+    for(size_t index = 0 ; index < instructions.size() ; ++index) {
+        const Instruction& instruction = instructions[index] ;
+        // arithmetic wraps around in two's complement
+        uint64_t left = static_cast<uint64_t>(values[instruction.left]) ;
+        uint64_t right = static_cast<uint64_t>(values[instruction.right]) ;
+        switch (instruction.opcode) {
+            case Instruction::Opcode::PARAMETER: values[index] = parameterList[instruction.constant] ; break ;
+            case Instruction::Opcode::CONSTANT: values[index] = instruction.constant ; break ;
+            case Instruction::Opcode::NEGATE: values[index] = static_cast<int64_t>(0 - left) ; break ;
+            case Instruction::Opcode::ADD: values[index] = static_cast<int64_t>(left + right) ; break ;
+            case Instruction::Opcode::SUBTRACT: values[index] = static_cast<int64_t>(left - right) ; break ;
+            case Instruction::Opcode::MULTIPLY: values[index] = static_cast<int64_t>(left * right) ; break ;
+            case Instruction::Opcode::DIVIDE: {
+                if(right == 0) {
+                    // trigger runtime error given position of "/" operator
+                    codeManager->printDivZeroError(references[instruction.auxiliary]) ;
+                    return nullopt ;
+                }
+                values[index] = management::wrapping_divide(values[instruction.left] , values[instruction.right]) ;
+            }
+            break ;
+            case Instruction::Opcode::DIVIDE_NONZERO: values[index] = management::wrapping_divide(values[instruction.left] , values[instruction.right]) ; break ;
+            case Instruction::Opcode::SHIFT_LEFT: values[index] = static_cast<int64_t>(left << instruction.constant) ; break ;
+            case Instruction::Opcode::DIVIDE_CONSTANT: values[index] = divideConstant(values[instruction.left] , instruction) ; break ;
+            case Instruction::Opcode::CHECKED_NEGATE:
+            case Instruction::Opcode::CHECKED_ADD:
+            case Instruction::Opcode::CHECKED_SUBTRACT:
+            case Instruction::Opcode::CHECKED_MULTIPLY:
+            case Instruction::Opcode::CHECKED_DIVIDE: {
+                int64_t a = values[instruction.left] , b = values[instruction.right] ;
+                if(instruction.opcode == Instruction::Opcode::CHECKED_DIVIDE && b == 0) {
+                    codeManager->printDivZeroError(references[instruction.auxiliary]) ;
+                    return nullopt ;
+                }
+                optional<int64_t> result ;
+                switch (instruction.opcode) {
+                    case Instruction::Opcode::CHECKED_NEGATE: result = management::checked_negate(a) ; break ;
+                    case Instruction::Opcode::CHECKED_ADD: result = management::checked_add(a , b) ; break ;
+                    case Instruction::Opcode::CHECKED_SUBTRACT: result = management::checked_subtract(a , b) ; break ;
+                    case Instruction::Opcode::CHECKED_MULTIPLY: result = management::checked_multiply(a , b) ; break ;
+                    default: result = management::checked_divide(a , b) ; break ;
+                }
+                if(!result.has_value()) {
+                    // trigger runtime error given position of operator
+                    codeManager->printOverflowError(references[instruction.auxiliary]) ;
+                    return nullopt ;
+                }
+                values[index] = result.value() ;
+            }
+            break ;
+            case Instruction::Opcode::RETURN: return values[instruction.left] ;
+        }
+    }
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+std::string Function::print() const {
+    string output ;
+    for(size_t index = 0 ; index < instructions.size() ; ++index) {
+        const Instruction& instruction = instructions[index] ;
+        if(instruction.opcode != Instruction::Opcode::RETURN)
+            output += "%" + to_string(index) + " = " ;
+        output += mnemonic(instruction.opcode) ;
+        size_t count = operand_count(instruction.opcode) ;
+        if(count >= 1)
+            output += " %" + to_string(instruction.left) ;
+        if(count >= 2)
+            output += " %" + to_string(instruction.right) ;
+        if(count == 0 || instruction.opcode == Instruction::Opcode::SHIFT_LEFT || instruction.opcode == Instruction::Opcode::DIVIDE_CONSTANT)
+            output += " " + to_string(instruction.constant) ;
+        output += '\n' ;
+    }
+    return output ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::ir
+//---------------------------------------------------------------------------
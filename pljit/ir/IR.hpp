@@ -0,0 +1,107 @@
+#ifndef PLJIT_IR_HPP
+#define PLJIT_IR_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/CodeManager.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+class FunctionAST ;
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+namespace jitcompiler ::ir{
+//---------------------------------------------------------------------------
+/// instruction of linear SSA form , the i-th instruction of a function defines value %i .
+/// operands always refer to values defined by earlier instructions . arithmetic wraps around in two's complement
+/// (INT64_MIN / -1 == INT64_MIN) unless the opcode is checked
+struct Instruction {
+    enum class Opcode : uint8_t {
+        PARAMETER ,         // %i = parameter at index constant
+        CONSTANT ,          // %i = constant
+        NEGATE ,            // %i = -%left
+        ADD ,               // %i = %left + %right
+        SUBTRACT ,          // %i = %left - %right
+        MULTIPLY ,          // %i = %left * %right
+        DIVIDE ,            // %i = %left / %right , runtime error at reference auxiliary if %right == 0
+        DIVIDE_NONZERO ,    // %i = %left / %right , %right is non zero since an earlier DIVIDE by it succeeded
+        SHIFT_LEFT ,        // %i = %left << constant (multiplication by power of two)
+        DIVIDE_CONSTANT ,   // %i = %left / constant (|constant| >= 2) , multiply-high by magic and shift right by auxiliary
+        CHECKED_NEGATE ,    // NEGATE , runtime error at reference auxiliary on overflow (checked arithmetic)
+        CHECKED_ADD ,       // ADD , runtime error at reference auxiliary on overflow (checked arithmetic)
+        CHECKED_SUBTRACT ,  // SUBTRACT , runtime error at reference auxiliary on overflow (checked arithmetic)
+        CHECKED_MULTIPLY ,  // MULTIPLY , runtime error at reference auxiliary on overflow (checked arithmetic)
+        CHECKED_DIVIDE ,    // DIVIDE , runtime error at reference auxiliary if %right == 0 or on overflow (checked arithmetic)
+        RETURN              // return %left
+    };
+    Opcode opcode ;
+    // operand values
+    uint32_t left = 0 ;
+    uint32_t right = 0 ;
+    // index of code reference (DIVIDE , CHECKED_*) or shift amount (DIVIDE_CONSTANT)
+    uint32_t auxiliary = 0 ;
+    // immediate value (PARAMETER , CONSTANT , SHIFT_LEFT , DIVIDE_CONSTANT)
+    int64_t constant = 0 ;
+    // magic multiplier (DIVIDE_CONSTANT)
+    int64_t magic = 0 ;
+};
+//---------------------------------------------------------------------------
+class Function {
+    // instructions in evaluation order , last instruction is RETURN
+    std::pmr::vector<Instruction> instructions ;
+    // source line (0-based) of the statement which emitted each instruction
+    std::pmr::vector<uint32_t> lines ;
+    // code references of "/" operators which may trigger a runtime error
+    std::pmr::vector<management::CodeReference> references ;
+    size_t numParameters = 0 ;
+    // code manager of source code , used to print runtime errors
+    management::CodeManager* codeManager = nullptr ;
+
+    friend class LowerASTVisitor ;
+
+    /// remove instructions whose value is not needed by RETURN , instructions which may trap are kept
+    void eliminateDeadCode() ;
+
+    public:
+    /// lower (optimized) function , variables and parameters are renamed on each assignment .
+    /// in checked arithmetic , operators use checked opcodes unless their operand ranges prove that they cannot overflow .
+    /// instructions are allocated from resource
+    explicit Function(const semantic::FunctionAST& functionAst ,
+                      management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND ,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
+
+    /// check if instruction may trigger a runtime error
+    static bool mayTrap(Instruction::Opcode opcode) ;
+
+    /// get instructions in evaluation order
+    const std::pmr::vector<Instruction>& getInstructions() const ;
+
+    /// get source line (0-based) of instruction at index , used for debug line tables
+    size_t getLine(size_t index) const ;
+
+    /// get code reference of instruction which may trap
+    management::CodeReference getReference(const Instruction& instruction) const ;
+
+    /// number of parameters expected by evaluate()
+    size_t num_parameters() const ;
+
+    /// return pointer for code manager
+    management::CodeManager* getManager() const ;
+
+    /// evaluate function , !has_value() if runtime error is triggered (evaluation stops at first runtime error)
+    std::optional<int64_t> evaluate(const std::vector<int64_t>& parameterList) const ;
+
+    /// print instructions one per line (used for testing)
+    std::string print() const ;
+
+    /// quotient of value and constant divisor as computed by DIVIDE_CONSTANT
+    static int64_t divideConstant(int64_t value , const Instruction& instruction) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::ir
+//---------------------------------------------------------------------------
+#endif //PLJIT_IR_HPP
@@ -0,0 +1,344 @@
+#include "pljit/ir/LowerASTVisitor.hpp"
+#include "pljit/semantic/AST.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::ir{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    pair<int64_t , uint32_t> signed_magic(int64_t divisor)
+    /// magic multiplier and shift for signed division by constant (|divisor| >= 2) , see Hacker's Delight 10-1
+    {
+        constexpr uint64_t two63 = uint64_t(1) << 63 ;
+        uint64_t absoluteDivisor = divisor < 0 ? uint64_t(0) - static_cast<uint64_t>(divisor) : static_cast<uint64_t>(divisor) ;
+        uint64_t t = two63 + (static_cast<uint64_t>(divisor) >> 63) ;
+        // absolute value of nc
+        uint64_t anc = t - 1 - t % absoluteDivisor ;
+        uint32_t p = 63 ;
+        uint64_t q1 = two63 / anc , r1 = two63 - q1 * anc ;
+        uint64_t q2 = two63 / absoluteDivisor , r2 = two63 - q2 * absoluteDivisor ;
+        uint64_t delta ;
+        do {
+            ++p ;
+            q1 *= 2 ; r1 *= 2 ;
+            if(r1 >= anc) { ++q1 ; r1 -= anc ; }
+            q2 *= 2 ; r2 *= 2 ;
+            if(r2 >= absoluteDivisor) { ++q2 ; r2 -= absoluteDivisor ; }
+            delta = absoluteDivisor - r2 ;
+        } while(q1 < delta || (q1 == delta && r1 == 0)) ;
+        uint64_t magic = q2 + 1 ;
+        if(divisor < 0)
+            magic = uint64_t(0) - magic ;
+        return {static_cast<int64_t>(magic) , p - 64} ;
+    }
+    //---------------------------------------------------------------------------
+    __extension__ using int128 = __int128 ;
+    // inclusive bounds of a value
+    using Range = pair<int128 , int128> ;
+    //---------------------------------------------------------------------------
+    Range result_range(const Instruction& instruction , const vector<pair<int64_t , int64_t>>& ranges)
+    /// bounds of the exact (not wrapped around) result of instruction given the ranges of its operands
+    {
+        using Opcode = Instruction::Opcode ;
+        constexpr int128 minimum = numeric_limits<int64_t>::min() , maximum = numeric_limits<int64_t>::max() ;
+        switch (instruction.opcode) {
+            case Opcode::PARAMETER: return {minimum , maximum} ;
+            case Opcode::CONSTANT: return {instruction.constant , instruction.constant} ;
+            case Opcode::RETURN: return {minimum , maximum} ;
+            default: break ;
+        }
+        int128 a = ranges[instruction.left].first , b = ranges[instruction.left].second ;
+        switch (instruction.opcode) {
+            case Opcode::NEGATE:
+            case Opcode::CHECKED_NEGATE: return {-b , -a} ;
+            case Opcode::SHIFT_LEFT: {
+                int128 factor = int128(1) << instruction.constant ;
+                return {a * factor , b * factor} ;
+            }
+            case Opcode::DIVIDE_CONSTANT: {
+                // quotient is monotonic in dividend
+                int128 first = a / instruction.constant , second = b / instruction.constant ;
+                return {min(first , second) , max(first , second)} ;
+            }
+            default: break ;
+        }
+        int128 c = ranges[instruction.right].first , d = ranges[instruction.right].second ;
+        switch (instruction.opcode) {
+            case Opcode::ADD:
+            case Opcode::CHECKED_ADD: return {a + c , b + d} ;
+            case Opcode::SUBTRACT:
+            case Opcode::CHECKED_SUBTRACT: return {a - d , b - c} ;
+            case Opcode::MULTIPLY:
+            case Opcode::CHECKED_MULTIPLY: {
+                int128 products[] = {a * c , a * d , b * c , b * d} ;
+                return {*min_element(begin(products) , end(products)) , *max_element(begin(products) , end(products))} ;
+            }
+            default: {
+                // |left / right| <= |left| for any non zero divisor
+                int128 bound = max(a < 0 ? -a : a , b < 0 ? -b : b) ;
+                return {-bound , bound} ;
+            }
+        }
+    }
+    //---------------------------------------------------------------------------
+    bool fits(const Range& range) {
+        return range.first >= numeric_limits<int64_t>::min() && range.second <= numeric_limits<int64_t>::max() ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+size_t LowerASTVisitor::KeyHash::operator()(const std::tuple<uint8_t , uint32_t , uint32_t , int64_t>& key) const {
+    size_t hash = get<0>(key) ;
+    hash = hash * 31 + get<1>(key) ;
+    hash = hash * 31 + get<2>(key) ;
+    return hash * 31 + std::hash<int64_t>()(get<3>(key)) ;
+}
+//---------------------------------------------------------------------------
+LowerASTVisitor::LowerASTVisitor(Function& function , management::ArithmeticMode arithmeticMode) : function(function) , arithmeticMode(arithmeticMode) {}
+//---------------------------------------------------------------------------
+uint32_t LowerASTVisitor::emit(Instruction instruction , management::CodeReference reference) {
+    auto key = make_tuple(static_cast<uint8_t>(instruction.opcode) , instruction.left , instruction.right , instruction.constant) ;
+    auto it = emitted.find(key) ;
+    if(it != emitted.end())
+        // value is already computed , a repeated division cannot trap after the first one succeeded
+        return it->second ;
+    if(Function::mayTrap(instruction.opcode)) {
+        instruction.auxiliary = static_cast<uint32_t>(function.references.size()) ;
+        function.references.push_back(reference) ;
+    }
+    Range range = result_range(instruction , ranges) ;
+    if(!fits(range)) {
+        // checked result is exact , otherwise it may wrap around to any value
+        constexpr int128 minimum = numeric_limits<int64_t>::min() , maximum = numeric_limits<int64_t>::max() ;
+        if(Function::mayTrap(instruction.opcode))
+            range = {max(range.first , minimum) , min(range.second , maximum)} ;
+        else
+            range = {minimum , maximum} ;
+    }
+    ranges.emplace_back(static_cast<int64_t>(range.first) , static_cast<int64_t>(range.second)) ;
+    uint32_t value = static_cast<uint32_t>(function.instructions.size()) ;
+    function.instructions.push_back(instruction) ;
+    function.lines.push_back(line) ;
+    emitted.emplace(key , value) ;
+    return value ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::advanceLine(const management::CodeReference& reference) {
+    // nodes generated by the optimizer have no reference in source code (line 0)
+    line = max(line , static_cast<uint32_t>(reference.getStartLineRange().first)) ;
+}
+//---------------------------------------------------------------------------
+uint32_t LowerASTVisitor::emitConstant(int64_t value) {
+    Instruction instruction{Instruction::Opcode::CONSTANT} ;
+    instruction.constant = value ;
+    return emit(instruction) ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> LowerASTVisitor::getConstant(uint32_t value) const {
+    const Instruction& instruction = function.instructions[value] ;
+    if(instruction.opcode != Instruction::Opcode::CONSTANT)
+        return nullopt ;
+    return instruction.constant ;
+}
+//---------------------------------------------------------------------------
+uint32_t LowerASTVisitor::emitBinary(Instruction::Opcode opcode , uint32_t left , uint32_t right , management::CodeReference reference) {
+    using Opcode = Instruction::Opcode ;
+    bool checked = arithmeticMode == management::ArithmeticMode::CHECKED ;
+    optional<int64_t> leftConstant = getConstant(left) ;
+    optional<int64_t> rightConstant = getConstant(right) ;
+
+    if(leftConstant.has_value() && rightConstant.has_value()) {
+        // fold constants , division by zero and overflow in checked arithmetic must trigger their runtime error when evaluated
+        int64_t a = leftConstant.value() , b = rightConstant.value() ;
+        optional<int64_t> value ;
+        switch (opcode) {
+            case Opcode::ADD: value = checked ? management::checked_add(a , b) : management::wrapping_add(a , b) ; break ;
+            case Opcode::SUBTRACT: value = checked ? management::checked_subtract(a , b) : management::wrapping_subtract(a , b) ; break ;
+            case Opcode::MULTIPLY: value = checked ? management::checked_multiply(a , b) : management::wrapping_multiply(a , b) ; break ;
+            case Opcode::DIVIDE: {
+                if(b != 0)
+                    value = checked ? management::checked_divide(a , b) : management::wrapping_divide(a , b) ;
+            }
+            break ;
+            default: break ;
+        }
+        if(value.has_value())
+            return emitConstant(value.value()) ;
+    }
+    if((opcode == Opcode::ADD || opcode == Opcode::MULTIPLY) && leftConstant.has_value() && !rightConstant.has_value()) {
+        // commutative operation , keep constant operand on the right side
+        swap(left , right) ;
+        swap(leftConstant , rightConstant) ;
+    }
+    if(rightConstant.has_value()) {
+        int64_t constant = rightConstant.value() ;
+        switch (opcode) {
+            case Opcode::ADD:
+            case Opcode::SUBTRACT: {
+                if(constant == 0)
+                    return left ;
+            }
+            break ;
+            case Opcode::MULTIPLY: {
+                if(constant == 0)
+                    return emitConstant(0) ;
+                if(constant == 1)
+                    return left ;
+                if(constant == -1)
+                    return emitNegate(left , reference) ;
+                if(constant > 0 && has_single_bit(static_cast<uint64_t>(constant))) {
+                    Instruction instruction{Opcode::SHIFT_LEFT , left} ;
+                    instruction.constant = countr_zero(static_cast<uint64_t>(constant)) ;
+                    // a shift cannot report overflow
+                    if(!checked || cannotOverflow(instruction))
+                        return emit(instruction) ;
+                }
+            }
+            break ;
+            case Opcode::DIVIDE: {
+                if(constant == 1)
+                    return left ;
+                if(constant == -1)
+                    return emitNegate(left , reference) ;
+                if(constant != 0) {
+                    // replace division by multiply-high , divisor is known to be non zero and |quotient| < |dividend|
+                    auto [magic , shift] = signed_magic(constant) ;
+                    Instruction instruction{Opcode::DIVIDE_CONSTANT , left} ;
+                    instruction.auxiliary = shift ;
+                    instruction.constant = constant ;
+                    instruction.magic = magic ;
+                    return emit(instruction) ;
+                }
+            }
+            break ;
+            default: break ;
+        }
+    }
+    if(opcode == Opcode::DIVIDE) {
+        const pair<int64_t , int64_t>& divisor = ranges[right] ;
+        // evaluation stops at first runtime error , so a division is only reached if earlier divisions succeeded
+        bool mayBeZero = divisor.first <= 0 && divisor.second >= 0 && !nonzeroValues.contains(right) ;
+        bool mayOverflow = checked && ranges[left].first == numeric_limits<int64_t>::min() && divisor.first <= -1 && divisor.second >= -1 ;
+        if(!mayBeZero && !mayOverflow)
+            return emit({Opcode::DIVIDE_NONZERO , left , right}) ;
+        nonzeroValues.insert(right) ;
+        return emit({mayOverflow ? Opcode::CHECKED_DIVIDE : Opcode::DIVIDE , left , right} , reference) ;
+    }
+    Instruction instruction{opcode , left , right} ;
+    if(checked && !cannotOverflow(instruction)) {
+        switch (opcode) {
+            case Opcode::ADD: instruction.opcode = Opcode::CHECKED_ADD ; break ;
+            case Opcode::SUBTRACT: instruction.opcode = Opcode::CHECKED_SUBTRACT ; break ;
+            case Opcode::MULTIPLY: instruction.opcode = Opcode::CHECKED_MULTIPLY ; break ;
+            default: break ;
+        }
+    }
+    return emit(instruction , reference) ;
+}
+//---------------------------------------------------------------------------
+uint32_t LowerASTVisitor::emitNegate(uint32_t value , management::CodeReference reference) {
+    using Opcode = Instruction::Opcode ;
+    bool checked = arithmeticMode == management::ArithmeticMode::CHECKED ;
+    const Instruction& input = function.instructions[value] ;
+    if(input.opcode == Opcode::CONSTANT) {
+        int64_t constant = input.constant ;
+        optional<int64_t> negated = checked ? management::checked_negate(constant) : management::wrapping_negate(constant) ;
+        if(negated.has_value())
+            return emitConstant(negated.value()) ;
+    }
+    else if(input.opcode == Opcode::NEGATE || input.opcode == Opcode::CHECKED_NEGATE)
+        // --x == x , a checked inner negation is kept to trigger its runtime error
+        return input.left ;
+    Instruction instruction{Opcode::NEGATE , value} ;
+    if(checked && !cannotOverflow(instruction))
+        instruction.opcode = Opcode::CHECKED_NEGATE ;
+    return emit(instruction , reference) ;
+}
+//---------------------------------------------------------------------------
+bool LowerASTVisitor::cannotOverflow(const Instruction& instruction) const {
+    return fits(result_range(instruction , ranges)) ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::FunctionAST& functionAst) {
+    symbolTable = &functionAst.getSymbolTable() ;
+    function.numParameters = symbolTable->num_parameters() ;
+    function.codeManager = functionAst.getManager() ;
+    returnTriggered = false ;
+    for(size_t index = 0 ; index < functionAst.num_statements() && !returnTriggered ; ++index)
+        functionAst.getStatement(index).accept(*this) ;
+    assert(returnTriggered) ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::ReturnStatementAST& returnStatementAst) {
+    returnStatementAst.getInput().accept(*this) ;
+    Instruction instruction{Instruction::Opcode::RETURN , result} ;
+    function.instructions.push_back(instruction) ;
+    function.lines.push_back(line) ;
+    returnTriggered = true ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::AssignmentStatementAST& assignmentStatementAst) {
+    assignmentStatementAst.getRightExpression().accept(*this) ;
+    // renaming : later uses of identifier refer to value of expression
+    definitions[assignmentStatementAst.getLeftIdentifier().print_token()] = result ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::BinaryExpressionAST& binaryExpressionAst) {
+    advanceLine(binaryExpressionAst.getReference()) ;
+    binaryExpressionAst.getLeftExpression().accept(*this) ;
+    uint32_t left = result ;
+    binaryExpressionAst.getRightExpression().accept(*this) ;
+    uint32_t right = result ;
+    // code reference of operator is needed to print divide by zero and overflow errors
+    management::CodeReference reference = binaryExpressionAst.getReference() ;
+    switch (binaryExpressionAst.getBinaryType()) {
+        case semantic::BinaryExpressionAST::BinaryType::PLUS: result = emitBinary(Instruction::Opcode::ADD , left , right , reference) ; break ;
+        case semantic::BinaryExpressionAST::BinaryType::MINUS: result = emitBinary(Instruction::Opcode::SUBTRACT , left , right , reference) ; break ;
+        case semantic::BinaryExpressionAST::BinaryType::MULTIPLY: result = emitBinary(Instruction::Opcode::MULTIPLY , left , right , reference) ; break ;
+        case semantic::BinaryExpressionAST::BinaryType::DIVIDE: result = emitBinary(Instruction::Opcode::DIVIDE , left , right , reference) ; break ;
+    }
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::UnaryExpressionAST& unaryExpressionAst) {
+    advanceLine(unaryExpressionAst.getReference()) ;
+    unaryExpressionAst.getInput().accept(*this) ;
+    // unary plus has no effect on evaluation
+    if(unaryExpressionAst.getUnaryType() != semantic::UnaryExpressionAST::UnaryType::MINUS)
+        return ;
+    // code reference of "-" is needed to print overflow error
+    result = emitNegate(result , unaryExpressionAst.getReference()) ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::IdentifierAST& identifierAst) {
+    advanceLine(identifierAst.getReference()) ;
+    auto it = definitions.find(identifierAst.print_token()) ;
+    if(it != definitions.end()) {
+        result = it->second ;
+        return ;
+    }
+    // variables are always assigned before they are used , remaining identifiers are parameters or constants
+    optional<size_t> slot = symbolTable->getSlot(identifierAst.print_token()) ;
+    assert(slot.has_value()) ;
+    if(slot.value() < symbolTable->num_parameters()) {
+        Instruction instruction{Instruction::Opcode::PARAMETER} ;
+        instruction.constant = static_cast<int64_t>(slot.value()) ;
+        result = emit(instruction) ;
+    }
+    else
+        result = emitConstant(symbolTable->getConstantValue(slot.value())) ;
+}
+//---------------------------------------------------------------------------
+void LowerASTVisitor::visit(const semantic::LiteralAST& literalAst) {
+    advanceLine(literalAst.getReference()) ;
+    result = emitConstant(literalAst.getValue()) ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::ir
+//---------------------------------------------------------------------------
@@ -0,0 +1,86 @@
+#ifndef PLJIT_LOWERASTVISITOR_HPP
+#define PLJIT_LOWERASTVISITOR_HPP
+//---------------------------------------------------------------------------
+#include "pljit/ir/IR.hpp"
+#include "pljit/semantic/ASTVisitor.hpp"
+//---------------------------------------------------------------------------
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+class SymbolTable ;
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+namespace jitcompiler ::ir{
+//---------------------------------------------------------------------------
+/// lower FunctionAST into SSA form , each assignment renames its identifier to the value of its expression.
+/// identical instructions are emitted once , operations with constant operands are folded and
+/// strength reduced (multiplication by power of two , division by constant) .
+/// the range of each value is tracked , checks of operators which provably cannot overflow or divide by zero are omitted
+class LowerASTVisitor final : public semantic::ASTVisitor {
+    struct KeyHash {
+        size_t operator()(const std::tuple<uint8_t , uint32_t , uint32_t , int64_t>& key) const ;
+    };
+
+    // lowered function
+    Function& function ;
+    // semantics of overflowing operators
+    management::ArithmeticMode arithmeticMode ;
+    // symbol table of visited function to map identifiers to parameters and constants
+    const semantic::SymbolTable* symbolTable = nullptr ;
+    // current value of each assigned identifier
+    std::unordered_map<std::string_view , uint32_t> definitions ;
+    // value of each emitted instruction given (opcode , left , right , constant)
+    std::unordered_map<std::tuple<uint8_t , uint32_t , uint32_t , int64_t> , uint32_t , KeyHash> emitted ;
+    // values which are divisors of an emitted DIVIDE , all later divisions by them cannot trap
+    std::unordered_set<uint32_t> nonzeroValues ;
+    // (lower bound , upper bound) of each emitted value
+    std::vector<std::pair<int64_t , int64_t>> ranges ;
+    // value of last visited expression
+    uint32_t result = 0 ;
+    // source line of instructions emitted next , latest line of a lowered token (lines of statements only grow)
+    uint32_t line = 0 ;
+    // stop lowering after first return statement (remaining statements are dead code)
+    bool returnTriggered = false ;
+
+    /// append instruction unless an identical instruction is already emitted , return its value .
+    /// reference is the code reference of the operator for instructions which may trap
+    uint32_t emit(Instruction instruction , management::CodeReference reference = {}) ;
+    /// advance source line of emitted instructions to line of reference
+    void advanceLine(const management::CodeReference& reference) ;
+    /// emit constant value
+    uint32_t emitConstant(int64_t value) ;
+    /// check if value is defined by CONSTANT instruction
+    std::optional<int64_t> getConstant(uint32_t value) const ;
+    /// emit binary operation , folding and strength reducing constant operands
+    uint32_t emitBinary(Instruction::Opcode opcode , uint32_t left , uint32_t right , management::CodeReference reference) ;
+    /// emit negation , folding constants and double negation
+    uint32_t emitNegate(uint32_t value , management::CodeReference reference) ;
+    /// check if result of instruction provably fits into int64_t given the ranges of its operands
+    bool cannotOverflow(const Instruction& instruction) const ;
+
+    public:
+    LowerASTVisitor(Function& function , management::ArithmeticMode arithmeticMode) ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::FunctionAST& functionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::ReturnStatementAST& returnStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::AssignmentStatementAST& assignmentStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::BinaryExpressionAST& binaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::UnaryExpressionAST& unaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::IdentifierAST& identifierAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const semantic::LiteralAST& literalAst) override ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::ir
+//---------------------------------------------------------------------------
+#endif //PLJIT_LOWERASTVISITOR_HPP
@@ -1,5 +1,9 @@
 #include "pljit/Pljit.hpp"
+#include "pljit/StaticPljit.hpp"
+#include "pljit/backend/ObjectCompiler.hpp"
+#include <fstream>
 #include <iostream>
+#include <sstream>
 //---------------------------------------------------------------------------
 using namespace std;
 using namespace jitcompiler ;
@@ -7,7 +11,75 @@ using namespace jitcompiler::management ;
 using namespace jitcompiler::syntax ;
 using namespace jitcompiler::semantic ;
 //---------------------------------------------------------------------------
-int main() {
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    int compile_object(int argc , char** argv)
+    /// offline mode : pljit [--checked] -o output.o [-H header.h] [symbol=]source.pl ...
+    /// each source file defines one function , its symbol defaults to the file name without extension
+    {
+        ArithmeticMode mode = ArithmeticMode::WRAPAROUND ;
+        string objectPath , headerPath ;
+        vector<pair<string , string>> sources ;
+        for(int index = 1 ; index < argc ; ++index) {
+            string_view argument = argv[index] ;
+            if(argument == "--checked")
+                mode = ArithmeticMode::CHECKED ;
+            else if((argument == "-o" || argument == "-H") && index + 1 < argc)
+                (argument == "-o" ? objectPath : headerPath) = argv[++index] ;
+            else {
+                size_t separator = argument.find('=') ;
+                string path(separator == string_view::npos ? argument : argument.substr(separator + 1)) ;
+                string symbol ;
+                if(separator != string_view::npos)
+                    symbol = argument.substr(0 , separator) ;
+                else {
+                    size_t begin = path.find_last_of('/') ;
+                    symbol = path.substr(begin == string::npos ? 0 : begin + 1) ;
+                    symbol = symbol.substr(0 , symbol.find('.')) ;
+                }
+                sources.emplace_back(symbol , path) ;
+            }
+        }
+        if(objectPath.empty() || sources.empty()) {
+            cerr << "usage: " << argv[0] << " [--checked] -o output.o [-H header.h] [symbol=]source.pl ...\n" ;
+            return 2 ;
+        }
+
+        backend::ObjectCompiler objectCompiler ;
+        for(auto &[symbol , path] : sources) {
+            ifstream file(path) ;
+            if(!file) {
+                cerr << path << ": cannot open file\n" ;
+                return 1 ;
+            }
+            ostringstream code ;
+            code << file.rdbuf() ;
+            if(optional<string> error = objectCompiler.addFunction(symbol , code.str() , mode)) {
+                cerr << path << ":\n" << error.value() ;
+                return 1 ;
+            }
+        }
+        if(optional<string> error = objectCompiler.writeObject(objectPath)) {
+            cerr << error.value() ;
+            return 1 ;
+        }
+        if(!headerPath.empty()) {
+            ofstream header(headerPath) ;
+            header << objectCompiler.getHeader() ;
+            if(!header) {
+                cerr << headerPath << ": cannot write file\n" ;
+                return 1 ;
+            }
+        }
+        return 0 ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+int main(int argc , char** argv) {
+    if(argc > 1)
+        return compile_object(argc , argv) ;
     string code = "PARAM width, height, depth;\n"
                   "VAR volume;\n"
                   "CONST density = 2400;\n"
@@ -41,6 +113,18 @@ int main() {
     assert(res.has_value()) ;
     cout << res.value() << "\n\n" ;
 
+    // same function compiled while compiling this program
+    constexpr auto staticFunction = compile<"PARAM width, height, depth;\n"
+                                            "VAR volume;\n"
+                                            "CONST density = 2400;\n"
+                                            "BEGIN\n"
+                                            "volume := width * height * depth;\n"
+                                            "RETURN density * volume\n"
+                                            "END.">() ;
+    static_assert(staticFunction(1 , 2 , 3).first == 14400) ;
+    cout << "---------Static Result ---------\n";
+    cout << staticFunction(1 , 2 , 3).first.value() << "\n\n" ;
+
     return 0 ;
 }
 //---------------------------------------------------------------------------
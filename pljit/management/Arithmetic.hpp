@@ -0,0 +1,71 @@
+#ifndef PLJIT_ARITHMETIC_HPP
+#define PLJIT_ARITHMETIC_HPP
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <limits>
+#include <optional>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// semantics of signed overflow (including INT64_MIN / -1)
+enum class ArithmeticMode : uint8_t {
+    // results wrap around in two's complement
+    WRAPAROUND ,
+    // overflow triggers a runtime error at the operator
+    CHECKED
+};
+//---------------------------------------------------------------------------
+// wraparound arithmetic , computed in unsigned arithmetic to avoid undefined behaviour
+constexpr int64_t wrapping_add(int64_t left , int64_t right) {
+    return static_cast<int64_t>(static_cast<uint64_t>(left) + static_cast<uint64_t>(right)) ;
+}
+constexpr int64_t wrapping_subtract(int64_t left , int64_t right) {
+    return static_cast<int64_t>(static_cast<uint64_t>(left) - static_cast<uint64_t>(right)) ;
+}
+constexpr int64_t wrapping_multiply(int64_t left , int64_t right) {
+    return static_cast<int64_t>(static_cast<uint64_t>(left) * static_cast<uint64_t>(right)) ;
+}
+constexpr int64_t wrapping_negate(int64_t value) {
+    return static_cast<int64_t>(uint64_t(0) - static_cast<uint64_t>(value)) ;
+}
+/// divisor must be non zero , INT64_MIN / -1 wraps around to INT64_MIN
+constexpr int64_t wrapping_divide(int64_t left , int64_t right) {
+    return right == -1 ? wrapping_negate(left) : left / right ;
+}
+//---------------------------------------------------------------------------
+// checked arithmetic , nullopt on overflow . the overflow flag of the operation is tested , so the
+// non-overflow path costs a single predictable branch
+constexpr std::optional<int64_t> checked_add(int64_t left , int64_t right) {
+    int64_t result ;
+    if(__builtin_add_overflow(left , right , &result))
+        return std::nullopt ;
+    return result ;
+}
+constexpr std::optional<int64_t> checked_subtract(int64_t left , int64_t right) {
+    int64_t result ;
+    if(__builtin_sub_overflow(left , right , &result))
+        return std::nullopt ;
+    return result ;
+}
+constexpr std::optional<int64_t> checked_multiply(int64_t left , int64_t right) {
+    int64_t result ;
+    if(__builtin_mul_overflow(left , right , &result))
+        return std::nullopt ;
+    return result ;
+}
+constexpr std::optional<int64_t> checked_negate(int64_t value) {
+    int64_t result ;
+    if(__builtin_sub_overflow(int64_t(0) , value , &result))
+        return std::nullopt ;
+    return result ;
+}
+/// divisor must be non zero
+constexpr std::optional<int64_t> checked_divide(int64_t left , int64_t right) {
+    if(left == std::numeric_limits<int64_t>::min() && right == -1)
+        return std::nullopt ;
+    return left / right ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_ARITHMETIC_HPP
@@ -0,0 +1,112 @@
+#include "pljit/management/CallTelemetry.hpp"
+//---------------------------------------------------------------------------
+#include <bit>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // shard of next thread which records a call
+    atomic<size_t> nextShard = 0 ;
+    //---------------------------------------------------------------------------
+    size_t thread_shard()
+    /// shard of current thread , assigned on first call
+    {
+        thread_local size_t shard = nextShard.fetch_add(1 , memory_order_relaxed) % CallTelemetry::SHARDS ;
+        return shard ;
+    }
+    //---------------------------------------------------------------------------
+    string seconds(uint64_t nanoseconds) {
+        char text[32] ;
+        snprintf(text , sizeof(text) , "%.9g" , static_cast<double>(nanoseconds) / 1e9) ;
+        return text ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+size_t CallTelemetry::bucket(uint64_t nanoseconds) {
+    constexpr uint64_t subBuckets = uint64_t(1) << SUB_BUCKET_BITS ;
+    if(nanoseconds < subBuckets)
+        return nanoseconds ;
+    size_t exponent = static_cast<size_t>(bit_width(nanoseconds)) - 1 ;
+    if(exponent > MAX_EXPONENT)
+        return NUM_BUCKETS - 1 ;
+    size_t subBucket = (nanoseconds >> (exponent - SUB_BUCKET_BITS)) & (subBuckets - 1) ;
+    return ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + subBucket ;
+}
+//---------------------------------------------------------------------------
+uint64_t CallTelemetry::upperBound(size_t bucket) {
+    constexpr uint64_t subBuckets = uint64_t(1) << SUB_BUCKET_BITS ;
+    if(bucket >= NUM_BUCKETS - 1)
+        return numeric_limits<uint64_t>::max() ;
+    if(bucket < subBuckets)
+        return bucket + 1 ;
+    size_t exponent = (bucket >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1 ;
+    uint64_t subBucket = bucket & (subBuckets - 1) ;
+    return (subBuckets + subBucket + 1) << (exponent - SUB_BUCKET_BITS) ;
+}
+//---------------------------------------------------------------------------
+void CallTelemetry::record(std::chrono::steady_clock::time_point start , bool isError) {
+    auto latency = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start) ;
+    record(static_cast<uint64_t>(latency.count()) , isError) ;
+}
+//---------------------------------------------------------------------------
+void CallTelemetry::record(uint64_t nanoseconds , bool isError) {
+    // counters are only read by snapshot() , no ordering is needed
+    Shard& shard = shards[thread_shard()] ;
+    shard.calls.fetch_add(1 , memory_order_relaxed) ;
+    if(isError)
+        shard.errors.fetch_add(1 , memory_order_relaxed) ;
+    shard.totalNanoseconds.fetch_add(nanoseconds , memory_order_relaxed) ;
+    shard.buckets[bucket(nanoseconds)].fetch_add(1 , memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+CallTelemetry::Snapshot CallTelemetry::snapshot() const {
+    Snapshot snapshot ;
+    for(const Shard& shard : shards) {
+        snapshot.calls += shard.calls.load(memory_order_relaxed) ;
+        snapshot.errors += shard.errors.load(memory_order_relaxed) ;
+        snapshot.totalNanoseconds += shard.totalNanoseconds.load(memory_order_relaxed) ;
+        for(size_t index = 0 ; index < NUM_BUCKETS ; ++index)
+            snapshot.buckets[index] += shard.buckets[index].load(memory_order_relaxed) ;
+    }
+    return snapshot ;
+}
+//---------------------------------------------------------------------------
+std::string CallTelemetry::format(const std::vector<std::pair<std::string , Snapshot>>& functions) {
+    ostringstream output ;
+    output << "# HELP pljit_calls_total Number of calls of a function.\n" ;
+    output << "# TYPE pljit_calls_total counter\n" ;
+    for(auto& [function , snapshot] : functions)
+        output << "pljit_calls_total{function=\"" << function << "\"} " << snapshot.calls << '\n' ;
+    output << "# HELP pljit_errors_total Number of calls of a function which triggered a runtime error.\n" ;
+    output << "# TYPE pljit_errors_total counter\n" ;
+    for(auto& [function , snapshot] : functions)
+        output << "pljit_errors_total{function=\"" << function << "\"} " << snapshot.errors << '\n' ;
+    output << "# HELP pljit_call_latency_seconds Latency of calls of a function.\n" ;
+    output << "# TYPE pljit_call_latency_seconds histogram\n" ;
+    for(auto& [function , snapshot] : functions) {
+        // buckets are cumulative , count is taken from buckets so that it matches them while calls are recorded concurrently .
+        // empty buckets are emitted as well , every function has the same layout of buckets
+        uint64_t count = 0 ;
+        for(size_t index = 0 ; index + 1 < NUM_BUCKETS ; ++index) {
+            count += snapshot.buckets[index] ;
+            // le is inclusive , latencies are whole nanoseconds
+            output << "pljit_call_latency_seconds_bucket{function=\"" << function << "\",le=\"" << seconds(upperBound(index) - 1) << "\"} " << count << '\n' ;
+        }
+        count += snapshot.buckets[NUM_BUCKETS - 1] ;
+        output << "pljit_call_latency_seconds_bucket{function=\"" << function << "\",le=\"+Inf\"} " << count << '\n' ;
+        output << "pljit_call_latency_seconds_sum{function=\"" << function << "\"} " << seconds(snapshot.totalNanoseconds) << '\n' ;
+        output << "pljit_call_latency_seconds_count{function=\"" << function << "\"} " << count << '\n' ;
+    }
+    return output.str() ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
@@ -0,0 +1,68 @@
+#ifndef PLJIT_CALLTELEMETRY_HPP
+#define PLJIT_CALLTELEMETRY_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// call count , error count and log-linear latency histogram of a function . each thread records into one of
+/// SHARDS cache line aligned shards with relaxed atomic increments , so concurrent calls do not contend on one
+/// cache line . shards are merged when a snapshot is taken
+class CallTelemetry {
+    public:
+    // number of shards , threads are assigned to shards round robin
+    static constexpr size_t SHARDS = 16 ;
+    // each power of two is split into 2^SUB_BUCKET_BITS linear sub buckets
+    static constexpr size_t SUB_BUCKET_BITS = 2 ;
+    // latencies of at least 2^MAX_EXPONENT nanoseconds share the last bucket
+    static constexpr size_t MAX_EXPONENT = 40 ;
+    static constexpr size_t NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) << SUB_BUCKET_BITS ;
+
+    /// merged counters of all shards
+    struct Snapshot {
+        uint64_t calls = 0 ;
+        // calls which returned no value (runtime error)
+        uint64_t errors = 0 ;
+        uint64_t totalNanoseconds = 0 ;
+        // number of calls of each latency bucket
+        std::array<uint64_t , NUM_BUCKETS> buckets {} ;
+    };
+
+    private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> calls = 0 ;
+        std::atomic<uint64_t> errors = 0 ;
+        std::atomic<uint64_t> totalNanoseconds = 0 ;
+        std::array<std::atomic<uint64_t> , NUM_BUCKETS> buckets {} ;
+    };
+    std::array<Shard , SHARDS> shards ;
+
+    public:
+    /// bucket of latency
+    static size_t bucket(uint64_t nanoseconds) ;
+    /// smallest latency which does not fall into bucket or any bucket before it (exclusive upper bound)
+    static uint64_t upperBound(size_t bucket) ;
+
+    /// record a call which started at start and failed if isError
+    void record(std::chrono::steady_clock::time_point start , bool isError) ;
+    /// record a call of given latency
+    void record(uint64_t nanoseconds , bool isError) ;
+
+    /// merge all shards , concurrent calls are recorded or not
+    Snapshot snapshot() const ;
+
+    /// Prometheus text exposition of (function label , snapshot) : counters pljit_calls_total , pljit_errors_total and
+    /// histogram pljit_call_latency_seconds (buckets which hold no call are omitted)
+    static std::string format(const std::vector<std::pair<std::string , Snapshot>>& functions) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_CALLTELEMETRY_HPP
@@ -7,7 +7,7 @@ using namespace std ;
 //---------------------------------------------------------------------------
 namespace jitcompiler ::management{
 //---------------------------------------------------------------------------
-CodeManager::CodeManager(string_view sourceCode) {
+CodeManager::CodeManager(string_view sourceCode , std::pmr::memory_resource* resource) : code_lines(resource) {
     for(size_t i = 0 , j = 0 , code_size = sourceCode.size() ;i < code_size && j < code_size ; i++ , j++) {
         while (j < code_size && sourceCode[j] != '\n') // move pointer j to EOF or newline
             j++ ;
@@ -122,24 +122,38 @@ void CodeManager::printCompileError(size_t expected_token_length , std::string_v
     }
 }
 //---------------------------------------------------------------------------
-void CodeManager::printDivZeroError(CodeReference codeReference) {
+void CodeManager::printRuntimeError(CodeReference codeReference , std::string_view message) {
+    runtimeErrorStream << runtimeErrorText(codeReference , message) ;
+}
+//---------------------------------------------------------------------------
+std::string CodeManager::runtimeErrorText(CodeReference codeReference , std::string_view message) const {
     assert(codeReference.getStartLineRange().first == codeReference.getEndLineRange().first) ;
     size_t currentLine = codeReference.getStartLineRange().first ;
     size_t start_index = codeReference.getStartLineRange().second ;
     size_t last_index = codeReference.getEndLineRange().second ;
     assert(currentLine < code_lines.size()) ;
 
-    runtimeErrorStream << currentLine + 1 << ":" << start_index + 1 << ": Runtime Error: ";
-    runtimeErrorStream << "Divide by Zero" << '\n';
+    ostringstream errorStream ;
+    errorStream << currentLine + 1 << ":" << start_index + 1 << ": Runtime Error: ";
+    errorStream << message << '\n';
 
-    runtimeErrorStream << code_lines[currentLine] << '\n' ;
-    runtimeErrorStream.width(static_cast<uint32_t>(start_index + 1)) ;
-    runtimeErrorStream << '^' ;
+    errorStream << code_lines[currentLine] << '\n' ;
+    errorStream.width(static_cast<uint32_t>(start_index + 1)) ;
+    errorStream << '^' ;
     while (start_index < last_index) {
-        runtimeErrorStream << "~" ;
+        errorStream << "~" ;
         start_index ++ ;
     }
-    runtimeErrorStream << '\n' ;
+    errorStream << '\n' ;
+    return errorStream.str() ;
+}
+//---------------------------------------------------------------------------
+void CodeManager::printDivZeroError(CodeReference codeReference) {
+    printRuntimeError(codeReference , "Divide by Zero") ;
+}
+//---------------------------------------------------------------------------
+void CodeManager::printOverflowError(CodeReference codeReference) {
+    printRuntimeError(codeReference , "Integer Overflow") ;
 }
 //---------------------------------------------------------------------------
 std::size_t CodeManager::countLines() const {
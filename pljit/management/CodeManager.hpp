@@ -3,7 +3,9 @@
 //---------------------------------------------------------------------------
 #include "pljit/management/CodeReference.hpp"
 //---------------------------------------------------------------------------
+#include <memory_resource>
 #include <sstream>
+#include <string>
 #include <string_view>
 #include <vector>
 namespace jitcompiler ::management{
@@ -14,15 +16,18 @@ class CodeManager
     // flag to check if there is any compile error occurred
     bool compileErrorTriggered = false ;
     // store each line of source code
-    std::vector<std::string_view> code_lines ;
+    std::pmr::vector<std::string_view> code_lines ;
     // output stream for printing compile error message
     std :: ostringstream compileErrorStream ;
-    // output stream for printing runtime error message (divide by zero)
+    // output stream for printing runtime error message (divide by zero , integer overflow)
     std :: ostringstream runtimeErrorStream ;
 
+    // print runtime error message pointing at operator
+    void printRuntimeError(CodeReference codeReference , std::string_view message) ;
+
     public:
-    // Constructor -> store source code line by line
-    explicit CodeManager(std::string_view sourceCode) ;
+    // Constructor -> store source code line by line , lines are allocated from resource
+    explicit CodeManager(std::string_view sourceCode , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     // get current line of code -> zero-based index
     std::string_view getCurrentLine(size_t index) const ;
@@ -45,6 +50,12 @@ class CodeManager
     // trigger runtime error -> divide by zero
     void printDivZeroError(CodeReference codeReference) ;
 
+    // trigger runtime error -> result of operator does not fit into int64_t (checked arithmetic only)
+    void printOverflowError(CodeReference codeReference) ;
+
+    // runtime error message pointing at operator without triggering it (used by native code)
+    std::string runtimeErrorText(CodeReference codeReference , std::string_view message) const ;
+
     // check if compile error is triggered
     bool isCodeError() const ;
 
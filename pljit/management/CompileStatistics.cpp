@@ -0,0 +1,88 @@
+#include "pljit/management/CompileStatistics.hpp"
+#include "pljit/management/MemoryAccount.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+uint64_t CompileStatistics::Compilation::totalNanoseconds() const {
+    uint64_t total = 0 ;
+    for(const optional<Sample>& sample : phases)
+        if(sample.has_value())
+            total += sample->nanoseconds ;
+    return total ;
+}
+//---------------------------------------------------------------------------
+CompileStatistics::PhaseTimer::PhaseTimer() : start(chrono::steady_clock::now()) , allocations(threadAllocations()) {}
+//---------------------------------------------------------------------------
+CompileStatistics::Sample CompileStatistics::PhaseTimer::finishPhase(size_t outputSize) {
+    chrono::steady_clock::time_point end = chrono::steady_clock::now() ;
+    uint64_t endAllocations = threadAllocations() ;
+    Sample sample ;
+    sample.nanoseconds = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(end - start).count()) ;
+    sample.allocations = endAllocations - allocations ;
+    sample.outputSize = outputSize ;
+    start = end ;
+    allocations = endAllocations ;
+    return sample ;
+}
+//---------------------------------------------------------------------------
+uint64_t CompileStatistics::threadAllocations() {
+    return MemoryAccount::threadAllocations() ;
+}
+//---------------------------------------------------------------------------
+CompileStatistics::Distribution CompileStatistics::distribution(std::vector<uint64_t> values) {
+    Distribution result ;
+    if(values.empty())
+        return result ;
+    sort(values.begin() , values.end()) ;
+    auto percentile = [&values](size_t percent) {
+        size_t rank = (percent * values.size() + 99) / 100 ;
+        return values[max<size_t>(rank , 1) - 1] ;
+    } ;
+    result.p50 = percentile(50) ;
+    result.p90 = percentile(90) ;
+    result.p99 = percentile(99) ;
+    result.max = values.back() ;
+    for(uint64_t value : values)
+        result.total += value ;
+    return result ;
+}
+//---------------------------------------------------------------------------
+void CompileStatistics::record(const Compilation& compilation) {
+    unique_lock lock(statisticsMutex) ;
+    compilations.push_back(compilation) ;
+}
+//---------------------------------------------------------------------------
+std::vector<CompileStatistics::Compilation> CompileStatistics::getCompilations() const {
+    unique_lock lock(statisticsMutex) ;
+    return compilations ;
+}
+//---------------------------------------------------------------------------
+CompileStatistics::PhaseSummary CompileStatistics::summarize(Phase phase) const {
+    vector<uint64_t> nanoseconds , allocations , outputSize ;
+    {
+        unique_lock lock(statisticsMutex) ;
+        for(const Compilation& compilation : compilations) {
+            const optional<Sample>& sample = compilation.phases[phase] ;
+            if(!sample.has_value())
+                continue ;
+            nanoseconds.push_back(sample->nanoseconds) ;
+            allocations.push_back(sample->allocations) ;
+            outputSize.push_back(sample->outputSize) ;
+        }
+    }
+    PhaseSummary summary ;
+    summary.samples = nanoseconds.size() ;
+    if(summary.samples == 0)
+        return summary ;
+    summary.nanoseconds = distribution(std::move(nanoseconds)) ;
+    summary.allocations = distribution(std::move(allocations)) ;
+    summary.outputSize = distribution(std::move(outputSize)) ;
+    return summary ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
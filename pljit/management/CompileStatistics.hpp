@@ -0,0 +1,105 @@
+#ifndef PLJIT_COMPILESTATISTICS_HPP
+#define PLJIT_COMPILESTATISTICS_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// wall time , number of allocations and output size of each compile phase of each compiled function , safe to use
+/// from concurrent compilations . allocations are counted per thread through the memory accounts of the compiled
+/// function (see MemoryAccount) , allocations which bypass the accounts are not counted
+class CompileStatistics {
+    public:
+    /// compile phase , output size is counted in the unit given for each phase
+    enum Phase : uint8_t {
+        LEXING ,              // tokens of TokenStream::compileCode()
+        PARSING ,             // parse tree nodes of FunctionDeclaration::compileCode()
+        SEMANTIC_ANALYSIS ,   // AST nodes of FunctionAST::compileCode()
+        OPTIMIZATION ,        // AST nodes after acceptOptimization()
+        CLOSURE_COMPILATION , // AST nodes lowered to closures of ClosureFunction (tier of first call)
+        LOWERING ,            // IR instructions of ir::Function
+        CODE_GENERATION ,     // bytes of machine code built by copy-and-patch (0 if function is interpreted)
+        NUM_PHASES
+    };
+
+    /// measurement of one phase of one compilation
+    struct Sample {
+        uint64_t nanoseconds = 0 ;
+        uint64_t allocations = 0 ;
+        size_t outputSize = 0 ;
+    };
+
+    /// one compilation of a function
+    struct Compilation {
+        // index of function within pljit
+        size_t function = 0 ;
+        // compilation of guarded version of function
+        bool guarded = false ;
+        // measurement of each phase , nullopt for phases which did not run (after a compile error , lowering and code
+        // generation are recorded as a separate compilation once the function is called again)
+        std::array<std::optional<Sample> , NUM_PHASES> phases ;
+
+        /// sum of nanoseconds of all phases
+        uint64_t totalNanoseconds() const ;
+    };
+
+    /// nearest-rank percentiles of a value over all samples of a phase
+    struct Distribution {
+        uint64_t p50 = 0 ;
+        uint64_t p90 = 0 ;
+        uint64_t p99 = 0 ;
+        uint64_t max = 0 ;
+        uint64_t total = 0 ;
+    };
+
+    /// aggregate of all samples of a phase
+    struct PhaseSummary {
+        size_t samples = 0 ;
+        Distribution nanoseconds ;
+        Distribution allocations ;
+        Distribution outputSize ;
+    };
+
+    /// measure consecutive phases of a compilation on the current thread
+    class PhaseTimer {
+        std::chrono::steady_clock::time_point start ;
+        uint64_t allocations ;
+
+        public:
+        /// start measurement of first phase
+        PhaseTimer() ;
+        /// finish measurement of current phase which produced output of given size , start measurement of next phase
+        Sample finishPhase(size_t outputSize) ;
+    };
+
+    private:
+    // guards compilations
+    mutable std::mutex statisticsMutex ;
+    std::vector<Compilation> compilations ;
+
+    public:
+    /// number of allocations of current thread through memory accounts since it started
+    static uint64_t threadAllocations() ;
+
+    /// nearest-rank percentiles of values , all zero if there are no values
+    static Distribution distribution(std::vector<uint64_t> values) ;
+
+    /// add finished compilation
+    void record(const Compilation& compilation) ;
+
+    /// all recorded compilations in order of recording
+    std::vector<Compilation> getCompilations() const ;
+
+    /// aggregate samples of phase over all compilations
+    PhaseSummary summarize(Phase phase) const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_COMPILESTATISTICS_HPP
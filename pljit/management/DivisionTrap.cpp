@@ -0,0 +1,184 @@
+#include "pljit/management/DivisionTrap.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#if defined(__x86_64__) && defined(__linux__)
+#include <csetjmp>
+#include <csignal>
+#include <ucontext.h>
+#define PLJIT_DIVISION_TRAP 1
+#endif
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    struct Region {
+        // start address of native code , 0 if region is unused (published last , read by signal handler)
+        atomic<uintptr_t> begin = 0 ;
+        atomic<size_t> size = 0 ;
+        // (offset of division instruction , code reference) sorted by offset
+        vector<pair<size_t , CodeReference>> divisions ;
+    };
+    //---------------------------------------------------------------------------
+    // regions are never freed , the signal handler walks the blocks without locking
+    struct RegionBlock {
+        array<Region , DivisionTrap::REGIONS_PER_BLOCK> regions ;
+        // next block , nullptr if this is the last block (published after its construction)
+        atomic<RegionBlock*> next = nullptr ;
+    };
+    //---------------------------------------------------------------------------
+    RegionBlock firstBlock ;
+    // guards registration of regions and appending of blocks
+    mutex regionMutex ;
+    //---------------------------------------------------------------------------
+    Region& find_region(size_t index)
+    /// region with index (regionMutex must be held)
+    {
+        RegionBlock* block = &firstBlock ;
+        for(; index >= DivisionTrap::REGIONS_PER_BLOCK ; index -= DivisionTrap::REGIONS_PER_BLOCK)
+            block = block->next.load(memory_order_relaxed) ;
+        return block->regions[index] ;
+    }
+#ifdef PLJIT_DIVISION_TRAP
+    //---------------------------------------------------------------------------
+    const CodeReference* find_division(uintptr_t pc)
+    /// code reference of registered division at pc , nullptr if there is none (async-signal-safe)
+    {
+        for(RegionBlock* block = &firstBlock ; block != nullptr ; block = block->next.load(memory_order_acquire)) {
+            for(Region& region : block->regions) {
+                uintptr_t begin = region.begin.load(memory_order_acquire) ;
+                if(begin == 0 || pc < begin || pc - begin >= region.size.load(memory_order_relaxed))
+                    continue ;
+                size_t offset = pc - begin ;
+                auto it = lower_bound(region.divisions.begin() , region.divisions.end() , offset ,
+                                      [](const pair<size_t , CodeReference>& division , size_t value) { return division.first < value ; }) ;
+                if(it != region.divisions.end() && it->first == offset)
+                    return &it->second ;
+                return nullptr ;
+            }
+        }
+        return nullptr ;
+    }
+    //---------------------------------------------------------------------------
+    // jump buffer of innermost guarded call of current thread
+    thread_local sigjmp_buf* activeBuffer = nullptr ;
+    // division which trapped in current thread
+    thread_local const CodeReference* trappedDivision = nullptr ;
+    // signal action which was installed before our handler
+    struct sigaction previousAction ;
+    once_flag installFlag ;
+    //---------------------------------------------------------------------------
+    // size of idiv rcx , the division instruction of native code
+    constexpr greg_t DIVISION_SIZE = 3 ;
+    //---------------------------------------------------------------------------
+    void handle_trap(int signal , siginfo_t* info , void* context) {
+        greg_t* registers = static_cast<ucontext_t*>(context)->uc_mcontext.gregs ;
+        uintptr_t pc = static_cast<uintptr_t>(registers[REG_RIP]) ;
+        const CodeReference* division = find_division(pc) ;
+        // INT64_MIN / -1 overflows , quotient wraps around to INT64_MIN and remainder is 0
+        if(division != nullptr && registers[REG_RCX] == -1) {
+            registers[REG_RAX] = static_cast<greg_t>(0 - static_cast<uint64_t>(registers[REG_RAX])) ;
+            registers[REG_RDX] = 0 ;
+            registers[REG_RIP] += DIVISION_SIZE ;
+            return ;
+        }
+        if(division != nullptr && activeBuffer != nullptr) {
+            trappedDivision = division ;
+            siglongjmp(*activeBuffer , 1) ;
+        }
+        // trap outside of registered native code is passed to previous handler
+        if(previousAction.sa_flags & SA_SIGINFO)
+            previousAction.sa_sigaction(signal , info , context) ;
+        else if(previousAction.sa_handler != SIG_DFL && previousAction.sa_handler != SIG_IGN)
+            previousAction.sa_handler(signal) ;
+        else {
+            // faulting instruction is executed again with default action
+            struct sigaction action {} ;
+            action.sa_handler = SIG_DFL ;
+            sigaction(SIGFPE , &action , nullptr) ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    void install_handler() {
+        struct sigaction action {} ;
+        action.sa_sigaction = handle_trap ;
+        sigemptyset(&action.sa_mask) ;
+        // SIGFPE stays unblocked when the handler jumps back , call() does not need to save the signal mask
+        action.sa_flags = SA_SIGINFO | SA_NODEFER ;
+        sigaction(SIGFPE , &action , &previousAction) ;
+    }
+#endif
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+bool DivisionTrap::isSupported() {
+#ifdef PLJIT_DIVISION_TRAP
+    return true ;
+#else
+    return false ;
+#endif
+}
+//---------------------------------------------------------------------------
+std::optional<size_t> DivisionTrap::registerCode(const void* begin , size_t size , std::vector<std::pair<size_t , CodeReference>> divisions) {
+    if(!isSupported() || begin == nullptr)
+        return nullopt ;
+#ifdef PLJIT_DIVISION_TRAP
+    call_once(installFlag , install_handler) ;
+#endif
+    sort(divisions.begin() , divisions.end() ,
+         [](const pair<size_t , CodeReference>& left , const pair<size_t , CodeReference>& right) { return left.first < right.first ; }) ;
+    unique_lock lock(regionMutex) ;
+    size_t index = 0 ;
+    for(RegionBlock* block = &firstBlock ; ; block = block->next.load(memory_order_relaxed)) {
+        for(Region& region : block->regions) {
+            if(region.begin.load(memory_order_relaxed) == 0) {
+                region.size.store(size , memory_order_relaxed) ;
+                region.divisions = std::move(divisions) ;
+                region.begin.store(reinterpret_cast<uintptr_t>(begin) , memory_order_release) ;
+                return index ;
+            }
+            ++index ;
+        }
+        // all regions are used , append a new block
+        if(block->next.load(memory_order_relaxed) == nullptr)
+            block->next.store(new RegionBlock() , memory_order_release) ;
+    }
+}
+//---------------------------------------------------------------------------
+void DivisionTrap::unregisterCode(size_t region) {
+    unique_lock lock(regionMutex) ;
+    Region& unused = find_region(region) ;
+    unused.begin.store(0 , memory_order_release) ;
+    unused.size.store(0 , memory_order_relaxed) ;
+    unused.divisions.clear() ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> DivisionTrap::call(NativeFunction function , const int64_t* parameterList , CodeReference& reference) {
+#ifdef PLJIT_DIVISION_TRAP
+    sigjmp_buf buffer ;
+    sigjmp_buf* previousBuffer = activeBuffer ;
+    activeBuffer = &buffer ;
+    // handler is installed with SA_NODEFER , saving the signal mask would cost a system call per call
+    if(sigsetjmp(buffer , 0) != 0) {
+        activeBuffer = previousBuffer ;
+        reference = *trappedDivision ;
+        return nullopt ;
+    }
+    int64_t result = function(parameterList) ;
+    activeBuffer = previousBuffer ;
+    return result ;
+#else
+    // native code is not guarded , divisions must be checked by native code itself
+    (void) reference ;
+    return function(parameterList) ;
+#endif
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
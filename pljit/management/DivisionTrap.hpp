@@ -0,0 +1,42 @@
+#ifndef PLJIT_DIVISIONTRAP_HPP
+#define PLJIT_DIVISIONTRAP_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/CodeReference.hpp"
+//---------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// map hardware division traps (SIGFPE) of native code back to the code reference of the faulting division .
+/// native code registers its address range together with the offsets of its division instructions (side table) .
+/// a trap within a call guarded by call() unwinds to its caller , therefore native code does not need to compare
+/// divisors with zero . division instructions must be idiv rcx , INT64_MIN / -1 is wrapped around to INT64_MIN and
+/// execution continues behind the division . native code must not hold resources which need cleanup when it is unwound
+class DivisionTrap {
+    public:
+    // number of code regions which are added at once when all registered regions are used
+    static constexpr size_t REGIONS_PER_BLOCK = 64 ;
+    // signature of native function : pointer to parameter list
+    using NativeFunction = int64_t (*)(const int64_t*) ;
+
+    /// check if traps can be mapped on this platform (x86-64 Linux)
+    static bool isSupported() ;
+
+    /// register native code [begin , begin + size) with (offset of division instruction , code reference of "/") ,
+    /// nullopt if traps are not supported
+    static std::optional<size_t> registerCode(const void* begin , size_t size , std::vector<std::pair<size_t , CodeReference>> divisions) ;
+
+    /// unregister code region , code must not be executed anymore
+    static void unregisterCode(size_t region) ;
+
+    /// call native function , !has_value() if one of its registered divisions trapped (reference of division is stored in reference)
+    static std::optional<int64_t> call(NativeFunction function , const int64_t* parameterList , CodeReference& reference) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_DIVISIONTRAP_HPP
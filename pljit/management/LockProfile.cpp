@@ -0,0 +1,29 @@
+#include "pljit/management/LockProfile.hpp"
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+void LockProfile::record(LockType type , bool contended , uint64_t waitNanoseconds) {
+    Entry& entry = entries[type] ;
+    entry.acquisitions.fetch_add(1 , memory_order_relaxed) ;
+    if(!contended)
+        return ;
+    entry.contended.fetch_add(1 , memory_order_relaxed) ;
+    entry.waitNanoseconds.fetch_add(waitNanoseconds , memory_order_relaxed) ;
+    uint64_t maxWait = entry.maxWaitNanoseconds.load(memory_order_relaxed) ;
+    while(maxWait < waitNanoseconds && !entry.maxWaitNanoseconds.compare_exchange_weak(maxWait , waitNanoseconds , memory_order_relaxed)) {}
+}
+//---------------------------------------------------------------------------
+LockProfile::Counters LockProfile::getCounters(LockType type) const {
+    const Entry& entry = entries[type] ;
+    Counters counters ;
+    counters.acquisitions = entry.acquisitions.load(memory_order_relaxed) ;
+    counters.contended = entry.contended.load(memory_order_relaxed) ;
+    counters.waitNanoseconds = entry.waitNanoseconds.load(memory_order_relaxed) ;
+    counters.maxWaitNanoseconds = entry.maxWaitNanoseconds.load(memory_order_relaxed) ;
+    return counters ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
@@ -0,0 +1,49 @@
+#ifndef PLJIT_LOCKPROFILE_HPP
+#define PLJIT_LOCKPROFILE_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// acquisitions of the mutex of a function and time spent blocked on it , counted per lock type with relaxed atomics
+class LockProfile {
+    public:
+    enum LockType : uint8_t {
+        EXCLUSIVE ,   // unique_lock : compilation and installation of tiered up code
+        SHARED ,      // shared_lock : evaluation
+        NUM_LOCK_TYPES
+    };
+
+    /// counters of a lock type
+    struct Counters {
+        uint64_t acquisitions = 0 ;
+        // acquisitions which blocked since the mutex was held in a conflicting mode
+        uint64_t contended = 0 ;
+        uint64_t waitNanoseconds = 0 ;
+        uint64_t maxWaitNanoseconds = 0 ;
+    };
+
+    private:
+    // lock types are locked by different threads , so they do not share a cache line
+    struct alignas(64) Entry {
+        std::atomic<uint64_t> acquisitions = 0 ;
+        std::atomic<uint64_t> contended = 0 ;
+        std::atomic<uint64_t> waitNanoseconds = 0 ;
+        std::atomic<uint64_t> maxWaitNanoseconds = 0 ;
+    };
+    std::array<Entry , NUM_LOCK_TYPES> entries ;
+
+    public:
+    /// record acquisition which blocked for waitNanoseconds if it is contended
+    void record(LockType type , bool contended , uint64_t waitNanoseconds) ;
+
+    /// counters of lock type , concurrent acquisitions are counted or not
+    Counters getCounters(LockType type) const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_LOCKPROFILE_HPP
@@ -0,0 +1,75 @@
+#include "pljit/management/MemoCache.hpp"
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+size_t MemoCache::ParameterHash::operator()(const std::vector<int64_t>& parameterList) const {
+    uint64_t hash = parameterList.size() ;
+    for(int64_t value : parameterList) {
+        // mix each value (finalizer of splitmix64) before combining
+        uint64_t mixed = static_cast<uint64_t>(value) + 0x9e3779b97f4a7c15 ;
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9 ;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111eb ;
+        mixed ^= mixed >> 31 ;
+        hash = (hash ^ mixed) * 0x100000001b3 ;
+    }
+    return static_cast<size_t>(hash) ;
+}
+//---------------------------------------------------------------------------
+MemoCache::MemoCache(size_t capacity) : stripeCapacity(max<size_t>(1 , (capacity + STRIPES - 1) / STRIPES)) {}
+//---------------------------------------------------------------------------
+MemoCache::Stripe& MemoCache::getStripe(const std::vector<int64_t>& parameterList) {
+    // high bits of hash select stripe , low bits select bucket within stripe
+    uint64_t hash = ParameterHash()(parameterList) ;
+    return stripes[(hash >> 32) % STRIPES] ;
+}
+//---------------------------------------------------------------------------
+std::optional<MemoCache::Result> MemoCache::lookup(const std::vector<int64_t>& parameterList) {
+    Stripe& stripe = getStripe(parameterList) ;
+    unique_lock lock(stripe.stripeMutex) ;
+    auto it = stripe.slots.find(parameterList) ;
+    if(it == stripe.slots.end())
+        return nullopt ;
+    Entry& entry = stripe.entries[it->second] ;
+    entry.referenced = true ;
+    return entry.result ;
+}
+//---------------------------------------------------------------------------
+void MemoCache::insert(const std::vector<int64_t>& parameterList , Result result) {
+    Stripe& stripe = getStripe(parameterList) ;
+    unique_lock lock(stripe.stripeMutex) ;
+    auto it = stripe.slots.find(parameterList) ;
+    if(it != stripe.slots.end()) {
+        // result was computed concurrently by another call
+        stripe.entries[it->second].result = std::move(result) ;
+        return ;
+    }
+    size_t slot = stripe.entries.size() ;
+    if(slot == stripeCapacity) {
+        // give referenced entries a second chance
+        while(stripe.entries[stripe.hand].referenced) {
+            stripe.entries[stripe.hand].referenced = false ;
+            stripe.hand = (stripe.hand + 1) % stripeCapacity ;
+        }
+        slot = stripe.hand ;
+        stripe.hand = (stripe.hand + 1) % stripeCapacity ;
+        stripe.slots.erase(*stripe.entries[slot].parameterList) ;
+    }
+    else
+        stripe.entries.emplace_back() ;
+    auto inserted = stripe.slots.emplace(parameterList , slot).first ;
+    stripe.entries[slot] = Entry{&inserted->first , std::move(result) , false} ;
+}
+//---------------------------------------------------------------------------
+size_t MemoCache::size() {
+    size_t count = 0 ;
+    for(Stripe& stripe : stripes) {
+        unique_lock lock(stripe.stripeMutex) ;
+        count += stripe.entries.size() ;
+    }
+    return count ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
@@ -0,0 +1,68 @@
+#ifndef PLJIT_MEMOCACHE_HPP
+#define PLJIT_MEMOCACHE_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// bounded cache of function results keyed by parameter list , safe to use from concurrent calls .
+/// entries are split into stripes by hash of parameter list , each stripe has its own lock and evicts
+/// entries with CLOCK (second chance) once it is full
+class MemoCache {
+    public:
+    // (value , runtime error message) as returned by a function call
+    using Result = std::pair<std::optional<int64_t> , std::string> ;
+    // number of independently locked stripes
+    static constexpr size_t STRIPES = 16 ;
+
+    private:
+    struct ParameterHash {
+        size_t operator()(const std::vector<int64_t>& parameterList) const ;
+    };
+    struct Entry {
+        // key of entry within slots of stripe (keys of unordered_map are not moved by rehashing)
+        const std::vector<int64_t>* parameterList ;
+        Result result ;
+        // set by lookup , cleared by clock hand
+        bool referenced ;
+    };
+    struct Stripe {
+        std::mutex stripeMutex ;
+        std::vector<Entry> entries ;
+        // index of entry for each cached parameter list
+        std::unordered_map<std::vector<int64_t> , size_t , ParameterHash> slots ;
+        // next entry considered for eviction
+        size_t hand = 0 ;
+    };
+
+    // maximal number of entries of each stripe
+    size_t stripeCapacity ;
+    std::array<Stripe , STRIPES> stripes ;
+
+    /// stripe which holds given parameter list
+    Stripe& getStripe(const std::vector<int64_t>& parameterList) ;
+
+    public:
+    /// cache at most capacity results (rounded up to a multiple of STRIPES)
+    explicit MemoCache(size_t capacity) ;
+
+    /// get cached result of a call
+    std::optional<Result> lookup(const std::vector<int64_t>& parameterList) ;
+
+    /// cache result of a call , evicting an entry which was not looked up recently if stripe is full
+    void insert(const std::vector<int64_t>& parameterList , Result result) ;
+
+    /// number of cached results
+    size_t size() ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_MEMOCACHE_HPP
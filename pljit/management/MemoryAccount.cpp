@@ -0,0 +1,49 @@
+#include "pljit/management/MemoryAccount.hpp"
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // allocations of current thread through any account
+    thread_local uint64_t allocationCount = 0 ;
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+MemoryAccount::MemoryAccount(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+//---------------------------------------------------------------------------
+void* MemoryAccount::do_allocate(size_t size , size_t alignment) {
+    void* memory = upstream->allocate(size , alignment) ;
+    ++allocationCount ;
+    // counters are only read for reporting , no ordering is needed
+    bytes.fetch_add(size , memory_order_relaxed) ;
+    allocations.fetch_add(1 , memory_order_relaxed) ;
+    return memory ;
+}
+//---------------------------------------------------------------------------
+void MemoryAccount::do_deallocate(void* memory , size_t size , size_t alignment) {
+    upstream->deallocate(memory , size , alignment) ;
+    bytes.fetch_sub(size , memory_order_relaxed) ;
+    allocations.fetch_sub(1 , memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+bool MemoryAccount::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other ;
+}
+//---------------------------------------------------------------------------
+size_t MemoryAccount::getBytes() const {
+    return bytes.load(memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+size_t MemoryAccount::getAllocations() const {
+    return allocations.load(memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+uint64_t MemoryAccount::threadAllocations() {
+    return allocationCount ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
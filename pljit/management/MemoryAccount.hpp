@@ -0,0 +1,66 @@
+#ifndef PLJIT_MEMORYACCOUNT_HPP
+#define PLJIT_MEMORYACCOUNT_HPP
+//---------------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// resident heap memory of a group of objects . the account is a memory resource which counts the live bytes and
+/// allocations passing through it to its upstream resource . objects are charged by allocating their containers with
+/// polymorphic allocators of the account and their nodes with make_resource() , they must be freed before the account
+class MemoryAccount final : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream ;
+    // requested bytes and number of live allocations (allocations may be freed on any thread)
+    std::atomic<size_t> bytes = 0 ;
+    std::atomic<size_t> allocations = 0 ;
+
+    void* do_allocate(size_t size , size_t alignment) override ;
+    void do_deallocate(void* memory , size_t size , size_t alignment) override ;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override ;
+
+    public:
+    explicit MemoryAccount(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) ;
+    MemoryAccount(const MemoryAccount&) = delete ;
+    MemoryAccount& operator=(const MemoryAccount&) = delete ;
+
+    /// requested bytes of all live allocations charged to account
+    size_t getBytes() const ;
+    /// number of live allocations charged to account
+    size_t getAllocations() const ;
+
+    /// number of allocations of current thread through any account since it started
+    static uint64_t threadAllocations() ;
+};
+//---------------------------------------------------------------------------
+/// deleter of an object which was allocated by make_resource() , the object may be deleted through a base class
+/// with virtual destructor since size and alignment of the allocation are kept by the deleter
+struct ResourceDeleter {
+    std::pmr::memory_resource* resource = nullptr ;
+    size_t size = 0 ;
+    size_t alignment = 0 ;
+
+    template <typename T>
+    void operator()(T* object) const {
+        std::destroy_at(object) ;
+        resource->deallocate(object , size , alignment) ;
+    }
+};
+//---------------------------------------------------------------------------
+/// owning pointer of an object allocated from a memory resource
+template <typename T>
+using ResourcePointer = std::unique_ptr<T , ResourceDeleter> ;
+//---------------------------------------------------------------------------
+/// allocate object from memory resource (make_unique with a memory resource)
+template <typename T , typename... Args>
+ResourcePointer<T> make_resource(std::pmr::memory_resource* resource , Args&&... args) {
+    T* object = std::pmr::polymorphic_allocator<T>(resource).template new_object<T>(std::forward<Args>(args)...) ;
+    return ResourcePointer<T>(object , ResourceDeleter{resource , sizeof(T) , alignof(T)}) ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_MEMORYACCOUNT_HPP
@@ -0,0 +1,153 @@
+#include "pljit/management/Tracer.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include <sys/syscall.h>
+#include <unistd.h>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // fields are atomic since flush() may read a slot while its thread overwrites it
+    struct Slot {
+        atomic<const char*> name = nullptr ;
+        atomic<const char*> category = nullptr ;
+        atomic<uint64_t> function = 0 ;
+        atomic<uint64_t> begin = 0 ;
+        atomic<uint64_t> end = 0 ;
+    };
+    //---------------------------------------------------------------------------
+    struct Event {
+        const char* name ;
+        const char* category ;
+        uint64_t function ;
+        uint64_t begin ;
+        uint64_t end ;
+    };
+    //---------------------------------------------------------------------------
+    /// ring buffer written by one thread only
+    struct ThreadBuffer {
+        uint64_t threadId = static_cast<uint64_t>(syscall(SYS_gettid)) ;
+        unique_ptr<Slot[]> slots = make_unique<Slot[]>(Tracer::CAPACITY) ;
+        // number of events written by thread
+        atomic<uint64_t> head = 0 ;
+        // number of events removed by flush() (guarded by tracerMutex)
+        uint64_t flushed = 0 ;
+    };
+    //---------------------------------------------------------------------------
+    atomic<bool> tracingEnabled = false ;
+    // guards buffers
+    mutex tracerMutex ;
+    // buffers of all threads which recorded an event , kept after their thread exits until they are flushed
+    vector<shared_ptr<ThreadBuffer>> buffers ;
+    //---------------------------------------------------------------------------
+    ThreadBuffer& thread_buffer()
+    /// buffer of current thread , registered on first call
+    {
+        thread_local shared_ptr<ThreadBuffer> buffer ;
+        if(buffer == nullptr) {
+            buffer = make_shared<ThreadBuffer>() ;
+            unique_lock lock(tracerMutex) ;
+            buffers.push_back(buffer) ;
+        }
+        return *buffer ;
+    }
+    //---------------------------------------------------------------------------
+    vector<Event> take_events(ThreadBuffer& buffer)
+    /// events of buffer since last flush which were not overwritten while they are read (seqlock on head)
+    {
+        uint64_t head = buffer.head.load(memory_order_acquire) ;
+        uint64_t first = max(buffer.flushed , head > Tracer::CAPACITY ? head - Tracer::CAPACITY : 0) ;
+        vector<Event> events ;
+        events.reserve(head - first) ;
+        for(uint64_t index = first ; index < head ; ++index) {
+            const Slot& slot = buffer.slots[index % Tracer::CAPACITY] ;
+            events.push_back({slot.name.load(memory_order_relaxed) , slot.category.load(memory_order_relaxed) ,
+                              slot.function.load(memory_order_relaxed) , slot.begin.load(memory_order_relaxed) ,
+                              slot.end.load(memory_order_relaxed)}) ;
+        }
+        // slot of event i is reused by event i + CAPACITY , which is written while head is at least i + CAPACITY
+        atomic_thread_fence(memory_order_acquire) ;
+        uint64_t overwritten = buffer.head.load(memory_order_relaxed) + 1 ;
+        if(overwritten > first + Tracer::CAPACITY)
+            events.erase(events.begin() , events.begin() + static_cast<ptrdiff_t>(min(overwritten - Tracer::CAPACITY - first , head - first))) ;
+        buffer.flushed = head ;
+        return events ;
+    }
+    //---------------------------------------------------------------------------
+    string microseconds(uint64_t nanoseconds) {
+        char text[32] ;
+        snprintf(text , sizeof(text) , "%llu.%03llu" , static_cast<unsigned long long>(nanoseconds / 1000) ,
+                 static_cast<unsigned long long>(nanoseconds % 1000)) ;
+        return text ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+Tracer::Span::Span(const char* name , const char* category , uint64_t function)
+    : name(name) , category(category) , function(function) , begin(isEnabled() ? now() : 0) {}
+//---------------------------------------------------------------------------
+Tracer::Span::~Span() {
+    if(begin != 0)
+        record(name , category , function , begin , now()) ;
+}
+//---------------------------------------------------------------------------
+void Tracer::enable(bool enabled) {
+    tracingEnabled.store(enabled , memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+bool Tracer::isEnabled() {
+    return tracingEnabled.load(memory_order_relaxed) ;
+}
+//---------------------------------------------------------------------------
+uint64_t Tracer::now() {
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count()) ;
+}
+//---------------------------------------------------------------------------
+void Tracer::record(const char* name , const char* category , uint64_t function , uint64_t begin , uint64_t end) {
+    ThreadBuffer& buffer = thread_buffer() ;
+    uint64_t head = buffer.head.load(memory_order_relaxed) ;
+    // a reader which sees any field of this event sees head of at least this event afterwards
+    atomic_thread_fence(memory_order_release) ;
+    Slot& slot = buffer.slots[head % CAPACITY] ;
+    slot.name.store(name , memory_order_relaxed) ;
+    slot.category.store(category , memory_order_relaxed) ;
+    slot.function.store(function , memory_order_relaxed) ;
+    slot.begin.store(begin , memory_order_relaxed) ;
+    slot.end.store(end , memory_order_relaxed) ;
+    buffer.head.store(head + 1 , memory_order_release) ;
+}
+//---------------------------------------------------------------------------
+std::string Tracer::flush() {
+    unsigned long long processId = static_cast<unsigned long long>(getpid()) ;
+    ostringstream output ;
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" ;
+    bool first = true ;
+    unique_lock lock(tracerMutex) ;
+    for(const shared_ptr<ThreadBuffer>& buffer : buffers) {
+        for(const Event& event : take_events(*buffer)) {
+            output << (first ? "\n" : ",\n") ;
+            first = false ;
+            output << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << microseconds(event.begin)
+                   << ",\"dur\":" << microseconds(event.end - event.begin) << ",\"pid\":" << processId << ",\"tid\":" << buffer->threadId
+                   << ",\"args\":{\"function\":" << event.function << "}}" ;
+        }
+    }
+    // buffers of exited threads are only referenced here
+    erase_if(buffers , [](const shared_ptr<ThreadBuffer>& buffer) { return buffer.use_count() == 1 ; }) ;
+    output << "\n]}\n" ;
+    return output.str() ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
@@ -0,0 +1,54 @@
+#ifndef PLJIT_TRACER_HPP
+#define PLJIT_TRACER_HPP
+//---------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <string>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// process wide timeline of compile phases , lock waits , tier-ups and evaluations , disabled by default .
+/// each thread records its spans (name , category , function , begin and end timestamp) into an own ring buffer of
+/// CAPACITY events without locks , the oldest events are overwritten . flush() renders the events of all threads in
+/// the Chrome trace event format , which is opened by chrome://tracing and ui.perfetto.dev . Pljit records compile
+/// phases , blocked waits on the mutex of a function , tier-ups and evaluations with the index of the function as argument
+class Tracer {
+    public:
+    // number of events kept per thread
+    static constexpr size_t CAPACITY = 1 << 14 ;
+
+    /// record time from construction to destruction as span if tracing is enabled at construction .
+    /// name and category must be string literals
+    class Span {
+        const char* name ;
+        const char* category ;
+        uint64_t function ;
+        // begin timestamp , 0 if span is not recorded
+        uint64_t begin ;
+
+        public:
+        Span(const char* name , const char* category , uint64_t function) ;
+        Span(const Span&) = delete ;
+        Span& operator=(const Span&) = delete ;
+        ~Span() ;
+    };
+
+    /// start or stop recording , recorded events are kept until they are flushed
+    static void enable(bool enabled) ;
+
+    /// check if events are recorded
+    static bool isEnabled() ;
+
+    /// nanoseconds of steady clock
+    static uint64_t now() ;
+
+    /// record span of current thread
+    static void record(const char* name , const char* category , uint64_t function , uint64_t begin , uint64_t end) ;
+
+    /// Chrome trace event JSON of all events recorded since last flush , events are removed
+    static std::string flush() ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_TRACER_HPP
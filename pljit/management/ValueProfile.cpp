@@ -0,0 +1,57 @@
+#include "pljit/management/ValueProfile.hpp"
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+ValueProfile::ValueProfile(uint64_t profileCalls) : profileCalls(profileCalls) {}
+//---------------------------------------------------------------------------
+bool ValueProfile::record(const std::vector<int64_t>& parameterList) {
+    if(profileCalls == 0 || complete.load(memory_order_acquire))
+        return false ;
+    unique_lock lock(profileMutex) ;
+    if(calls >= profileCalls)
+        return false ;
+    if(candidates.size() < parameterList.size()) {
+        candidates.resize(parameterList.size() , 0) ;
+        votes.resize(parameterList.size() , 0) ;
+        matches.resize(parameterList.size() , 0) ;
+    }
+    bool electing = calls < profileCalls / 2 ;
+    for(size_t index = 0 ; index < parameterList.size() ; ++index) {
+        int64_t value = parameterList[index] ;
+        if(!electing)
+            matches[index] += value == candidates[index] ;
+        else if(votes[index] == 0) {
+            candidates[index] = value ;
+            votes[index] = 1 ;
+        }
+        else if(value == candidates[index])
+            ++votes[index] ;
+        else
+            --votes[index] ;
+    }
+    if(++calls < profileCalls)
+        return false ;
+    complete.store(true , memory_order_release) ;
+    return true ;
+}
+//---------------------------------------------------------------------------
+bool ValueProfile::isComplete() const {
+    return complete.load(memory_order_acquire) ;
+}
+//---------------------------------------------------------------------------
+std::unordered_map<size_t , int64_t> ValueProfile::stableParameters() const {
+    unordered_map<size_t , int64_t> parameters ;
+    if(!isComplete())
+        return parameters ;
+    unique_lock lock(profileMutex) ;
+    uint64_t counted = profileCalls - profileCalls / 2 ;
+    for(size_t index = 0 ; index < candidates.size() ; ++index)
+        if(matches[index] * 100 >= counted * STABLE_PERCENTAGE)
+            parameters.emplace(index , candidates[index]) ;
+    return parameters ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
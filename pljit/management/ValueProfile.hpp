@@ -0,0 +1,50 @@
+#ifndef PLJIT_VALUEPROFILE_HPP
+#define PLJIT_VALUEPROFILE_HPP
+//---------------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::management{
+//---------------------------------------------------------------------------
+/// observe argument values of the first calls of a function to find parameters which nearly always have the same value .
+/// first half of the calls elects a candidate value for each parameter (majority vote) , second half counts how often
+/// the candidate is passed
+class ValueProfile {
+    public:
+    // default number of profiled calls
+    static constexpr uint64_t DEFAULT_PROFILE_CALLS = 1000 ;
+    // percentage of calls in second half which must pass the candidate value
+    static constexpr uint64_t STABLE_PERCENTAGE = 90 ;
+
+    private:
+    // number of profiled calls (0 disables profiling)
+    uint64_t profileCalls ;
+    // set after last profiled call , checked without lock
+    std::atomic<bool> complete = false ;
+    // guards the counters below
+    mutable std::mutex profileMutex ;
+    uint64_t calls = 0 ;
+    // candidate value , votes of candidate (first half) and matches of candidate (second half) for each parameter
+    std::vector<int64_t> candidates ;
+    std::vector<uint64_t> votes ;
+    std::vector<uint64_t> matches ;
+
+    public:
+    explicit ValueProfile(uint64_t profileCalls = DEFAULT_PROFILE_CALLS) ;
+
+    /// record arguments of a call , return true for the call which completes profiling
+    bool record(const std::vector<int64_t>& parameterList) ;
+
+    /// check if all profiled calls are recorded
+    bool isComplete() const ;
+
+    /// parameters which passed their candidate value in most calls (parameter index -> value) , empty before completion
+    std::unordered_map<size_t , int64_t> stableParameters() const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::management
+//---------------------------------------------------------------------------
+#endif //PLJIT_VALUEPROFILE_HPP
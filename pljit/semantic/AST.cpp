@@ -2,8 +2,10 @@
 
 #include "pljit/semantic/ASTVisitor.hpp"
 #include "pljit/semantic/PrintASTVisitor.hpp"
+#include "pljit/semantic/SerializeASTVisitor.hpp"
 #include "pljit/semantic/EvaluationContext.hpp"
 #include "pljit/semantic/OptimizationASTVisitor.hpp"
+#include "pljit/syntax/Grammar.hpp"
 //---------------------------------------------------------------------------
 #include <unordered_set>
 //---------------------------------------------------------------------------
@@ -28,10 +30,10 @@ namespace {
     }
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<ExpressionAST> analyzeExpression(const AdditiveExpression& additiveExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables) ;
+    management::ResourcePointer<ExpressionAST> analyzeExpression(const AdditiveExpression& additiveExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource) ;
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<ExpressionAST> analyzeExpression(const PrimaryExpression& primaryExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables)
+    management::ResourcePointer<ExpressionAST> analyzeExpression(const PrimaryExpression& primaryExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource)
     // analyze primary expression of parse tree node to return ASTNode of an expression
     {
         // size(primary expression) = 1 for Identifier and Literal and = 3 for "(" additive-expression ")"
@@ -45,66 +47,66 @@ namespace {
             if(!symbolTable.isDeclared(identifier.print_token()))
             // trigger undeclared identifier
             {
-                manager->printSemanticError(identifier.getReference() , "Undeclared Identifier") ;
+                manager->printSemanticError(identifier.getReference() , Grammar::UNDECLARED_IDENTIFIER) ;
                 return nullptr;
             }
             else if(symbolTable.isVariable(identifier.print_token()) && !initializedVariables.contains(identifier.print_token()))
             // trigger uninitialized identifier
             {
-                manager->printSemanticError(identifier.getReference() , "Uninitialized Identifier") ;
+                manager->printSemanticError(identifier.getReference() , Grammar::UNINITIALIZED_IDENTIFIER) ;
                 return nullptr ;
             }
-            return make_unique<IdentifierAST>(identifier.getManager() , identifier.getReference()) ;
+            return management::make_resource<IdentifierAST>(resource , identifier.getManager() , identifier.getReference()) ;
         }
         else if(primaryExpression.getChild(0).getType() == ParseTreeNode::Type::LITERAL)
         // if primary expression is identifier
         {
 
             const Literal& literal = static_cast<const Literal&>(primaryExpression.getChild(0)) ;
-            return make_unique<LiteralAST>(literal.getManager() , literal.getReference()) ;
+            return management::make_resource<LiteralAST>(resource , literal.getManager() , literal.getReference()) ;
         }
         //  primary expression is additive-expression
         const AdditiveExpression& additiveExpression = static_cast<const AdditiveExpression&>(primaryExpression.getChild(1)) ;
-        return analyzeExpression(additiveExpression , symbolTable , initializedVariables) ;
+        return analyzeExpression(additiveExpression , symbolTable , initializedVariables , resource) ;
     }
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<ExpressionAST> analyzeExpression(const UnaryExpression& unaryExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables)
+    management::ResourcePointer<ExpressionAST> analyzeExpression(const UnaryExpression& unaryExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource)
     {
         if(unaryExpression.num_children() == 2)
         // there is a unary operator
         {
             const PrimaryExpression& primaryExpression = static_cast<const PrimaryExpression&>(unaryExpression.getChild(1));
-            auto child = analyzeExpression(primaryExpression , symbolTable , initializedVariables) ;
+            auto child = analyzeExpression(primaryExpression , symbolTable , initializedVariables , resource) ;
             if(child == nullptr)
                 return nullptr ;
             const syntax::GenericToken& genericToken = static_cast<const GenericToken&>(unaryExpression.getChild(0)) ;
             UnaryExpressionAST::UnaryType type = genericToken.print_token()[0]  == '+' ?
                                 UnaryExpressionAST::UnaryType::PLUS :UnaryExpressionAST::UnaryType::MINUS;
-            return make_unique<UnaryExpressionAST>(
+            return management::make_resource<UnaryExpressionAST>(resource ,
                 unaryExpression.getManager() , genericToken.getReference() , type ,
                 std::move(child)) ;
         }
         // only primary expression without unary operator
         const PrimaryExpression& primaryExpression = static_cast<const PrimaryExpression&>(unaryExpression.getChild(0));
-        return analyzeExpression(primaryExpression , symbolTable , initializedVariables) ;
+        return analyzeExpression(primaryExpression , symbolTable , initializedVariables , resource) ;
     }
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<ExpressionAST> analyzeExpression(const MultiplicativeExpression& multiplicativeExpression ,const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables) {
+    management::ResourcePointer<ExpressionAST> analyzeExpression(const MultiplicativeExpression& multiplicativeExpression ,const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource) {
         const UnaryExpression& unaryExpression = static_cast<const UnaryExpression&>(multiplicativeExpression.getChild(0)) ;
         // if there is no binary operator ("*" , "/")
         if(multiplicativeExpression.num_children() == 1)
-            return analyzeExpression(unaryExpression , symbolTable , initializedVariables) ;
+            return analyzeExpression(unaryExpression , symbolTable , initializedVariables , resource) ;
 
         // there is a binary operator ("*" , "/")
         const MultiplicativeExpression& anotherMultiplicativeExpression = static_cast<const MultiplicativeExpression&>(multiplicativeExpression.getChild(2)) ;
 
         // analyze left and right child recursively
-        auto leftChild = analyzeExpression(unaryExpression , symbolTable , initializedVariables) ;
+        auto leftChild = analyzeExpression(unaryExpression , symbolTable , initializedVariables , resource) ;
         if(leftChild == nullptr)
             return nullptr ;
-        auto rightChild = analyzeExpression(anotherMultiplicativeExpression , symbolTable , initializedVariables) ;
+        auto rightChild = analyzeExpression(anotherMultiplicativeExpression , symbolTable , initializedVariables , resource) ;
         if(rightChild == nullptr)
             return nullptr ;
 
@@ -113,8 +115,9 @@ namespace {
         char op = tokenOperator.print_token()[0] ;
         BinaryExpressionAST::BinaryType type = op == '*' ? BinaryExpressionAST::BinaryType::MULTIPLY :
                                                            BinaryExpressionAST::BinaryType::DIVIDE;
-        return make_unique<BinaryExpressionAST>
+        return management::make_resource<BinaryExpressionAST>
             (
+                resource ,
                 multiplicativeExpression.getManager() ,
                 type , std::move(leftChild)
                           ,  std::move(rightChild) , tokenOperator.getReference()
@@ -122,22 +125,22 @@ namespace {
     }
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<ExpressionAST> analyzeExpression(const AdditiveExpression& additiveExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables)
+    management::ResourcePointer<ExpressionAST> analyzeExpression(const AdditiveExpression& additiveExpression , const SymbolTable& symbolTable , const unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource)
     {
         const MultiplicativeExpression& multiplicativeExpression = static_cast<const MultiplicativeExpression&>(additiveExpression.getChild(0)) ;
 
         // if there is no binary operator ("+" , "-")
         if(additiveExpression.num_children() == 1)
-            return analyzeExpression(multiplicativeExpression , symbolTable ,initializedVariables) ;
+            return analyzeExpression(multiplicativeExpression , symbolTable ,initializedVariables , resource) ;
         // there is a binary operator ("*" , "/")
 
         const AdditiveExpression& anotherAdditiveExpression = static_cast<const AdditiveExpression&>(additiveExpression.getChild(2)) ;
 
         // analyze left and right child recursively
-        auto leftChild = analyzeExpression(multiplicativeExpression , symbolTable , initializedVariables)  ;
+        auto leftChild = analyzeExpression(multiplicativeExpression , symbolTable , initializedVariables , resource)  ;
         if(leftChild == nullptr)
             return nullptr ;
-        auto rightChild = analyzeExpression(anotherAdditiveExpression , symbolTable , initializedVariables) ;
+        auto rightChild = analyzeExpression(anotherAdditiveExpression , symbolTable , initializedVariables , resource) ;
         if(rightChild == nullptr)
             return nullptr ;
 
@@ -145,16 +148,17 @@ namespace {
         BinaryExpressionAST::BinaryType type = tokenOperator.print_token()[0]  == '+' ? BinaryExpressionAST::BinaryType::PLUS :
                                                            BinaryExpressionAST::BinaryType::MINUS;
 
-        return make_unique<BinaryExpressionAST>(
+        return management::make_resource<BinaryExpressionAST>(resource ,
             additiveExpression.getManager() ,
             type ,
             std::move(leftChild) ,
-            std::move(rightChild)
+            std::move(rightChild) ,
+            tokenOperator.getReference()
         ) ;
     }
     //---------------------------------------------------------------------------
     // nullptr if semantic error is triggered
-    unique_ptr<StatementAST> analyzeStatement(const Statement& parseTreeNode , const SymbolTable& symbolTable, unordered_set<string_view> &initializedVariables)
+    management::ResourcePointer<StatementAST> analyzeStatement(const Statement& parseTreeNode , const SymbolTable& symbolTable, unordered_set<string_view> &initializedVariables , std::pmr::memory_resource* resource)
     {
         management::CodeManager* codeManager = parseTreeNode.getManager() ;
         if(parseTreeNode.getChild(0).getType() == ParseTreeNode::Type::ASSIGNMENT_EXPRESSION)
@@ -165,26 +169,27 @@ namespace {
             if(!symbolTable.isDeclared(identifier.print_token()))
                 // if left-side identifier is undeclared variable , trigger semantic error
             {
-                identifier.getManager()->printSemanticError(identifier.getReference() , "Undeclared Identifier") ;
+                identifier.getManager()->printSemanticError(identifier.getReference() , Grammar::UNDECLARED_IDENTIFIER) ;
                 return nullptr ;
             }
             else if(symbolTable.isConstant(identifier.print_token()))
             // if left-side identifier is constant , trigger semantic error
             {
-                identifier.getManager()->printSemanticError(identifier.getReference() , "Constant Assignment") ;
+                identifier.getManager()->printSemanticError(identifier.getReference() , Grammar::CONSTANT_ASSIGNMENT) ;
                 return nullptr ;
             }
             // analyze right expression recursively
             const AdditiveExpression& additiveExpression = static_cast<const AdditiveExpression&>(assignmentExpression.getChild(2)) ;
-            auto rightExpression = analyzeExpression(additiveExpression , symbolTable , initializedVariables) ;
+            auto rightExpression = analyzeExpression(additiveExpression , symbolTable , initializedVariables , resource) ;
             if(rightExpression == nullptr)
                 return nullptr ;
             if(symbolTable.isVariable(identifier.print_token()))
                 initializedVariables.insert(identifier.print_token()) ;
-            return make_unique<AssignmentStatementAST>
+            return management::make_resource<AssignmentStatementAST>
                 (
+                    resource ,
                     codeManager ,
-                    make_unique<IdentifierAST>(identifier.getManager() , identifier.getReference()) ,
+                    management::make_resource<IdentifierAST>(resource , identifier.getManager() , identifier.getReference()) ,
                     std::move(rightExpression)
                 ) ;
         }
@@ -192,15 +197,58 @@ namespace {
         const AdditiveExpression& additiveExpression = static_cast<const AdditiveExpression&>(parseTreeNode.getChild(1)) ;
 
         // analyze expression of return statement recursively
-        auto child = analyzeExpression(additiveExpression , symbolTable , initializedVariables) ;
+        auto child = analyzeExpression(additiveExpression , symbolTable , initializedVariables , resource) ;
         if(child == nullptr)
             return nullptr ;
-        return make_unique<ReturnStatementAST>
+        return management::make_resource<ReturnStatementAST>
             (
+                resource ,
                 codeManager ,
                 std::move(child)
             );
     }
+    //---------------------------------------------------------------------------
+    /// count nodes of a tree
+    class CountASTVisitor final : public ASTVisitor {
+        public:
+        size_t count = 0 ;
+        //---------------------------------------------------------------------------
+        void visit(const FunctionAST& functionAst) override {
+            ++count ;
+            for(size_t index = 0 ; index < functionAst.num_statements() ; ++index)
+                functionAst.getStatement(index).accept(*this) ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const ReturnStatementAST& returnStatementAst) override {
+            ++count ;
+            returnStatementAst.getInput().accept(*this) ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const AssignmentStatementAST& assignmentStatementAst) override {
+            ++count ;
+            assignmentStatementAst.getLeftIdentifier().accept(*this) ;
+            assignmentStatementAst.getRightExpression().accept(*this) ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const BinaryExpressionAST& binaryExpressionAst) override {
+            ++count ;
+            binaryExpressionAst.getLeftExpression().accept(*this) ;
+            binaryExpressionAst.getRightExpression().accept(*this) ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const UnaryExpressionAST& unaryExpressionAst) override {
+            ++count ;
+            unaryExpressionAst.getInput().accept(*this) ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const IdentifierAST&) override {
+            ++count ;
+        }
+        //---------------------------------------------------------------------------
+        void visit(const LiteralAST&) override {
+            ++count ;
+        }
+    };
 //---------------------------------------------------------------------------
 } // anonymous namespace
 //---------------------------------------------------------------------------
@@ -218,7 +266,7 @@ bool SymbolTable::addAttributes(const ParameterDeclaration& declaration) {
                 parameter_index++ ;
             }
             else {
-                codeManager->printSemanticError(curChild.getReference() , "Already declared") ;
+                codeManager->printSemanticError(curChild.getReference() , Grammar::ALREADY_DECLARED) ;
                 isCompiled = false ;
                 return false ;
             }
@@ -233,9 +281,9 @@ bool SymbolTable::addAttributes(const VariableDeclaration& declaration) {
         const TerminalNode& curChild = static_cast<const TerminalNode&>(declaratorList.getChild(index)) ;
         if (curChild.getType() == ParseTreeNode::Type::IDENTIFIER) {
             if(!this->isDeclared(curChild.print_token()))
-                this->insert(curChild.print_token() , AttributeType::VARIABLE, curChild.getReference() , 0 , nullopt) ;
+                this->insert(curChild.print_token() , AttributeType::VARIABLE, curChild.getReference() , tableIdentifier[VARIABLE].size() , nullopt) ;
             else {
-                codeManager->printSemanticError(curChild.getReference() , "Already declared") ;
+                codeManager->printSemanticError(curChild.getReference() , Grammar::ALREADY_DECLARED) ;
                 isCompiled = false ;
                 return false ;
             }
@@ -254,10 +302,10 @@ bool SymbolTable::addAttributes(const ConstantDeclaration& declaration) {
             const Literal& literal = static_cast<const Literal&>(init_declarator.getChild(2)) ;
             int64_t value = str_to_int64(literal.print_token()) ;
             if(!isDeclared(identifier.print_token())) {
-                insert(identifier.print_token() , AttributeType::CONSTANT, identifier.getReference() , 0 , value);
+                insert(identifier.print_token() , AttributeType::CONSTANT, identifier.getReference() , tableIdentifier[CONSTANT].size() , value);
             }
             else {
-                codeManager->printSemanticError(identifier.getReference() , "Already declared") ;
+                codeManager->printSemanticError(identifier.getReference() , Grammar::ALREADY_DECLARED) ;
                 isCompiled = false ;
                 return false ;
             }
@@ -266,7 +314,8 @@ bool SymbolTable::addAttributes(const ConstantDeclaration& declaration) {
     return true ;
 }
 //---------------------------------------------------------------------------
-SymbolTable::SymbolTable(management::CodeManager* codeManager , const FunctionDeclaration& functionDeclaration) {
+SymbolTable::SymbolTable(management::CodeManager* codeManager , const FunctionDeclaration& functionDeclaration , std::pmr::memory_resource* resource)
+    : SymbolTable(resource) {
     this->codeManager = codeManager ;
     for(size_t index = 0 ; isCompiled  && index < functionDeclaration.num_children(); ++index) {
         const ParseTreeNode& curNode = functionDeclaration.getChild(index) ;
@@ -308,23 +357,80 @@ void SymbolTable::insert(std::string_view identifier , AttributeType type ,manag
     tableIdentifier[type][identifier] = make_tuple(codeReference , index , value) ;
 }
 //---------------------------------------------------------------------------
-const array<unordered_map<std::string_view, std::tuple<management::CodeReference, size_t, std::optional<int64_t>>> , 3>& SymbolTable::getTableContent() {
+const array<SymbolTable::IdentifierTable , 3>& SymbolTable::getTableContent() {
     return tableIdentifier ;
 }
-SymbolTable::SymbolTable() = default ;
+//---------------------------------------------------------------------------
+size_t SymbolTable::num_parameters() const {
+    return tableIdentifier[PARAMETER].size() ;
+}
+//---------------------------------------------------------------------------
+size_t SymbolTable::num_variables() const {
+    return tableIdentifier[VARIABLE].size() ;
+}
+//---------------------------------------------------------------------------
+size_t SymbolTable::num_constants() const {
+    return tableIdentifier[CONSTANT].size() ;
+}
+//---------------------------------------------------------------------------
+std::optional<size_t> SymbolTable::getSlot(std::string_view identifier) const {
+    size_t offset = 0 ;
+    for(size_t type = PARAMETER ; type <= CONSTANT ; ++type) {
+        auto it = tableIdentifier[type].find(identifier) ;
+        if(it != tableIdentifier[type].end())
+            return offset + get<1>(it->second) ;
+        offset += tableIdentifier[type].size() ;
+    }
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+std::string_view SymbolTable::getIdentifier(size_t slot) const {
+    for(size_t type = PARAMETER ; type <= CONSTANT ; ++type) {
+        if(slot < tableIdentifier[type].size()) {
+            for(auto &[identifier , metadata] : tableIdentifier[type])
+                if(get<1>(metadata) == slot)
+                    return identifier ;
+        }
+        else
+            slot -= tableIdentifier[type].size() ;
+    }
+    assert(false) ;
+    return {} ;
+}
+//---------------------------------------------------------------------------
+int64_t SymbolTable::getConstantValue(size_t slot) const {
+    assert(slot >= num_parameters() + num_variables()) ;
+    size_t index = slot - num_parameters() - num_variables() ;
+    for(auto &[identifier , metadata] : tableIdentifier[CONSTANT])
+        if(get<1>(metadata) == index)
+            return get<2>(metadata).value() ;
+    assert(false) ;
+    return 0 ;
+}
+//---------------------------------------------------------------------------
+std::string_view SymbolTable::addTemporary() {
+    // "$" is not part of any token , so the name is unique
+    temporaryNames.emplace_back("$" + to_string(temporaryNames.size())) ;
+    string_view identifier = temporaryNames.back() ;
+    insert(identifier , AttributeType::VARIABLE , management::CodeReference() , tableIdentifier[VARIABLE].size() , nullopt) ;
+    return identifier ;
+}
+//---------------------------------------------------------------------------
+SymbolTable::SymbolTable(std::pmr::memory_resource* resource)
+    : temporaryNames(resource) , tableIdentifier{IdentifierTable(resource) , IdentifierTable(resource) , IdentifierTable(resource)} {}
 //---------------------------------------------------------------------------
 ASTNode::ASTType FunctionAST::getAstType() const{
     return ASTNode::ASTType::FUNCTION ;
 }
 //---------------------------------------------------------------------------
-FunctionAST::FunctionAST(management::CodeManager* manager) {
+FunctionAST::FunctionAST(management::CodeManager* manager , std::pmr::memory_resource* resource) : children(resource) , symbolTable(resource) {
     this->codeManager = manager ;
     node_index = node_index_incrementer++ ;
 }
 //---------------------------------------------------------------------------
 bool FunctionAST::compileCode(const FunctionDeclaration& functionDeclaration) {
     // add declarations
-    symbolTable = SymbolTable(codeManager , functionDeclaration) ;
+    symbolTable = SymbolTable(codeManager , functionDeclaration , children.get_allocator().resource()) ;
     // check if declarations compiled
     if(!symbolTable.isComplied())
         return false ;
@@ -355,7 +461,7 @@ bool FunctionAST::compileCode(const FunctionDeclaration& functionDeclaration) {
         {
             const Statement &statement = static_cast<const Statement&>(statementList.getChild(statement_index));
             // analyze each statement recursively and get ASTNode of current statement
-            auto child = analyzeStatement(statement , symbolTable , initializedVariables) ;
+            auto child = analyzeStatement(statement , symbolTable , initializedVariables , children.get_allocator().resource()) ;
             if(child == nullptr)
                 return false ;
 
@@ -369,7 +475,7 @@ bool FunctionAST::compileCode(const FunctionDeclaration& functionDeclaration) {
     {
         const syntax::GenericToken& endToken = static_cast<const GenericToken&>(compoundStatement.getChild(2)) ;
         management::CodeReference endReference = endToken.getReference();
-        codeManager->printSemanticError(endReference , "Missing Return Statement") ;
+        codeManager->printSemanticError(endReference , Grammar::MISSING_RETURN) ;
         return false ;
     }
     return true;
@@ -383,13 +489,25 @@ std::size_t FunctionAST::num_statements() const {
     return children.size() ;
 }
 //---------------------------------------------------------------------------
+std::size_t FunctionAST::num_nodes() const {
+    CountASTVisitor countVisitor ;
+    this->accept(countVisitor) ;
+    return countVisitor.count ;
+}
+//---------------------------------------------------------------------------
+std::string FunctionAST::serialize(management::ArithmeticMode arithmeticMode) const {
+    SerializeASTVisitor serializeVisitor(arithmeticMode) ;
+    this->accept(serializeVisitor) ;
+    return serializeVisitor.getOutput() ;
+}
+//---------------------------------------------------------------------------
 void FunctionAST::accept(ASTVisitor& astVisitor) const {
     astVisitor.visit(*this) ;
 }
 //---------------------------------------------------------------------------
 std::optional<int64_t> FunctionAST::evaluate(EvaluationContext& evaluationContext) const {
 
-    for(const unique_ptr<StatementAST> & statementAst : children)
+    for(const management::ResourcePointer<StatementAST> & statementAst : children)
     /// iterate over each statement
     {
         /// return evaluation if return statement
@@ -421,7 +539,7 @@ ASTNode::ASTType AssignmentStatementAST::getAstType() const {
 AssignmentStatementAST::AssignmentStatementAST(management::CodeManager* manager) : StatementAST(manager)
 {}
 //---------------------------------------------------------------------------
-AssignmentStatementAST::AssignmentStatementAST(management::CodeManager* manager, std::unique_ptr<IdentifierAST> left, std::unique_ptr<ExpressionAST> right) : AssignmentStatementAST(manager){
+AssignmentStatementAST::AssignmentStatementAST(management::CodeManager* manager, management::ResourcePointer<IdentifierAST> left, management::ResourcePointer<ExpressionAST> right) : AssignmentStatementAST(manager){
     this->leftIdentifier = std::move(left) ;
     this->rightExpression = std::move(right) ;
 }
@@ -446,13 +564,13 @@ std::optional<int64_t> AssignmentStatementAST::acceptOptimization(OptimizationVi
     return astVisitor.visitOptimization(*this) ;
 }
 //---------------------------------------------------------------------------
-AssignmentStatementAST::AssignmentStatementAST(std::unique_ptr<IdentifierAST> left, std::unique_ptr<ExpressionAST> right) : leftIdentifier(std::move(left)) , rightExpression(std::move(right)) {}
+AssignmentStatementAST::AssignmentStatementAST(management::ResourcePointer<IdentifierAST> left, management::ResourcePointer<ExpressionAST> right) : leftIdentifier(std::move(left)) , rightExpression(std::move(right)) {}
 //---------------------------------------------------------------------------
 ASTNode::ASTType ReturnStatementAST::getAstType() const {
     return ASTNode::ASTType::RETURN_STATEMENT;
 }
 //---------------------------------------------------------------------------
-ReturnStatementAST::ReturnStatementAST(management::CodeManager* manager, std::unique_ptr<ExpressionAST> input) : StatementAST(manager) {
+ReturnStatementAST::ReturnStatementAST(management::CodeManager* manager, management::ResourcePointer<ExpressionAST> input) : StatementAST(manager) {
     this->input = std::move(input) ;
 }
 //---------------------------------------------------------------------------
@@ -476,7 +594,7 @@ ASTNode::ASTType BinaryExpressionAST::getAstType() const {
     return ASTNode::ASTType::BINARY_EXPRESSION;
 }
 //---------------------------------------------------------------------------
-BinaryExpressionAST::BinaryExpressionAST(management::CodeManager* manager, BinaryExpressionAST::BinaryType type, std::unique_ptr<ExpressionAST> left, std::unique_ptr<ExpressionAST> right) : ExpressionAST(manager){
+BinaryExpressionAST::BinaryExpressionAST(management::CodeManager* manager, BinaryExpressionAST::BinaryType type, management::ResourcePointer<ExpressionAST> left, management::ResourcePointer<ExpressionAST> right) : ExpressionAST(manager){
     this->binaryType = type ;
     this->leftExpression = std::move(left) ;
     this->rightExpression = std::move(right) ;
@@ -505,28 +623,40 @@ std::optional<int64_t> BinaryExpressionAST::evaluate(EvaluationContext& evaluati
     if(!leftResult.has_value() || !rightResult.has_value())
         // if runtime error is triggered
         return nullopt ;
+    int64_t left = leftResult.value() , right = rightResult.value() ;
+    if(getBinaryType() == BinaryType::DIVIDE && right == 0) {
+        // trigger runtime error given position of "/" operator
+        codeManager->printDivZeroError(codeReference);
+        return nullopt ;
+    }
     // evaluate current binary expression
-    switch (getBinaryType()) {
-        case BinaryType::PLUS: return leftResult.value() + rightResult.value();
-        case BinaryType::MINUS: return leftResult.value() - rightResult.value();
-        case BinaryType::MULTIPLY: return leftResult.value() * rightResult.value();
-        case BinaryType::DIVIDE: {
-            if(rightResult.value() == 0) {
-                // trigger runtime error given position of "/" operator
-                codeManager->printDivZeroError(codeReference);
-                return nullopt ;
-            }
-            return leftResult.value() / rightResult.value() ;
+    if(evaluationContext.getArithmeticMode() == management::ArithmeticMode::WRAPAROUND) {
+        switch (getBinaryType()) {
+            case BinaryType::PLUS: return management::wrapping_add(left , right) ;
+            case BinaryType::MINUS: return management::wrapping_subtract(left , right) ;
+            case BinaryType::MULTIPLY: return management::wrapping_multiply(left , right) ;
+            case BinaryType::DIVIDE: return management::wrapping_divide(left , right) ;
         }
+        return nullopt ;
     }
-    return nullopt;
+    optional<int64_t> result ;
+    switch (getBinaryType()) {
+        case BinaryType::PLUS: result = management::checked_add(left , right) ; break ;
+        case BinaryType::MINUS: result = management::checked_subtract(left , right) ; break ;
+        case BinaryType::MULTIPLY: result = management::checked_multiply(left , right) ; break ;
+        case BinaryType::DIVIDE: result = management::checked_divide(left , right) ; break ;
+    }
+    if(!result.has_value())
+        // trigger runtime error given position of operator
+        codeManager->printOverflowError(codeReference) ;
+    return result ;
 }
 //---------------------------------------------------------------------------
 std::optional<int64_t> BinaryExpressionAST::acceptOptimization(OptimizationVisitor& astVisitor) {
     return astVisitor.visitOptimization(*this) ;
 }
 //---------------------------------------------------------------------------
-BinaryExpressionAST::BinaryExpressionAST(management::CodeManager* manager, BinaryExpressionAST::BinaryType type, std::unique_ptr<ExpressionAST> left, std::unique_ptr<ExpressionAST> right, management::CodeReference reference) : BinaryExpressionAST(manager , type , std::move(left) , std::move(right)){
+BinaryExpressionAST::BinaryExpressionAST(management::CodeManager* manager, BinaryExpressionAST::BinaryType type, management::ResourcePointer<ExpressionAST> left, management::ResourcePointer<ExpressionAST> right, management::CodeReference reference) : BinaryExpressionAST(manager , type , std::move(left) , std::move(right)){
     codeReference = reference ;
 }
 //---------------------------------------------------------------------------
@@ -534,7 +664,7 @@ ASTNode::ASTType UnaryExpressionAST::getAstType() const {
     return ASTNode::ASTType::UNARY_EXPRESSION;
 }
 //---------------------------------------------------------------------------
-UnaryExpressionAST::UnaryExpressionAST(management::CodeManager* manager, management::CodeReference codeReference1, UnaryExpressionAST::UnaryType type, std::unique_ptr<ExpressionAST> input) : ExpressionAST(manager , codeReference1){
+UnaryExpressionAST::UnaryExpressionAST(management::CodeManager* manager, management::CodeReference codeReference1, UnaryExpressionAST::UnaryType type, management::ResourcePointer<ExpressionAST> input) : ExpressionAST(manager , codeReference1){
     this->unaryType = type ;
     this->input = std::move(input);
 }
@@ -555,8 +685,14 @@ std::optional<int64_t> UnaryExpressionAST::evaluate(EvaluationContext& evaluatio
     optional<int64_t> result = input->evaluate(evaluationContext) ;
     if(!result.has_value())
         return nullopt ;
-    if(getUnaryType() == UnaryType::MINUS)
-        return -result.value() ;
+    if(getUnaryType() == UnaryType::PLUS)
+        return result ;
+    if(evaluationContext.getArithmeticMode() == management::ArithmeticMode::WRAPAROUND)
+        return management::wrapping_negate(result.value()) ;
+    result = management::checked_negate(result.value()) ;
+    if(!result.has_value())
+        // trigger runtime error given position of "-" operator
+        codeManager->printOverflowError(codeReference) ;
     return result ;
 }
 //---------------------------------------------------------------------------
@@ -569,13 +705,18 @@ ASTNode::ASTType IdentifierAST::getAstType() const {
 }
 //---------------------------------------------------------------------------
 IdentifierAST::IdentifierAST(management::CodeManager* manager, management::CodeReference codeReference) : ExpressionAST(manager, codeReference)
-{}
-//---------------------------------------------------------------------------
-std::string_view IdentifierAST::print_token() const {
+{
     size_t line  = codeReference.getStartLineRange().first ;
     size_t begin = codeReference.getStartLineRange().second ;
     size_t last = codeReference.getEndLineRange().second ;
-    return codeManager->getCurrentLine(line).substr(begin , last - begin + 1) ;
+    name = codeManager->getCurrentLine(line).substr(begin , last - begin + 1) ;
+}
+//---------------------------------------------------------------------------
+IdentifierAST::IdentifierAST(management::CodeManager* manager , std::string_view name) : ExpressionAST(manager) , name(name)
+{}
+//---------------------------------------------------------------------------
+std::string_view IdentifierAST::print_token() const {
+    return name ;
 }
 //---------------------------------------------------------------------------
 void IdentifierAST::accept(ASTVisitor& astVisitor) const {
@@ -625,9 +766,22 @@ size_t ASTNode::getNodeID() const{
     return node_index;
 }
 //---------------------------------------------------------------------------
-SymbolTable& ASTNode::getSymbolTable()  {
+SymbolTable& FunctionAST::getSymbolTable()  {
+    return symbolTable ;
+}
+//---------------------------------------------------------------------------
+const SymbolTable& FunctionAST::getSymbolTable() const {
     return symbolTable ;
 }
+//---------------------------------------------------------------------------
+management::CodeReference ASTNode::getReference() const {
+    return codeReference ;
+}
+//---------------------------------------------------------------------------
+management::CodeManager* ASTNode::getManager() const {
+    return codeManager ;
+}
+//---------------------------------------------------------------------------
 std::string ASTNode::visualizeDot() const {
     semantic::VisualizeASTVisitor printVisitor ;
     this->accept(printVisitor) ;
@@ -1,9 +1,13 @@
 #ifndef PLJIT_AST_HPP
 #define PLJIT_AST_HPP
 //---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
 #include "pljit/syntax/ParseTree.hpp"
 //---------------------------------------------------------------------------
+#include <array>
 #include <cassert>
+#include <deque>
+#include <memory_resource>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -18,22 +22,23 @@ class EvaluationContext ;
 class OptimizationVisitor ;
 //---------------------------------------------------------------------------
 class SymbolTable {
+    public:
+    /// identifiers of one kind of declaration
+    using IdentifierTable = std::pmr::unordered_map<std::string_view , std::tuple<management::CodeReference , size_t , std::optional<int64_t>>> ;
+
     private:
     // check if declarations is compiled correctly
     bool isCompiled = true ;
     management::CodeManager* codeManager{} ;
+    // names of compiler generated variables (deque keeps string_views of table identifier valid)
+    std::pmr::deque<std::pmr::string> temporaryNames ;
 
     // tableIdentifier
     /// array of unordered_map : size = 3 , index=0 -> parameter_ids , index=1 -> variable_ids , index=2 -> constant_ids
     /// unordered_map : key -> identifier -> type(string_view) , value -> tuple(codeRef , index_of declaration list , value of constant declaration)
     /// get<0>(e) = code_ref , get<1>(e) = index in declaration list ,
     /// get<2>(e) = value (for const declaration only)
-    std::array
-        <
-            std::unordered_map<std::string_view , std::tuple<management::CodeReference , size_t , std::optional<int64_t>>>
-        ,
-            3
-        > tableIdentifier ;
+    std::array<IdentifierTable , 3> tableIdentifier ;
 
     enum AttributeType {
         PARAMETER,
@@ -52,10 +57,12 @@ class SymbolTable {
     void insert(std::string_view identifier , AttributeType type, management::CodeReference codeReference , size_t index /*for parameter*/, std::optional<int64_t> value) ;
 
     public:
-    SymbolTable() ;
+    // empty symbol table , identifiers are allocated from resource
+    explicit SymbolTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     // construct symbol table given parse tree node
-    explicit SymbolTable(management::CodeManager* codeManager , const syntax::FunctionDeclaration& functionDeclaration) ;
+    explicit SymbolTable(management::CodeManager* codeManager , const syntax::FunctionDeclaration& functionDeclaration ,
+                         std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
     // check if identifier is declared
     bool isDeclared(std::string_view identifier) const ;
     //check if identifier is a constant declaration
@@ -65,7 +72,19 @@ class SymbolTable {
     // check if source code declarations is compiled
     bool isComplied() const ;
     // get symbol table
-    const std::array<std::unordered_map<std::string_view , std::tuple<management::CodeReference , size_t , std::optional<int64_t>>> , 3> & getTableContent()  ;
+    const std::array<IdentifierTable , 3> & getTableContent()  ;
+    // number of parameter , variable and constant declarations
+    size_t num_parameters() const ;
+    size_t num_variables() const ;
+    size_t num_constants() const ;
+    /// frame slot of a declared identifier : parameters first , then variables , then constants (each in declaration order)
+    std::optional<size_t> getSlot(std::string_view identifier) const ;
+    /// declared identifier stored in given frame slot
+    std::string_view getIdentifier(size_t slot) const ;
+    /// value of constant declaration stored in given frame slot
+    int64_t getConstantValue(size_t slot) const ;
+    /// declare compiler generated variable , its name cannot clash with identifiers of source code
+    std::string_view addTemporary() ;
 };
 
 class ASTNode {
@@ -73,9 +92,7 @@ class ASTNode {
         // reference for terminal token with represent ASTNode
         management::CodeReference codeReference ;
         // codeManager
-        management::CodeManager* codeManager ;
-        // SymbolTable
-        SymbolTable symbolTable ;
+        management::CodeManager* codeManager {} ;
         // node identifier
         size_t node_index ;
         static size_t node_index_incrementer ;
@@ -108,8 +125,11 @@ class ASTNode {
     // get ASTNode unique id
     size_t getNodeID() const ;
 
-    // get symbol table
-    SymbolTable& getSymbolTable()  ;
+    // get reference for terminal token which represents ASTNode
+    management::CodeReference getReference() const ;
+
+    // return pointer for code manager
+    management::CodeManager* getManager() const ;
 
     /// print dot format with labels to use it for visualization to display physical graph nodes
     std::string visualizeDot() const ;
@@ -121,12 +141,14 @@ class ASTNode {
 
 };
 class FunctionAST final : public ASTNode {
-    // statements of function node
-    std::vector<std::unique_ptr<StatementAST>> children ;
+    // statements of function node , statements and their nodes are allocated from the resource of this list
+    std::pmr::vector<management::ResourcePointer<StatementAST>> children ;
+    // declarations of function
+    SymbolTable symbolTable ;
     friend class OptimizationVisitor ;
     public:
 
-    explicit FunctionAST(management::CodeManager* manager) ;
+    explicit FunctionAST(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     ASTNode::ASTType getAstType() const override;
 
@@ -141,6 +163,13 @@ class FunctionAST final : public ASTNode {
     const StatementAST& getStatement(size_t index) const ;
     // get number of statements
     std::size_t num_statements() const ;
+    // get number of nodes of the whole tree (including this node)
+    std::size_t num_nodes() const ;
+    /// binary encoding of function which can be evaluated by SerializedFunction with given semantics of overflow
+    std::string serialize(management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND) const ;
+    // get symbol table
+    SymbolTable& getSymbolTable()  ;
+    const SymbolTable& getSymbolTable() const ;
 };
 class StatementAST : public ASTNode {
     protected:
@@ -156,13 +185,13 @@ class ExpressionAST  : public ASTNode {
 };
 class ReturnStatementAST final :public StatementAST {
     // expression of return statement
-    std::unique_ptr<ExpressionAST> input ;
+    management::ResourcePointer<ExpressionAST> input ;
     friend class OptimizationVisitor ;
     public:
     explicit ReturnStatementAST
-        (management::CodeManager* manager  , std::unique_ptr<ExpressionAST> input) ;
+        (management::CodeManager* manager  , management::ResourcePointer<ExpressionAST> input) ;
 
-    explicit ReturnStatementAST (std::unique_ptr<ExpressionAST> input) : input(std::move(input)){}
+    explicit ReturnStatementAST (management::ResourcePointer<ExpressionAST> input) : input(std::move(input)){}
 
     // get expression of return statement
     const ExpressionAST& getInput() const ;
@@ -177,20 +206,20 @@ class ReturnStatementAST final :public StatementAST {
 };
 class AssignmentStatementAST final : public StatementAST {
     // assigned identifier in assignment statement
-    std::unique_ptr<IdentifierAST> leftIdentifier ;
+    management::ResourcePointer<IdentifierAST> leftIdentifier ;
     // expression which is assigned to leftIdentifier
-    std::unique_ptr<ExpressionAST> rightExpression ;
+    management::ResourcePointer<ExpressionAST> rightExpression ;
 
     friend class OptimizationVisitor ;
     public:
     explicit AssignmentStatementAST(management::CodeManager* manager);
 
     explicit AssignmentStatementAST(management::CodeManager* manager ,
-                                    std::unique_ptr<IdentifierAST> left ,
-                                    std::unique_ptr<ExpressionAST> right
+                                    management::ResourcePointer<IdentifierAST> left ,
+                                    management::ResourcePointer<ExpressionAST> right
                                     );
     explicit AssignmentStatementAST
-        (std::unique_ptr<IdentifierAST> left , std::unique_ptr<ExpressionAST> right) ;
+        (management::ResourcePointer<IdentifierAST> left , management::ResourcePointer<ExpressionAST> right) ;
     // get left-side identifier of assignment statement
     const IdentifierAST& getLeftIdentifier() const ;
     // get right-side expression of assignment statement
@@ -207,9 +236,9 @@ class AssignmentStatementAST final : public StatementAST {
 };
 class BinaryExpressionAST final : public ExpressionAST {
     // left Expression of binary expression
-    std::unique_ptr<ExpressionAST> leftExpression ;
+    management::ResourcePointer<ExpressionAST> leftExpression ;
     // right Expression of binary expression
-    std::unique_ptr<ExpressionAST> rightExpression ;
+    management::ResourcePointer<ExpressionAST> rightExpression ;
 
     friend class OptimizationVisitor ;
     public:
@@ -223,10 +252,10 @@ class BinaryExpressionAST final : public ExpressionAST {
     BinaryType binaryType ;
     public:
     explicit BinaryExpressionAST
-        (management::CodeManager* manager , BinaryType type , std::unique_ptr<ExpressionAST> left , std::unique_ptr<ExpressionAST> right) ;
+        (management::CodeManager* manager , BinaryType type , management::ResourcePointer<ExpressionAST> left , management::ResourcePointer<ExpressionAST> right) ;
 
     explicit BinaryExpressionAST
-        (management::CodeManager* manager , BinaryType type , std::unique_ptr<ExpressionAST> left , std::unique_ptr<ExpressionAST> right , management::CodeReference reference) ;
+        (management::CodeManager* manager , BinaryType type , management::ResourcePointer<ExpressionAST> left , management::ResourcePointer<ExpressionAST> right , management::CodeReference reference) ;
 
     // get operator of binary expression
     BinaryType getBinaryType() const ;
@@ -246,7 +275,7 @@ class BinaryExpressionAST final : public ExpressionAST {
 };
 class UnaryExpressionAST final : public ExpressionAST {
     // expression of unary expression
-    std::unique_ptr<ExpressionAST> input ;
+    management::ResourcePointer<ExpressionAST> input ;
     friend class OptimizationVisitor ;
     public:
     enum class UnaryType {
@@ -258,7 +287,7 @@ class UnaryExpressionAST final : public ExpressionAST {
     UnaryType unaryType ;
     public:
     explicit UnaryExpressionAST
-        (management::CodeManager* manager  , management::CodeReference codeReference1 , UnaryType type , std::unique_ptr<ExpressionAST> input) ;
+        (management::CodeManager* manager  , management::CodeReference codeReference1 , UnaryType type , management::ResourcePointer<ExpressionAST> input) ;
     // get operator of unary expression
     UnaryType getUnaryType() const ;
     // get expression of unary expression
@@ -273,11 +302,16 @@ class UnaryExpressionAST final : public ExpressionAST {
     std::optional<int64_t> acceptOptimization(OptimizationVisitor& astVisitor)  override ;
 };
 class IdentifierAST final: public ExpressionAST {
+    // identifier token (source code or name of compiler generated variable)
+    std::string_view name ;
 
     public:
     explicit IdentifierAST
         (management::CodeManager* manager , management::CodeReference codeReference) ;
 
+    // identifier of compiler generated variable (without reference in source code)
+    IdentifierAST(management::CodeManager* manager , std::string_view name) ;
+
     // print identifier
     std::string_view print_token() const;
 
@@ -0,0 +1,219 @@
+#include "pljit/semantic/ClosureASTVisitor.hpp"
+#include "pljit/semantic/AST.hpp"
+//---------------------------------------------------------------------------
+#include <cassert>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    using Frame = ClosureFunction::Frame ;
+    //---------------------------------------------------------------------------
+    // operand stored in frame slot
+    struct SlotOperand {
+        size_t slot ;
+        int64_t operator()(Frame& frame) const { return frame.slots[slot] ; }
+    };
+    // literal or declared constant
+    struct ConstantOperand {
+        int64_t value ;
+        int64_t operator()(Frame& /*frame*/) const { return value ; }
+    };
+    // operand computed by closure of a nested expression
+    struct NestedOperand {
+        ClosureFunction::Expression expression ;
+        int64_t operator()(Frame& frame) const { return expression(frame) ; }
+    };
+    //---------------------------------------------------------------------------
+    optional<int64_t> constant_value(const ExpressionAST& expression , const SymbolTable& symbolTable)
+    /// value of literal or identifier of constant declaration
+    {
+        if(expression.getAstType() == ASTNode::ASTType::LITERAL)
+            return static_cast<const LiteralAST&>(expression).getValue() ;
+        if(expression.getAstType() != ASTNode::ASTType::IDENTIFIER)
+            return nullopt ;
+        string_view identifier = static_cast<const IdentifierAST&>(expression).print_token() ;
+        if(!symbolTable.isConstant(identifier))
+            return nullopt ;
+        return symbolTable.getConstantValue(symbolTable.getSlot(identifier).value()) ;
+    }
+    //---------------------------------------------------------------------------
+    template<typename Function>
+    auto checked_operation(Function function , uint32_t overflowError)
+    /// operation of checked arithmetic , records overflowError if result does not fit into int64_t
+    {
+        return [function , overflowError](Frame& frame , int64_t left , int64_t right) -> int64_t {
+            optional<int64_t> result = function(left , right) ;
+            if(!result.has_value()) {
+                frame.fail(overflowError) ;
+                return 0 ;
+            }
+            return result.value() ;
+        } ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+ClosureASTVisitor::ClosureASTVisitor(ClosureFunction& function , management::ArithmeticMode arithmeticMode)
+    : function(function) , arithmeticMode(arithmeticMode) {}
+//---------------------------------------------------------------------------
+uint32_t ClosureASTVisitor::addRuntimeError(management::CodeReference reference , bool overflow) {
+    function.runtimeErrors.push_back({reference , overflow}) ;
+    return static_cast<uint32_t>(function.runtimeErrors.size() - 1) ;
+}
+//---------------------------------------------------------------------------
+template<typename Visitor>
+void ClosureASTVisitor::withOperand(const ExpressionAST& expression , Visitor&& visitor) {
+    if(optional<int64_t> value = constant_value(expression , *symbolTable))
+        visitor(ConstantOperand{value.value()}) ;
+    else if(expression.getAstType() == ASTNode::ASTType::IDENTIFIER) {
+        optional<size_t> slot = symbolTable->getSlot(static_cast<const IdentifierAST&>(expression).print_token()) ;
+        assert(slot.has_value()) ;
+        visitor(SlotOperand{slot.value()}) ;
+    }
+    else {
+        expression.accept(*this) ;
+        visitor(NestedOperand{std::move(result)}) ;
+    }
+}
+//---------------------------------------------------------------------------
+template<typename Operation>
+void ClosureASTVisitor::lowerBinary(const ExpressionAST& left , const ExpressionAST& right , Operation operation) {
+    // one closure per combination of operand shapes , operands are evaluated from left to right
+    withOperand(left , [&](auto leftOperand) {
+        withOperand(right , [&](auto rightOperand) {
+            result = [leftOperand = std::move(leftOperand) , rightOperand = std::move(rightOperand) , operation](Frame& frame) {
+                int64_t leftValue = leftOperand(frame) ;
+                int64_t rightValue = rightOperand(frame) ;
+                return operation(frame , leftValue , rightValue) ;
+            } ;
+        }) ;
+    }) ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const FunctionAST& functionAst) {
+    symbolTable = &functionAst.getSymbolTable() ;
+    returnTriggered = false ;
+    function.numParameters = symbolTable->num_parameters() ;
+    function.numSlots = symbolTable->num_parameters() + symbolTable->num_variables() ;
+    function.codeManager = functionAst.getManager() ;
+    for(size_t index = 0 ; index < functionAst.num_statements() && !returnTriggered ; ++index)
+        functionAst.getStatement(index).accept(*this) ;
+    assert(returnTriggered) ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const ReturnStatementAST& returnStatementAst) {
+    returnStatementAst.getInput().accept(*this) ;
+    function.result = std::move(result) ;
+    returnTriggered = true ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const AssignmentStatementAST& assignmentStatementAst) {
+    assignmentStatementAst.getRightExpression().accept(*this) ;
+    optional<size_t> slot = symbolTable->getSlot(assignmentStatementAst.getLeftIdentifier().print_token()) ;
+    assert(slot.has_value()) ;
+    function.assignments.emplace_back(slot.value() , std::move(result)) ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const BinaryExpressionAST& binaryExpressionAst) {
+    using BinaryType = BinaryExpressionAST::BinaryType ;
+    const ExpressionAST& left = binaryExpressionAst.getLeftExpression() ;
+    const ExpressionAST& right = binaryExpressionAst.getRightExpression() ;
+    management::CodeReference reference = binaryExpressionAst.getReference() ;
+    // division by non zero constant cannot trigger divide by zero
+    optional<int64_t> divisor = constant_value(right , *symbolTable) ;
+    bool checkDivisor = !divisor.has_value() || divisor.value() == 0 ;
+
+    if(arithmeticMode == management::ArithmeticMode::WRAPAROUND) {
+        switch (binaryExpressionAst.getBinaryType()) {
+            case BinaryType::PLUS:
+                lowerBinary(left , right , [](Frame& /*frame*/ , int64_t a , int64_t b) { return management::wrapping_add(a , b) ; }) ;
+                break ;
+            case BinaryType::MINUS:
+                lowerBinary(left , right , [](Frame& /*frame*/ , int64_t a , int64_t b) { return management::wrapping_subtract(a , b) ; }) ;
+                break ;
+            case BinaryType::MULTIPLY:
+                lowerBinary(left , right , [](Frame& /*frame*/ , int64_t a , int64_t b) { return management::wrapping_multiply(a , b) ; }) ;
+                break ;
+            case BinaryType::DIVIDE:
+                if(!checkDivisor) {
+                    lowerBinary(left , right , [](Frame& /*frame*/ , int64_t a , int64_t b) { return management::wrapping_divide(a , b) ; }) ;
+                    break ;
+                }
+                lowerBinary(left , right , [zeroError = addRuntimeError(reference , false)](Frame& frame , int64_t a , int64_t b) -> int64_t {
+                    if(b == 0) {
+                        frame.fail(zeroError) ;
+                        return 0 ;
+                    }
+                    return management::wrapping_divide(a , b) ;
+                }) ;
+                break ;
+        }
+        return ;
+    }
+    switch (binaryExpressionAst.getBinaryType()) {
+        case BinaryType::PLUS:
+            lowerBinary(left , right , checked_operation(management::checked_add , addRuntimeError(reference , true))) ;
+            break ;
+        case BinaryType::MINUS:
+            lowerBinary(left , right , checked_operation(management::checked_subtract , addRuntimeError(reference , true))) ;
+            break ;
+        case BinaryType::MULTIPLY:
+            lowerBinary(left , right , checked_operation(management::checked_multiply , addRuntimeError(reference , true))) ;
+            break ;
+        case BinaryType::DIVIDE: {
+            auto divide = checked_operation(management::checked_divide , addRuntimeError(reference , true)) ;
+            if(!checkDivisor) {
+                lowerBinary(left , right , divide) ;
+                break ;
+            }
+            lowerBinary(left , right , [divide , zeroError = addRuntimeError(reference , false)](Frame& frame , int64_t a , int64_t b) -> int64_t {
+                if(b == 0) {
+                    frame.fail(zeroError) ;
+                    return 0 ;
+                }
+                return divide(frame , a , b) ;
+            }) ;
+        }
+        break ;
+    }
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const UnaryExpressionAST& unaryExpressionAst) {
+    const ExpressionAST& input = unaryExpressionAst.getInput() ;
+    if(unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::PLUS) {
+        input.accept(*this) ;
+        return ;
+    }
+    if(arithmeticMode == management::ArithmeticMode::WRAPAROUND) {
+        withOperand(input , [&](auto operand) {
+            result = [operand = std::move(operand)](Frame& frame) { return management::wrapping_negate(operand(frame)) ; } ;
+        }) ;
+        return ;
+    }
+    uint32_t overflowError = addRuntimeError(unaryExpressionAst.getReference() , true) ;
+    withOperand(input , [&](auto operand) {
+        result = [operand = std::move(operand) , overflowError](Frame& frame) -> int64_t {
+            optional<int64_t> value = management::checked_negate(operand(frame)) ;
+            if(!value.has_value()) {
+                frame.fail(overflowError) ;
+                return 0 ;
+            }
+            return value.value() ;
+        } ;
+    }) ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const IdentifierAST& identifierAst) {
+    withOperand(identifierAst , [&](auto operand) { result = std::move(operand) ; }) ;
+}
+//---------------------------------------------------------------------------
+void ClosureASTVisitor::visit(const LiteralAST& literalAst) {
+    result = ConstantOperand{literalAst.getValue()} ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
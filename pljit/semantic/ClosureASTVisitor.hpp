@@ -0,0 +1,55 @@
+#ifndef PLJIT_CLOSUREASTVISITOR_HPP
+#define PLJIT_CLOSUREASTVISITOR_HPP
+//---------------------------------------------------------------------------
+#include "pljit/semantic/ASTVisitor.hpp"
+#include "pljit/semantic/ClosureFunction.hpp"
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+class ExpressionAST ;
+class SymbolTable ;
+//---------------------------------------------------------------------------
+/// lower FunctionAST into closures of ClosureFunction , leaf operands (slots and constants) of unary and binary
+/// expressions are inlined into the closure of their parent
+class ClosureASTVisitor final : public ASTVisitor {
+    // lowered function
+    ClosureFunction& function ;
+    // semantics of overflowing operators
+    management::ArithmeticMode arithmeticMode ;
+    // symbol table of visited function to map identifiers to slots and constants
+    const SymbolTable* symbolTable = nullptr ;
+    // closure of last visited expression
+    ClosureFunction::Expression result ;
+    // stop lowering after first return statement (remaining statements are dead code)
+    bool returnTriggered = false ;
+
+    /// register operator which may trigger a runtime error , return its index
+    uint32_t addRuntimeError(management::CodeReference reference , bool overflow) ;
+    /// call visitor with operand of expression : slot , constant or nested closure
+    template<typename Visitor>
+    void withOperand(const ExpressionAST& expression , Visitor&& visitor) ;
+    /// set result to closure applying operation to operands of binary expression
+    template<typename Operation>
+    void lowerBinary(const ExpressionAST& left , const ExpressionAST& right , Operation operation) ;
+
+    public:
+    ClosureASTVisitor(ClosureFunction& function , management::ArithmeticMode arithmeticMode) ;
+    //---------------------------------------------------------------------------
+    void visit(const FunctionAST& functionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const ReturnStatementAST& returnStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const AssignmentStatementAST& assignmentStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const BinaryExpressionAST& binaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const UnaryExpressionAST& unaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const IdentifierAST& identifierAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const LiteralAST& literalAst) override ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+#endif //PLJIT_CLOSUREASTVISITOR_HPP
@@ -0,0 +1,55 @@
+#include "pljit/semantic/ClosureFunction.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/ClosureASTVisitor.hpp"
+//---------------------------------------------------------------------------
+#include <array>
+#include <cassert>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+ClosureFunction::ClosureFunction(const FunctionAST& functionAst , management::ArithmeticMode arithmeticMode) {
+    ClosureASTVisitor closureASTVisitor(*this , arithmeticMode) ;
+    functionAst.accept(closureASTVisitor) ;
+}
+//---------------------------------------------------------------------------
+size_t ClosureFunction::num_parameters() const {
+    return numParameters ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> ClosureFunction::evaluate(const std::vector<int64_t>& parameterList) const {
+    assert(parameterList.size() >= numParameters) ;
+    // frames of small functions live on the stack
+    array<int64_t , 16> localSlots ;
+    vector<int64_t> heapSlots ;
+    Frame frame{localSlots.data()} ;
+    if(numSlots > localSlots.size()) {
+        heapSlots.resize(numSlots) ;
+        frame.slots = heapSlots.data() ;
+    }
+    for(size_t index = 0 ; index < numParameters ; ++index)
+        frame.slots[index] = parameterList[index] ;
+
+    int64_t value = 0 ;
+    for(const auto &[slot , expression] : assignments) {
+        value = expression(frame) ;
+        if(frame.error != NO_ERROR)
+            break ;
+        frame.slots[slot] = value ;
+    }
+    if(frame.error == NO_ERROR)
+        value = result(frame) ;
+    if(frame.error == NO_ERROR)
+        return value ;
+    // trigger runtime error given position of operator
+    const RuntimeError& runtimeError = runtimeErrors[frame.error] ;
+    if(runtimeError.overflow)
+        codeManager->printOverflowError(runtimeError.reference) ;
+    else
+        codeManager->printDivZeroError(runtimeError.reference) ;
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
@@ -0,0 +1,77 @@
+#ifndef PLJIT_CLOSUREFUNCTION_HPP
+#define PLJIT_CLOSUREFUNCTION_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/CodeManager.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+class FunctionAST ;
+//---------------------------------------------------------------------------
+/// evaluation tier between FunctionAST::evaluate() and ir::Function , Pljit evaluates the first call of a function
+/// with it since it is several times cheaper to build than ir::Function and its machine code . the (optimized) AST is
+/// lowered to a tree of closures , each specialized to the shape of its node (e.g. slot * constant , slot + slot ,
+/// literal) . identifiers are resolved to frame slots and constants while lowering , so evaluation needs no AST type
+/// switches , no token lookups and no hash maps . evaluation stops at the first runtime error like ir::Function
+class ClosureFunction {
+    public:
+    // no runtime error triggered
+    static constexpr uint32_t NO_ERROR = std::numeric_limits<uint32_t>::max() ;
+
+    /// state of one evaluation
+    struct Frame {
+        // parameters followed by variables (see SymbolTable::getSlot())
+        int64_t* slots ;
+        // index of first runtime error , NO_ERROR if none
+        uint32_t error = NO_ERROR ;
+
+        /// record runtime error unless an earlier one is recorded , the failing closure returns an arbitrary value
+        void fail(uint32_t runtimeError) {
+            if(error == NO_ERROR)
+                error = runtimeError ;
+        }
+    };
+    using Expression = std::function<int64_t(Frame&)> ;
+
+    private:
+    /// operator which may trigger a runtime error
+    struct RuntimeError {
+        management::CodeReference reference ;
+        // integer overflow (checked arithmetic) , otherwise divide by zero
+        bool overflow = false ;
+    };
+
+    // (slot , expression) of assignments before the first return statement
+    std::vector<std::pair<size_t , Expression>> assignments ;
+    // expression of first return statement
+    Expression result ;
+    std::vector<RuntimeError> runtimeErrors ;
+    size_t numParameters = 0 ;
+    size_t numSlots = 0 ;
+    // code manager of source code , used to print runtime errors
+    management::CodeManager* codeManager = nullptr ;
+
+    friend class ClosureASTVisitor ;
+
+    public:
+    /// lower (optimized) function , lowering visits each node once
+    explicit ClosureFunction(const FunctionAST& functionAst ,
+                             management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND) ;
+
+    /// number of parameters expected by evaluate()
+    size_t num_parameters() const ;
+
+    /// evaluate function , !has_value() if runtime error is triggered (evaluation stops at first runtime error)
+    std::optional<int64_t> evaluate(const std::vector<int64_t>& parameterList) const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+#endif //PLJIT_CLOSUREFUNCTION_HPP
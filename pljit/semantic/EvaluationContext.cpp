@@ -38,6 +38,16 @@ void EvaluationContext::updateIdentifier(std::string_view identifier, int64_t va
         assert(false) ;
 }
 //---------------------------------------------------------------------------
+void EvaluationContext::clearIdentifier(std::string_view identifier) {
+    assert(constants.find(identifier) == constants.end()) ;
+    if(parameters.find(identifier) != parameters.end())
+        parameters[identifier] = nullopt ;
+    else if(variables.find(identifier) != variables.end())
+        variables[identifier] = nullopt ;
+    else
+        assert(false) ;
+}
+//---------------------------------------------------------------------------
 std::optional<int64_t> EvaluationContext::getIdentifier(std::string_view identifier) {
     if(parameters.find(identifier) != parameters.end())
         return parameters[identifier] ;
@@ -87,5 +97,13 @@ EvaluationContext::EvaluationContext(SymbolTable& symbolTable) {
         }
 }
 //---------------------------------------------------------------------------
+void EvaluationContext::setArithmeticMode(management::ArithmeticMode mode) {
+    arithmeticMode = mode ;
+}
+//---------------------------------------------------------------------------
+management::ArithmeticMode EvaluationContext::getArithmeticMode() const {
+    return arithmeticMode ;
+}
+//---------------------------------------------------------------------------
 } // namespace jitcompiler::semantic
 //---------------------------------------------------------------------------
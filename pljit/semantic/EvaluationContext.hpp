@@ -1,6 +1,8 @@
 #ifndef PLJIT_EVALUATIONCONTEXT_HPP
 #define PLJIT_EVALUATIONCONTEXT_HPP
 
+#include "pljit/management/Arithmetic.hpp"
+
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -16,6 +18,8 @@ class EvaluationContext {
     std::unordered_map<std::string_view , std::optional<int64_t>> parameters ;
     std::unordered_map<std::string_view , std::optional<int64_t>> variables ;
     std::unordered_map<std::string_view , std::optional<int64_t>> constants ;
+    // semantics of overflowing operators
+    management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND ;
 
     void pushParameter(std::string_view identifier) ;
     void pushVariable(std::string_view identifier) ;
@@ -28,8 +32,13 @@ class EvaluationContext {
 
     /// update variable or parameter over each assignment statement
     void updateIdentifier(std::string_view identifier, int64_t value) ;
+    /// mark variable or parameter as unknown (assigned value is not a constant)
+    void clearIdentifier(std::string_view identifier) ;
     /// get value of an identifier within evaluation context
     std::optional<int64_t> getIdentifier(std::string_view identifier) ;
+    /// overflow triggers a runtime error if mode is CHECKED , otherwise results wrap around
+    void setArithmeticMode(management::ArithmeticMode mode) ;
+    management::ArithmeticMode getArithmeticMode() const ;
 
 };
 
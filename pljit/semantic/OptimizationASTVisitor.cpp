@@ -1,24 +1,215 @@
 #include "pljit/semantic/OptimizationASTVisitor.hpp"
 #include "pljit/semantic/AST.hpp"
 //---------------------------------------------------------------------------
+#include <map>
+#include <tuple>
+#include <unordered_set>
+//---------------------------------------------------------------------------
 using namespace std ;
 //---------------------------------------------------------------------------
 namespace jitcompiler ::semantic{
 //---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    optional<int64_t> fold_binary(BinaryExpressionAST::BinaryType type , int64_t left , int64_t right , management::ArithmeticMode mode)
+    /// evaluate binary operator on constants , nullopt if it triggers a runtime error
+    {
+        // runtime error will be triggered in runtime . there is no error message to be triggered
+        if(type == BinaryExpressionAST::BinaryType::DIVIDE && right == 0)
+            return nullopt ;
+        if(mode == management::ArithmeticMode::WRAPAROUND) {
+            switch (type) {
+                case BinaryExpressionAST::BinaryType::PLUS: return management::wrapping_add(left , right) ;
+                case BinaryExpressionAST::BinaryType::MINUS: return management::wrapping_subtract(left , right) ;
+                case BinaryExpressionAST::BinaryType::MULTIPLY: return management::wrapping_multiply(left , right) ;
+                case BinaryExpressionAST::BinaryType::DIVIDE: return management::wrapping_divide(left , right) ;
+            }
+            return nullopt ;
+        }
+        // overflow is not folded , it triggers its runtime error when evaluated
+        switch (type) {
+            case BinaryExpressionAST::BinaryType::PLUS: return management::checked_add(left , right) ;
+            case BinaryExpressionAST::BinaryType::MINUS: return management::checked_subtract(left , right) ;
+            case BinaryExpressionAST::BinaryType::MULTIPLY: return management::checked_multiply(left , right) ;
+            case BinaryExpressionAST::BinaryType::DIVIDE: return management::checked_divide(left , right) ;
+        }
+        return nullopt ;
+    }
+    //---------------------------------------------------------------------------
+    optional<int64_t> fold_negate(int64_t value , management::ArithmeticMode mode)
+    /// evaluate unary minus on constant , nullopt if it triggers a runtime error
+    {
+        if(mode == management::ArithmeticMode::WRAPAROUND)
+            return management::wrapping_negate(value) ;
+        return management::checked_negate(value) ;
+    }
+    //---------------------------------------------------------------------------
+    optional<int64_t> literal_value(const ExpressionAST& expressionAst)
+    /// value of expression if it is a literal
+    {
+        if(expressionAst.getAstType() == ASTNode::ASTType::LITERAL)
+            return static_cast<const LiteralAST&>(expressionAst).getValue() ;
+        return nullopt ;
+    }
+    //---------------------------------------------------------------------------
+    size_t expression_size(const ExpressionAST& expressionAst)
+    /// number of nodes of an expression
+    {
+        switch (expressionAst.getAstType()) {
+            case ASTNode::ASTType::BINARY_EXPRESSION: {
+                const BinaryExpressionAST& binaryExpressionAst = static_cast<const BinaryExpressionAST&>(expressionAst) ;
+                return 1 + expression_size(binaryExpressionAst.getLeftExpression()) + expression_size(binaryExpressionAst.getRightExpression()) ;
+            }
+            case ASTNode::ASTType::UNARY_EXPRESSION:
+                return 1 + expression_size(static_cast<const UnaryExpressionAST&>(expressionAst).getInput()) ;
+            default: return 1 ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    bool may_trap(const ExpressionAST& expressionAst , management::ArithmeticMode mode)
+    /// check if evaluation of an expression may trigger a runtime error (division by non-constant or zero divisor ,
+    /// any operator which may overflow in checked arithmetic)
+    {
+        bool checked = mode == management::ArithmeticMode::CHECKED ;
+        switch (expressionAst.getAstType()) {
+            case ASTNode::ASTType::BINARY_EXPRESSION: {
+                const BinaryExpressionAST& binaryExpressionAst = static_cast<const BinaryExpressionAST&>(expressionAst) ;
+                if(binaryExpressionAst.getBinaryType() == BinaryExpressionAST::BinaryType::DIVIDE) {
+                    optional<int64_t> divisor = literal_value(binaryExpressionAst.getRightExpression()) ;
+                    if(!divisor.has_value() || divisor.value() == 0 || (checked && divisor.value() == -1))
+                        return true ;
+                }
+                else if(checked)
+                    return true ;
+                return may_trap(binaryExpressionAst.getLeftExpression() , mode) || may_trap(binaryExpressionAst.getRightExpression() , mode) ;
+            }
+            case ASTNode::ASTType::UNARY_EXPRESSION: {
+                const UnaryExpressionAST& unaryExpressionAst = static_cast<const UnaryExpressionAST&>(expressionAst) ;
+                if(checked && unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::MINUS)
+                    return true ;
+                return may_trap(unaryExpressionAst.getInput() , mode) ;
+            }
+            default: return false ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    void collect_identifiers(const ExpressionAST& expressionAst , unordered_set<string_view>& identifiers)
+    /// insert all identifiers which are read by an expression
+    {
+        switch (expressionAst.getAstType()) {
+            case ASTNode::ASTType::BINARY_EXPRESSION: {
+                const BinaryExpressionAST& binaryExpressionAst = static_cast<const BinaryExpressionAST&>(expressionAst) ;
+                collect_identifiers(binaryExpressionAst.getLeftExpression() , identifiers) ;
+                collect_identifiers(binaryExpressionAst.getRightExpression() , identifiers) ;
+            }
+            break ;
+            case ASTNode::ASTType::UNARY_EXPRESSION:
+                collect_identifiers(static_cast<const UnaryExpressionAST&>(expressionAst).getInput() , identifiers) ;
+            break ;
+            case ASTNode::ASTType::IDENTIFIER:
+                identifiers.insert(static_cast<const IdentifierAST&>(expressionAst).print_token()) ;
+            break ;
+            default: break ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    size_t count_uses(const ExpressionAST& expressionAst , string_view identifier)
+    /// number of reads of identifier within an expression
+    {
+        switch (expressionAst.getAstType()) {
+            case ASTNode::ASTType::BINARY_EXPRESSION: {
+                const BinaryExpressionAST& binaryExpressionAst = static_cast<const BinaryExpressionAST&>(expressionAst) ;
+                return count_uses(binaryExpressionAst.getLeftExpression() , identifier) + count_uses(binaryExpressionAst.getRightExpression() , identifier) ;
+            }
+            case ASTNode::ASTType::UNARY_EXPRESSION:
+                return count_uses(static_cast<const UnaryExpressionAST&>(expressionAst).getInput() , identifier) ;
+            case ASTNode::ASTType::IDENTIFIER:
+                return static_cast<const IdentifierAST&>(expressionAst).print_token() == identifier ;
+            default: return 0 ;
+        }
+    }
+    //---------------------------------------------------------------------------
+    void replace_with_child(management::ResourcePointer<ExpressionAST>& expression , management::ResourcePointer<ExpressionAST>& child)
+    /// replace expression by one of its own children
+    {
+        // child is detached first , the stateful deleter of child must not be read after its parent is freed
+        management::ResourcePointer<ExpressionAST> detached = std::move(child) ;
+        expression = std::move(detached) ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+/// assign same number to expressions which evaluate to same value
+/// identifiers are numbered by their current version , which is incremented by each assignment
+class ValueNumbering {
+    // kinds of numbered expressions , binary expressions use their BinaryType
+    static constexpr int64_t LITERAL = -1 , IDENTIFIER = -2 , NEGATE = -3 ;
+    // number of each expression (kind , first operand , second operand)
+    map<tuple<int64_t , int64_t , int64_t> , size_t> numbers ;
+    // unique id of each identifier
+    unordered_map<string_view , int64_t> identifierIds ;
+    // current version of each identifier
+    unordered_map<string_view , int64_t> versions ;
+
+    size_t get(int64_t kind , int64_t first , int64_t second) {
+        return numbers.try_emplace(make_tuple(kind , first , second) , numbers.size()).first->second ;
+    }
+    public:
+    size_t literal(int64_t value) {
+        return get(LITERAL , value , 0) ;
+    }
+    size_t identifier(string_view identifier) {
+        int64_t id = identifierIds.try_emplace(identifier , identifierIds.size()).first->second ;
+        return get(IDENTIFIER , id , version(identifier)) ;
+    }
+    size_t negate(size_t input) {
+        return get(NEGATE , static_cast<int64_t>(input) , 0) ;
+    }
+    size_t binary(BinaryExpressionAST::BinaryType type , size_t left , size_t right) {
+        // "+" and "*" are commutative
+        if((type == BinaryExpressionAST::BinaryType::PLUS || type == BinaryExpressionAST::BinaryType::MULTIPLY) && right < left)
+            swap(left , right) ;
+        return get(static_cast<int64_t>(type) , static_cast<int64_t>(left) , static_cast<int64_t>(right)) ;
+    }
+    int64_t version(string_view identifier) const {
+        auto it = versions.find(identifier) ;
+        return it == versions.end() ? 0 : it->second ;
+    }
+    // identifier is reassigned , all numbers of its old value become unavailable
+    void assign(string_view identifier) {
+        versions[identifier]++ ;
+    }
+};
+//---------------------------------------------------------------------------
 optional<int64_t> OptimizationVisitor::visitOptimization(FunctionAST& functionAst) {
     // initialize evaluation context starting from function ast
     evaluationContext = EvaluationContext(functionAst.getSymbolTable()) ;
+    const SymbolTable& symbolTable = functionAst.getSymbolTable() ;
+    for(auto &[index , value] : boundParameters)
+        if(index < symbolTable.num_parameters())
+            evaluationContext.updateIdentifier(symbolTable.getIdentifier(index) , value) ;
 
     for(size_t statement_index = 0 ; statement_index < functionAst.num_statements() ; statement_index++)
     {
         StatementAST& statementAst = *functionAst.children[statement_index] ;
         optional<int64_t> result = statementAst.acceptOptimization(*this) ;
+        if(!result && (passes & (REASSOCIATION | ALGEBRAIC_SIMPLIFICATION)))
+        // rewriting may turn expression into a constant which can be propagated to next statements
+        {
+            management::ResourcePointer<ExpressionAST>& expression = getExpression(statementAst) ;
+            if(passes & REASSOCIATION)
+                reassociateExpression(expression) ;
+            if(passes & ALGEBRAIC_SIMPLIFICATION)
+                simplifyExpression(expression) ;
+            result = literal_value(*expression) ;
+        }
         if(statementAst.getAstType() == ASTNode::ASTType::RETURN_STATEMENT) {
             if(result)
             // if it returns constant then return literal with evaluated value
             {
                 functionAst.children.clear();
-                unique_ptr<ReturnStatementAST> retStatement = make_unique<ReturnStatementAST>(make_unique<LiteralAST>(result.value())) ;
+                management::ResourcePointer<ReturnStatementAST> retStatement = management::make_resource<ReturnStatementAST>(resource , management::make_resource<LiteralAST>(resource , result.value())) ;
                 functionAst.children.emplace_back(std::move(retStatement)) ;
                 return result ;
             }
@@ -30,17 +221,26 @@ optional<int64_t> OptimizationVisitor::visitOptimization(FunctionAST& functionAs
             }
         }
         else {
+            AssignmentStatementAST& assignmentStatementAst = static_cast<AssignmentStatementAST&>(statementAst);
+            string_view identifier = assignmentStatementAst.getLeftIdentifier().print_token() ;
             if(result)
             // if right expression is constant then right identifier should be assigned to const val in runtime
             {
-                AssignmentStatementAST& assignmentStatementAst = static_cast<AssignmentStatementAST&>(statementAst);
-                string_view identifier = assignmentStatementAst.getLeftIdentifier().print_token() ;
-                assignmentStatementAst.rightExpression = make_unique<LiteralAST>(result.value()) ;
+                assignmentStatementAst.rightExpression = management::make_resource<LiteralAST>(resource , result.value()) ;
                 // update it if there are more optimizations in next statements
                 evaluationContext.updateIdentifier(identifier , result.value()) ;
             }
+            else
+                // value of previous constant assignment is overwritten
+                evaluationContext.clearIdentifier(identifier) ;
         }
     }
+    if(passes & COPY_PROPAGATION)
+        propagateCopies(functionAst) ;
+    if(passes & COMMON_SUBEXPRESSION_ELIMINATION)
+        eliminateCommonSubexpressions(functionAst) ;
+    if(passes & DEAD_STORE_ELIMINATION)
+        eliminateDeadStores(functionAst) ;
     return nullopt;
 }
 //---------------------------------------------------------------------------
@@ -59,25 +259,13 @@ std::optional<int64_t> OptimizationVisitor::visitOptimization(BinaryExpressionAS
 
     // change left expression to a constant value if leftResult is evaluated
     if(leftResult)
-        binaryExpressionAst.leftExpression = make_unique<LiteralAST>(leftResult.value()) ;
+        binaryExpressionAst.leftExpression = management::make_resource<LiteralAST>(resource , leftResult.value()) ;
     // change right expression to a constant value if rightResult is evaluated
     if(rightResult)
-        binaryExpressionAst.rightExpression = make_unique<LiteralAST>(rightResult.value()) ;
+        binaryExpressionAst.rightExpression = management::make_resource<LiteralAST>(resource , rightResult.value()) ;
     // return evaluated binary expression if left & right expressions become constants
     if(leftResult && rightResult)
-    {
-        switch (binaryExpressionAst.getBinaryType()) {
-            case BinaryExpressionAST::BinaryType::PLUS: return leftResult.value() + rightResult.value();
-            case BinaryExpressionAST::BinaryType::MINUS: return leftResult.value() - rightResult.value();
-            case BinaryExpressionAST::BinaryType::MULTIPLY: return leftResult.value() * rightResult.value();
-            case BinaryExpressionAST::BinaryType::DIVIDE:{
-                // runtime error will be triggered in runtime . there is no error message to be triggered
-                if(rightResult.value() == 0)
-                    return nullopt ;
-                return leftResult.value() / rightResult.value() ;
-            }
-        }
-    }
+        return fold_binary(binaryExpressionAst.getBinaryType() , leftResult.value() , rightResult.value() , arithmeticMode) ;
     return nullopt ;
 }
 //---------------------------------------------------------------------------
@@ -89,11 +277,11 @@ std::optional<int64_t> OptimizationVisitor::visitOptimization(UnaryExpressionAST
     // change unary expression to literal if result is constant
     {
         // optimize
-        unaryExpressionAst.input = make_unique<LiteralAST>(result.value()) ;
+        unaryExpressionAst.input = management::make_resource<LiteralAST>(resource , result.value()) ;
 
         // evaluate
         if(unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::MINUS)
-            return -result.value() ;
+            return fold_negate(result.value() , arithmeticMode) ;
         return result.value() ;
     }
     return nullopt ;
@@ -108,7 +296,366 @@ std::optional<int64_t> OptimizationVisitor::visitOptimization(LiteralAST& litera
     return literalAst.value ;
 }
 //---------------------------------------------------------------------------
+management::ResourcePointer<ExpressionAST>& OptimizationVisitor::getExpression(StatementAST& statementAst) {
+    if(statementAst.getAstType() == ASTNode::ASTType::RETURN_STATEMENT)
+        return static_cast<ReturnStatementAST&>(statementAst).input ;
+    return static_cast<AssignmentStatementAST&>(statementAst).rightExpression ;
+}
+//---------------------------------------------------------------------------
+size_t OptimizationVisitor::numberExpression(management::ResourcePointer<ExpressionAST>& expression, ValueNumbering& numbering ,
+                                             const std::function<void(management::ResourcePointer<ExpressionAST>&, size_t)>& callback) {
+    size_t number = 0 ;
+    switch (expression->getAstType()) {
+        case ASTNode::ASTType::BINARY_EXPRESSION: {
+            BinaryExpressionAST& binaryExpressionAst = static_cast<BinaryExpressionAST&>(*expression) ;
+            size_t left = numberExpression(binaryExpressionAst.leftExpression , numbering , callback) ;
+            size_t right = numberExpression(binaryExpressionAst.rightExpression , numbering , callback) ;
+            number = numbering.binary(binaryExpressionAst.getBinaryType() , left , right) ;
+        }
+        break ;
+        case ASTNode::ASTType::UNARY_EXPRESSION: {
+            UnaryExpressionAST& unaryExpressionAst = static_cast<UnaryExpressionAST&>(*expression) ;
+            number = numberExpression(unaryExpressionAst.input , numbering , callback) ;
+            // unary plus has the same value as its input
+            if(unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::MINUS)
+                number = numbering.negate(number) ;
+        }
+        break ;
+        case ASTNode::ASTType::IDENTIFIER:
+            number = numbering.identifier(static_cast<IdentifierAST&>(*expression).print_token()) ;
+        break ;
+        case ASTNode::ASTType::LITERAL:
+            number = numbering.literal(static_cast<LiteralAST&>(*expression).getValue()) ;
+        break ;
+        default: assert(false) ;
+    }
+    callback(expression , number) ;
+    return number ;
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::replaceIdentifier(management::ResourcePointer<ExpressionAST>& expression , std::string_view identifier ,
+                                           const std::function<management::ResourcePointer<ExpressionAST>()>& replacement) {
+    switch (expression->getAstType()) {
+        case ASTNode::ASTType::BINARY_EXPRESSION: {
+            BinaryExpressionAST& binaryExpressionAst = static_cast<BinaryExpressionAST&>(*expression) ;
+            replaceIdentifier(binaryExpressionAst.leftExpression , identifier , replacement) ;
+            replaceIdentifier(binaryExpressionAst.rightExpression , identifier , replacement) ;
+        }
+        break ;
+        case ASTNode::ASTType::UNARY_EXPRESSION:
+            replaceIdentifier(static_cast<UnaryExpressionAST&>(*expression).input , identifier , replacement) ;
+        break ;
+        case ASTNode::ASTType::IDENTIFIER: {
+            if(static_cast<IdentifierAST&>(*expression).print_token() == identifier)
+                expression = replacement() ;
+        }
+        break ;
+        default: break ;
+    }
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::propagateCopies(FunctionAST& functionAst) {
+    std::pmr::vector<management::ResourcePointer<StatementAST>>& statements = functionAst.children ;
+    management::CodeManager* manager = functionAst.getManager() ;
+    for(size_t index = 0 ; index < statements.size() ;) {
+        if(statements[index]->getAstType() != ASTNode::ASTType::ASSIGNMENT_STATEMENT) {
+            ++index ;
+            continue ;
+        }
+        AssignmentStatementAST& assignmentStatementAst = static_cast<AssignmentStatementAST&>(*statements[index]) ;
+        string_view target = assignmentStatementAst.leftIdentifier->print_token() ;
+        management::ResourcePointer<ExpressionAST>& definition = assignmentStatementAst.rightExpression ;
+        bool isCopy = definition->getAstType() == ASTNode::ASTType::IDENTIFIER ;
+        // moving an expression which may trigger a runtime error would change the order of runtime errors
+        if(!isCopy && may_trap(*definition , arithmeticMode)) {
+            ++index ;
+            continue ;
+        }
+        unordered_set<string_view> operands ;
+        collect_identifiers(*definition , operands) ;
+
+        // statements (index , last] read the assigned value while all operands of definition are unchanged
+        size_t last = index ;
+        size_t uses = 0 , usesAfter = 0 ;
+        bool operandChanged = false ;
+        for(size_t next = index + 1 ; next < statements.size() ; ++next) {
+            StatementAST& statement = *statements[next] ;
+            size_t count = count_uses(*getExpression(statement) , target) ;
+            if(operandChanged)
+                usesAfter += count ;
+            else {
+                uses += count ;
+                last = next ;
+            }
+            if(statement.getAstType() != ASTNode::ASTType::ASSIGNMENT_STATEMENT)
+                continue ;
+            string_view assigned = static_cast<AssignmentStatementAST&>(statement).leftIdentifier->print_token() ;
+            if(assigned == target)
+                // assigned value is overwritten
+                break ;
+            if(operands.contains(assigned))
+                operandChanged = true ;
+        }
+
+        bool erase = false ;
+        if(isCopy) {
+            string_view source = static_cast<IdentifierAST&>(*definition).print_token() ;
+            if(source != target)
+                for(size_t next = index + 1 ; next <= last ; ++next)
+                    replaceIdentifier(getExpression(*statements[next]) , target , [this , manager , source]() { return management::make_resource<IdentifierAST>(resource , manager , source) ; }) ;
+            // copy is not needed if no statement reads it after source is changed
+            erase = source == target || usesAfter == 0 ;
+        }
+        else if(uses == 1 && usesAfter == 0) {
+            // forward expression into its single use
+            for(size_t next = index + 1 ; next <= last ; ++next)
+                replaceIdentifier(getExpression(*statements[next]) , target , [&definition]() { return std::move(definition) ; }) ;
+            erase = true ;
+        }
+        if(erase)
+            statements.erase(statements.begin() + static_cast<ptrdiff_t>(index)) ;
+        else
+            ++index ;
+    }
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::eliminateCommonSubexpressions(FunctionAST& functionAst) {
+    std::pmr::vector<management::ResourcePointer<StatementAST>>& statements = functionAst.children ;
+    management::CodeManager* manager = functionAst.getManager() ;
+
+    // 1. reuse variables which still hold the value of a recomputed expression .
+    // if computing the value triggered a runtime error , the function already returned at its assignment ,
+    // therefore this is valid for expressions with divisions as well
+    {
+        ValueNumbering numbering ;
+        // value number -> (variable , version of variable holding the value)
+        unordered_map<size_t , pair<string_view , int64_t>> available ;
+        for(management::ResourcePointer<StatementAST>& statement : statements) {
+            size_t number = numberExpression(getExpression(*statement) , numbering ,
+                [&](management::ResourcePointer<ExpressionAST>& expression , size_t number) {
+                    if(expression->getAstType() != ASTNode::ASTType::BINARY_EXPRESSION)
+                        return ;
+                    auto it = available.find(number) ;
+                    if(it != available.end() && numbering.version(it->second.first) == it->second.second)
+                        expression = management::make_resource<IdentifierAST>(resource , manager , it->second.first) ;
+                }) ;
+            if(statement->getAstType() == ASTNode::ASTType::ASSIGNMENT_STATEMENT) {
+                AssignmentStatementAST& assignmentStatementAst = static_cast<AssignmentStatementAST&>(*statement) ;
+                string_view identifier = assignmentStatementAst.leftIdentifier->print_token() ;
+                numbering.assign(identifier) ;
+                if(assignmentStatementAst.rightExpression->getAstType() == ASTNode::ASTType::BINARY_EXPRESSION)
+                    available[number] = {identifier , numbering.version(identifier)} ;
+            }
+        }
+    }
+
+    // 2. compute repeated expressions once in a temporary , largest expressions first .
+    // the temporary is assigned before the statement of the first occurrence . to preserve the order of
+    // runtime errors only expressions which cannot trigger a runtime error are moved
+    while(true) {
+        struct Occurrences {
+            vector<management::ResourcePointer<ExpressionAST>*> expressions ;
+            size_t firstStatement = 0 ;
+            size_t size = 0 ;
+            bool trap = false ;
+        };
+        ValueNumbering numbering ;
+        unordered_map<size_t , Occurrences> occurrences ;
+        for(size_t index = 0 ; index < statements.size() ; ++index) {
+            StatementAST& statement = *statements[index] ;
+            numberExpression(getExpression(statement) , numbering ,
+                [&](management::ResourcePointer<ExpressionAST>& expression , size_t number) {
+                    if(expression->getAstType() != ASTNode::ASTType::BINARY_EXPRESSION)
+                        return ;
+                    Occurrences& current = occurrences[number] ;
+                    if(current.expressions.empty()) {
+                        current.firstStatement = index ;
+                        current.size = expression_size(*expression) ;
+                        current.trap = may_trap(*expression , arithmeticMode) ;
+                    }
+                    current.expressions.push_back(&expression) ;
+                }) ;
+            if(statement.getAstType() == ASTNode::ASTType::ASSIGNMENT_STATEMENT)
+                numbering.assign(static_cast<AssignmentStatementAST&>(statement).leftIdentifier->print_token()) ;
+        }
+
+        const Occurrences* best = nullptr ;
+        for(auto &[number , current] : occurrences) {
+            if(current.expressions.size() < 2 || current.trap)
+                continue ;
+            if(best == nullptr || current.size > best->size || (current.size == best->size && current.firstStatement < best->firstStatement))
+                best = &current ;
+        }
+        if(best == nullptr)
+            break ;
+
+        string_view temporary = functionAst.getSymbolTable().addTemporary() ;
+        management::ResourcePointer<ExpressionAST> definition = std::move(*best->expressions.front()) ;
+        for(management::ResourcePointer<ExpressionAST>* expression : best->expressions)
+            *expression = management::make_resource<IdentifierAST>(resource , manager , temporary) ;
+        statements.insert(statements.begin() + static_cast<ptrdiff_t>(best->firstStatement) ,
+                          management::make_resource<AssignmentStatementAST>(resource , management::make_resource<IdentifierAST>(resource , manager , temporary) , std::move(definition))) ;
+    }
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::collectChain(management::ResourcePointer<ExpressionAST>& expression, int type, std::vector<management::ResourcePointer<ExpressionAST>>& leaves) {
+    if(expression->getAstType() == ASTNode::ASTType::BINARY_EXPRESSION) {
+        BinaryExpressionAST& binaryExpressionAst = static_cast<BinaryExpressionAST&>(*expression) ;
+        if(static_cast<int>(binaryExpressionAst.getBinaryType()) == type) {
+            collectChain(binaryExpressionAst.leftExpression , type , leaves) ;
+            collectChain(binaryExpressionAst.rightExpression , type , leaves) ;
+            return ;
+        }
+    }
+    leaves.push_back(std::move(expression)) ;
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::reassociateExpression(management::ResourcePointer<ExpressionAST>& expression) {
+    if(expression->getAstType() == ASTNode::ASTType::UNARY_EXPRESSION) {
+        reassociateExpression(static_cast<UnaryExpressionAST&>(*expression).input) ;
+        return ;
+    }
+    if(expression->getAstType() != ASTNode::ASTType::BINARY_EXPRESSION)
+        return ;
+    BinaryExpressionAST& binaryExpressionAst = static_cast<BinaryExpressionAST&>(*expression) ;
+    BinaryExpressionAST::BinaryType type = binaryExpressionAst.getBinaryType() ;
+    if(type != BinaryExpressionAST::BinaryType::PLUS && type != BinaryExpressionAST::BinaryType::MULTIPLY) {
+        reassociateExpression(binaryExpressionAst.leftExpression) ;
+        reassociateExpression(binaryExpressionAst.rightExpression) ;
+        return ;
+    }
+
+    // leaves of chain in evaluation order
+    vector<management::ResourcePointer<ExpressionAST>> leaves ;
+    management::CodeManager* manager = binaryExpressionAst.getManager() ;
+    management::ResourcePointer<ExpressionAST> chain = std::move(expression) ;
+    collectChain(chain , static_cast<int>(type) , leaves) ;
+
+    // fold constants in unsigned arithmetic , "+" and "*" are associative and commutative modulo 2^64
+    uint64_t neutral = type == BinaryExpressionAST::BinaryType::PLUS ? 0 : 1 ;
+    uint64_t constant = neutral ;
+    size_t numConstants = 0 ;
+    for(management::ResourcePointer<ExpressionAST>& leaf : leaves) {
+        reassociateExpression(leaf) ;
+        if(optional<int64_t> value = literal_value(*leaf)) {
+            uint64_t bits = static_cast<uint64_t>(value.value()) ;
+            constant = type == BinaryExpressionAST::BinaryType::PLUS ? constant + bits : constant * bits ;
+            numConstants++ ;
+        }
+    }
+    vector<management::ResourcePointer<ExpressionAST>> operands ;
+    for(management::ResourcePointer<ExpressionAST>& leaf : leaves)
+        // keep chain unchanged if there is nothing to fold
+        if(numConstants < 2 || !literal_value(*leaf))
+            operands.push_back(std::move(leaf)) ;
+    if(numConstants >= 2 && (operands.empty() || constant != neutral))
+        // the folded constant is evaluated last , it cannot trigger a runtime error
+        operands.push_back(management::make_resource<LiteralAST>(resource , static_cast<int64_t>(constant))) ;
+
+    // rebuild chain with left associativity , non-constant operands keep their evaluation order
+    expression = std::move(operands.front()) ;
+    for(size_t index = 1 ; index < operands.size() ; ++index)
+        expression = management::make_resource<BinaryExpressionAST>(resource , manager , type , std::move(expression) , std::move(operands[index])) ;
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::simplifyExpression(management::ResourcePointer<ExpressionAST>& expression) {
+    if(expression->getAstType() == ASTNode::ASTType::UNARY_EXPRESSION) {
+        UnaryExpressionAST& unaryExpressionAst = static_cast<UnaryExpressionAST&>(*expression) ;
+        simplifyExpression(unaryExpressionAst.input) ;
+        ExpressionAST& input = *unaryExpressionAst.input ;
+        if(unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::PLUS)
+            // +x => x
+            replace_with_child(expression , unaryExpressionAst.input) ;
+        else if(optional<int64_t> value = literal_value(input)) {
+            if(optional<int64_t> negated = fold_negate(value.value() , arithmeticMode))
+                expression = management::make_resource<LiteralAST>(resource , negated.value()) ;
+        }
+        else if(input.getAstType() == ASTNode::ASTType::UNARY_EXPRESSION && arithmeticMode == management::ArithmeticMode::WRAPAROUND)
+            // --x => x (inner unary plus is already removed) , in checked arithmetic inner negation may overflow
+            replace_with_child(expression , static_cast<UnaryExpressionAST&>(input).input) ;
+        return ;
+    }
+    if(expression->getAstType() != ASTNode::ASTType::BINARY_EXPRESSION)
+        return ;
+
+    BinaryExpressionAST& binaryExpressionAst = static_cast<BinaryExpressionAST&>(*expression) ;
+    simplifyExpression(binaryExpressionAst.leftExpression) ;
+    simplifyExpression(binaryExpressionAst.rightExpression) ;
+    optional<int64_t> left = literal_value(*binaryExpressionAst.leftExpression) ;
+    optional<int64_t> right = literal_value(*binaryExpressionAst.rightExpression) ;
+    if(left && right) {
+        if(optional<int64_t> value = fold_binary(binaryExpressionAst.getBinaryType() , left.value() , right.value() , arithmeticMode))
+            expression = management::make_resource<LiteralAST>(resource , value.value()) ;
+        return ;
+    }
+    switch (binaryExpressionAst.getBinaryType()) {
+        case BinaryExpressionAST::BinaryType::PLUS: {
+            // x + 0 => x , 0 + x => x
+            if(right == 0)
+                replace_with_child(expression , binaryExpressionAst.leftExpression) ;
+            else if(left == 0)
+                replace_with_child(expression , binaryExpressionAst.rightExpression) ;
+        }
+        break ;
+        case BinaryExpressionAST::BinaryType::MINUS: {
+            // x - 0 => x
+            if(right == 0)
+                replace_with_child(expression , binaryExpressionAst.leftExpression) ;
+        }
+        break ;
+        case BinaryExpressionAST::BinaryType::MULTIPLY: {
+            // x * 1 => x , 1 * x => x
+            // x * 0 => 0 , 0 * x => 0 only if evaluation of x cannot trigger a runtime error
+            if(right == 1)
+                replace_with_child(expression , binaryExpressionAst.leftExpression) ;
+            else if(left == 1)
+                replace_with_child(expression , binaryExpressionAst.rightExpression) ;
+            else if((right == 0 && !may_trap(*binaryExpressionAst.leftExpression , arithmeticMode)) || (left == 0 && !may_trap(*binaryExpressionAst.rightExpression , arithmeticMode)))
+                expression = management::make_resource<LiteralAST>(resource , 0) ;
+        }
+        break ;
+        case BinaryExpressionAST::BinaryType::DIVIDE: {
+            // x / 1 => x
+            if(right == 1)
+                replace_with_child(expression , binaryExpressionAst.leftExpression) ;
+        }
+        break ;
+    }
+}
+//---------------------------------------------------------------------------
+void OptimizationVisitor::eliminateDeadStores(FunctionAST& functionAst) {
+    std::pmr::vector<management::ResourcePointer<StatementAST>>& statements = functionAst.children ;
+    // identifiers whose current value is read by a later statement
+    unordered_set<string_view> live ;
+    vector<management::ResourcePointer<StatementAST>> liveStatements ;
+    for(size_t index = statements.size() ; index-- > 0 ;) {
+        management::ResourcePointer<StatementAST>& statement = statements[index] ;
+        const ExpressionAST& expression = *getExpression(*statement) ;
+        if(statement->getAstType() == ASTNode::ASTType::ASSIGNMENT_STATEMENT) {
+            string_view identifier = static_cast<AssignmentStatementAST&>(*statement).leftIdentifier->print_token() ;
+            if(!live.contains(identifier) && !may_trap(expression , arithmeticMode))
+                // dead store , assigned value is overwritten or never read before return
+                continue ;
+            // dead stores which may trigger a runtime error are kept to preserve the error
+            live.erase(identifier) ;
+        }
+        collect_identifiers(expression , live) ;
+        liveStatements.push_back(std::move(statement)) ;
+    }
+    statements.assign(make_move_iterator(liveStatements.rbegin()) , make_move_iterator(liveStatements.rend())) ;
+}
+//---------------------------------------------------------------------------
 OptimizationVisitor::OptimizationVisitor()  = default ;
 //---------------------------------------------------------------------------
+OptimizationVisitor::OptimizationVisitor(unsigned passes) : passes(passes) {}
+//---------------------------------------------------------------------------
+OptimizationVisitor::OptimizationVisitor(unsigned passes , const std::unordered_map<size_t , int64_t>& boundParameters ,
+                                         management::ArithmeticMode arithmeticMode , std::pmr::memory_resource* resource)
+    : passes(passes) , resource(resource) , boundParameters(boundParameters.begin() , boundParameters.end() , 0 , resource) , arithmeticMode(arithmeticMode) {
+    // reassociation changes intermediate results , so it could remove or introduce an overflow
+    if(arithmeticMode == management::ArithmeticMode::CHECKED)
+        this->passes &= ~static_cast<unsigned>(REASSOCIATION) ;
+}
+//---------------------------------------------------------------------------
 } // namespace jitcompiler::semantic
 //---------------------------------------------------------------------------
@@ -1,14 +1,24 @@
 #ifndef PLJIT_OPTIMIZATIONASTVISITOR_HPP
 #define PLJIT_OPTIMIZATIONASTVISITOR_HPP
 //---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/MemoryAccount.hpp"
 #include "pljit/semantic/EvaluationContext.hpp"
 //---------------------------------------------------------------------------
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 //---------------------------------------------------------------------------
 namespace jitcompiler ::semantic{
 //---------------------------------------------------------------------------
 class FunctionAST ;
+class StatementAST ;
+class ExpressionAST ;
 class ReturnStatementAST ;
 class AssignmentStatementAST ;
 class BinaryExpressionAST ;
@@ -16,12 +26,64 @@ class UnaryExpressionAST ;
 class IdentifierAST ;
 class LiteralAST ;
 //---------------------------------------------------------------------------
+class ValueNumbering ;
+//---------------------------------------------------------------------------
 class OptimizationVisitor {
+    public:
+    /// optional passes which are applied after constant folding and dead code elimination
+    enum Pass : unsigned {
+        COMMON_SUBEXPRESSION_ELIMINATION = 1u << 0 ,
+        DEAD_STORE_ELIMINATION = 1u << 1 ,
+        ALGEBRAIC_SIMPLIFICATION = 1u << 2 ,
+        REASSOCIATION = 1u << 3 ,
+        COPY_PROPAGATION = 1u << 4
+    };
+    static constexpr unsigned ALL_PASSES = COMMON_SUBEXPRESSION_ELIMINATION | DEAD_STORE_ELIMINATION | ALGEBRAIC_SIMPLIFICATION | REASSOCIATION | COPY_PROPAGATION ;
+
+    private:
     // evaluation context used for optimization within each statement to return constant expression
     EvaluationContext evaluationContext ;
+    // enabled optional passes
+    unsigned passes = 0 ;
+    // nodes created by optimization are allocated from resource
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource() ;
+    // parameters which are replaced by constant values (parameter index -> value)
+    std::pmr::unordered_map<size_t , int64_t> boundParameters ;
+    // overflowing constant expressions are not folded in checked arithmetic
+    management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND ;
+
+    /// get expression of assignment or return statement
+    static management::ResourcePointer<ExpressionAST>& getExpression(StatementAST& statementAst) ;
+    /// number expression and its subexpressions in post order , callback may replace numbered expression
+    size_t numberExpression(management::ResourcePointer<ExpressionAST>& expression , ValueNumbering& numbering ,
+                            const std::function<void(management::ResourcePointer<ExpressionAST>& , size_t)>& callback) ;
+    /// move operands of a chain of "+" or "*" with the same operator into leaves (in evaluation order)
+    void collectChain(management::ResourcePointer<ExpressionAST>& expression , int type , std::vector<management::ResourcePointer<ExpressionAST>>& leaves) ;
+    /// gather and fold constants of "+" and "*" chains , divisions are never moved
+    void reassociateExpression(management::ResourcePointer<ExpressionAST>& expression) ;
+    /// rewrite algebraic identities (x * 1 , x + 0 , x - 0 , x / 1 , --x , +x , x * 0 without runtime error)
+    void simplifyExpression(management::ResourcePointer<ExpressionAST>& expression) ;
+    /// replace each read of identifier within expression by result of replacement
+    void replaceIdentifier(management::ResourcePointer<ExpressionAST>& expression , std::string_view identifier ,
+                           const std::function<management::ResourcePointer<ExpressionAST>()>& replacement) ;
+    /// replace reads of copied variables by their source and move expressions into their single use
+    void propagateCopies(FunctionAST& functionAst) ;
+    /// common subexpression elimination using value numbering over all statements
+    void eliminateCommonSubexpressions(FunctionAST& functionAst) ;
+    /// remove assignments whose value is never read , using backward liveness over all statements
+    void eliminateDeadStores(FunctionAST& functionAst) ;
 
     public:
+    // constant folding , constant propagation and dead code elimination only
     OptimizationVisitor();
+    // additionally apply optional passes (bitwise or of Pass)
+    explicit OptimizationVisitor(unsigned passes);
+    // additionally treat given parameters as constants (partial evaluation) , other indices are ignored .
+    // in checked arithmetic , rewrites which could remove or introduce an overflow are not applied .
+    // bound parameters and nodes created by optimization are allocated from resource
+    explicit OptimizationVisitor(unsigned passes , const std::unordered_map<size_t , int64_t>& boundParameters ,
+                                 management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND ,
+                                 std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     std::optional<int64_t> visitOptimization(FunctionAST& functionAst) ;
     std::optional<int64_t> visitOptimization(ReturnStatementAST& returnStatementAst)  ;
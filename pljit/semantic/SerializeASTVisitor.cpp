@@ -0,0 +1,142 @@
+#include "pljit/semantic/SerializeASTVisitor.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/SerializedFunction.hpp"
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+SerializeASTVisitor::SerializeASTVisitor(management::ArithmeticMode arithmeticMode) : arithmeticMode(arithmeticMode) {}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_u8(uint8_t value) {
+    buf.push_back(static_cast<char>(value)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_u16(uint16_t value) {
+    for(size_t shift = 0 ; shift < 16 ; shift += 8)
+        write_u8(static_cast<uint8_t>(value >> shift)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_u32(uint32_t value) {
+    for(size_t shift = 0 ; shift < 32 ; shift += 8)
+        write_u8(static_cast<uint8_t>(value >> shift)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_i64(int64_t value) {
+    uint64_t bits = static_cast<uint64_t>(value) ;
+    for(size_t shift = 0 ; shift < 64 ; shift += 8)
+        write_u8(static_cast<uint8_t>(bits >> shift)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_reference(management::CodeReference reference) {
+    write_u32(static_cast<uint32_t>(reference.getStartLineRange().first)) ;
+    write_u32(static_cast<uint32_t>(reference.getStartLineRange().second)) ;
+    write_u32(static_cast<uint32_t>(reference.getEndLineRange().first)) ;
+    write_u32(static_cast<uint32_t>(reference.getEndLineRange().second)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::write_overflow_reference(management::CodeReference reference) {
+    if(arithmeticMode == management::ArithmeticMode::CHECKED)
+        write_reference(reference) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const FunctionAST& functionAst) {
+    symbolTable = &functionAst.getSymbolTable() ;
+    returnTriggered = false ;
+    buf.clear() ;
+
+    // header
+    buf += "PLJB" ;
+    write_u16(SerializedFunction::FORMAT_VERSION) ;
+    write_u8(static_cast<uint8_t>(arithmeticMode)) ;
+    write_u8(0) ;
+    write_u32(static_cast<uint32_t>(symbolTable->num_parameters())) ;
+    write_u32(static_cast<uint32_t>(symbolTable->num_variables())) ;
+    write_u32(static_cast<uint32_t>(symbolTable->num_constants())) ;
+
+    // constant values ordered by slot
+    size_t firstConstantSlot = symbolTable->num_parameters() + symbolTable->num_variables() ;
+    for(size_t slot = firstConstantSlot ; slot < firstConstantSlot + symbolTable->num_constants() ; ++slot)
+        write_i64(symbolTable->getConstantValue(slot)) ;
+
+    // source code , joined line by line
+    const management::CodeManager& manager = *functionAst.getManager() ;
+    string source ;
+    for(size_t line = 0 ; line < manager.countLines() ; ++line) {
+        if(line > 0)
+            source += '\n' ;
+        source += manager.getCurrentLine(line) ;
+    }
+    write_u32(static_cast<uint32_t>(source.size())) ;
+    buf += source ;
+
+    // code , size is patched after all statements are written
+    size_t codeSizeOffset = buf.size() ;
+    write_u32(0) ;
+    size_t codeOffset = buf.size() ;
+    for(size_t index = 0 ; index < functionAst.num_statements() && !returnTriggered ; ++index)
+        functionAst.getStatement(index).accept(*this) ;
+
+    uint32_t codeSize = static_cast<uint32_t>(buf.size() - codeOffset) ;
+    for(size_t shift = 0 ; shift < 32 ; shift += 8)
+        buf[codeSizeOffset + shift / 8] = static_cast<char>(static_cast<uint8_t>(codeSize >> shift)) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const ReturnStatementAST& returnStatementAst) {
+    returnStatementAst.getInput().accept(*this) ;
+    write_u8(SerializedFunction::RETURN) ;
+    returnTriggered = true ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const AssignmentStatementAST& assignmentStatementAst) {
+    assignmentStatementAst.getRightExpression().accept(*this) ;
+    optional<size_t> slot = symbolTable->getSlot(assignmentStatementAst.getLeftIdentifier().print_token()) ;
+    assert(slot.has_value()) ;
+    write_u8(SerializedFunction::ASSIGN) ;
+    write_u32(static_cast<uint32_t>(slot.value())) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const BinaryExpressionAST& binaryExpressionAst) {
+    binaryExpressionAst.getLeftExpression().accept(*this) ;
+    binaryExpressionAst.getRightExpression().accept(*this) ;
+    management::CodeReference reference = binaryExpressionAst.getReference() ;
+    switch (binaryExpressionAst.getBinaryType()) {
+        case BinaryExpressionAST::BinaryType::PLUS: write_u8(SerializedFunction::ADD) ; write_overflow_reference(reference) ; break ;
+        case BinaryExpressionAST::BinaryType::MINUS: write_u8(SerializedFunction::SUBTRACT) ; write_overflow_reference(reference) ; break ;
+        case BinaryExpressionAST::BinaryType::MULTIPLY: write_u8(SerializedFunction::MULTIPLY) ; write_overflow_reference(reference) ; break ;
+        case BinaryExpressionAST::BinaryType::DIVIDE: {
+            // code reference of "/" is needed to print divide by zero error
+            write_u8(SerializedFunction::DIVIDE) ;
+            write_reference(reference) ;
+        }
+        break ;
+    }
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const UnaryExpressionAST& unaryExpressionAst) {
+    unaryExpressionAst.getInput().accept(*this) ;
+    // unary plus has no effect on evaluation
+    if(unaryExpressionAst.getUnaryType() == UnaryExpressionAST::UnaryType::MINUS) {
+        write_u8(SerializedFunction::NEGATE) ;
+        write_overflow_reference(unaryExpressionAst.getReference()) ;
+    }
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const IdentifierAST& identifierAst) {
+    optional<size_t> slot = symbolTable->getSlot(identifierAst.print_token()) ;
+    assert(slot.has_value()) ;
+    write_u8(SerializedFunction::LOAD) ;
+    write_u32(static_cast<uint32_t>(slot.value())) ;
+}
+//---------------------------------------------------------------------------
+void SerializeASTVisitor::visit(const LiteralAST& literalAst) {
+    write_u8(SerializedFunction::LITERAL) ;
+    write_i64(literalAst.getValue()) ;
+}
+//---------------------------------------------------------------------------
+std::string SerializeASTVisitor::getOutput() const {
+    return buf ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
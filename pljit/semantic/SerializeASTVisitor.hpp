@@ -0,0 +1,57 @@
+#ifndef PLJIT_SERIALIZEASTVISITOR_HPP
+#define PLJIT_SERIALIZEASTVISITOR_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/CodeReference.hpp"
+#include "pljit/semantic/ASTVisitor.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+class SymbolTable ;
+//---------------------------------------------------------------------------
+/// write binary encoding of FunctionAST (format is described in SerializedFunction.hpp)
+class SerializeASTVisitor final : public ASTVisitor {
+    // encoded output
+    std::string buf ;
+    // semantics of overflow of encoded function , operators carry their code reference if arithmetic is checked
+    management::ArithmeticMode arithmeticMode ;
+    // symbol table of visited function to map identifiers to frame slots
+    const SymbolTable* symbolTable = nullptr ;
+    // stop encoding after first return statement (remaining statements are dead code)
+    bool returnTriggered = false ;
+
+    void write_u8(uint8_t value) ;
+    void write_u16(uint16_t value) ;
+    void write_u32(uint32_t value) ;
+    void write_i64(int64_t value) ;
+    void write_reference(management::CodeReference reference) ;
+    /// write reference of an operator which can only fail if arithmetic is checked
+    void write_overflow_reference(management::CodeReference reference) ;
+
+    public:
+    explicit SerializeASTVisitor(management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND) ;
+    //---------------------------------------------------------------------------
+    void visit(const FunctionAST& functionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const ReturnStatementAST& returnStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const AssignmentStatementAST& assignmentStatementAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const BinaryExpressionAST& binaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const UnaryExpressionAST& unaryExpressionAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const IdentifierAST& identifierAst) override ;
+    //---------------------------------------------------------------------------
+    void visit(const LiteralAST& literalAst) override ;
+    //---------------------------------------------------------------------------
+    /// get encoded function
+    std::string getOutput() const ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+#endif //PLJIT_SERIALIZEASTVISITOR_HPP
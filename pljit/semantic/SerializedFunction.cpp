@@ -0,0 +1,267 @@
+#include "pljit/semantic/SerializedFunction.hpp"
+#include "pljit/management/Arithmetic.hpp"
+//---------------------------------------------------------------------------
+#include <cassert>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    uint64_t read_bytes(string_view buffer , size_t offset , size_t size)
+    /// read little-endian unsigned integer of given size , offset must be checked by caller
+    {
+        uint64_t value = 0 ;
+        for(size_t index = 0 ; index < size ; ++index)
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(buffer[offset + index])) << (8 * index) ;
+        return value ;
+    }
+    //---------------------------------------------------------------------------
+    uint32_t read_u32(string_view buffer , size_t offset) {
+        return static_cast<uint32_t>(read_bytes(buffer , offset , 4)) ;
+    }
+    //---------------------------------------------------------------------------
+    int64_t read_i64(string_view buffer , size_t offset) {
+        return static_cast<int64_t>(read_bytes(buffer , offset , 8)) ;
+    }
+    //---------------------------------------------------------------------------
+    management::CodeReference read_reference(string_view buffer , size_t offset) {
+        return management::CodeReference({read_u32(buffer , offset) , read_u32(buffer , offset + 4)} ,
+                                         {read_u32(buffer , offset + 8) , read_u32(buffer , offset + 12)}) ;
+    }
+    //---------------------------------------------------------------------------
+    // size of operands following each opcode
+    size_t operand_size(uint8_t opcode , management::ArithmeticMode mode) {
+        switch (opcode) {
+            case SerializedFunction::LITERAL: return 8 ;
+            case SerializedFunction::LOAD:
+            case SerializedFunction::ASSIGN: return 4 ;
+            case SerializedFunction::DIVIDE: return 16 ;
+            case SerializedFunction::NEGATE:
+            case SerializedFunction::ADD:
+            case SerializedFunction::SUBTRACT:
+            case SerializedFunction::MULTIPLY: return mode == management::ArithmeticMode::CHECKED ? 16 : 0 ;
+            default: return 0 ;
+        }
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+SerializedFunction::SerializedFunction(std::string_view buffer) : buffer(buffer) {
+    valid = validate() ;
+}
+//---------------------------------------------------------------------------
+bool SerializedFunction::validate() {
+    constexpr size_t HEADER_SIZE = 4 + 2 + 2 + 3 * 4 ;
+    if(buffer.size() < HEADER_SIZE || buffer.substr(0 , 4) != "PLJB")
+        return false ;
+    if(read_bytes(buffer , 4 , 2) != FORMAT_VERSION)
+        return false ;
+    uint8_t mode = static_cast<uint8_t>(buffer[6]) ;
+    if(mode > static_cast<uint8_t>(management::ArithmeticMode::CHECKED))
+        return false ;
+    arithmeticMode = static_cast<management::ArithmeticMode>(mode) ;
+    numParameters = read_u32(buffer , 8) ;
+    numVariables = read_u32(buffer , 12) ;
+    numConstants = read_u32(buffer , 16) ;
+    uint64_t numSlots = static_cast<uint64_t>(numParameters) + numVariables + numConstants ;
+
+    // constant values
+    constantOffset = HEADER_SIZE ;
+    if((buffer.size() - constantOffset) / 8 < numConstants)
+        return false ;
+    size_t offset = constantOffset + 8 * static_cast<size_t>(numConstants) ;
+
+    // source code
+    if(buffer.size() - offset < 4)
+        return false ;
+    size_t sourceSize = read_u32(buffer , offset) ;
+    offset += 4 ;
+    if(buffer.size() - offset < sourceSize)
+        return false ;
+    codeManager.emplace(buffer.substr(offset , sourceSize)) ;
+    offset += sourceSize ;
+
+    // code
+    if(buffer.size() - offset < 4)
+        return false ;
+    codeSize = read_u32(buffer , offset) ;
+    codeOffset = offset + 4 ;
+    if(buffer.size() - codeOffset != codeSize)
+        return false ;
+
+    // code reference must point to a single line of embedded source code
+    auto valid_reference = [this](size_t offset) {
+        management::CodeReference reference = read_reference(buffer , offset) ;
+        auto [startLine , startIndex] = reference.getStartLineRange() ;
+        auto [endLine , endIndex] = reference.getEndLineRange() ;
+        return startLine == endLine && startLine < codeManager->countLines() && startIndex <= endIndex
+            && endIndex < codeManager->getCurrentLine(startLine).size() ;
+    } ;
+    // check each instruction and simulate depth of operand stack
+    size_t depth = 0 ;
+    maxStackDepth = 0 ;
+    bool returnTriggered = false ;
+    for(size_t pc = codeOffset ; pc < buffer.size() ;) {
+        if(returnTriggered)
+            // return statement must be the last statement
+            return false ;
+        uint8_t opcode = static_cast<uint8_t>(buffer[pc++]) ;
+        if(opcode < LITERAL || opcode > RETURN || buffer.size() - pc < operand_size(opcode , arithmeticMode))
+            return false ;
+        if(operand_size(opcode , arithmeticMode) == 16 && !valid_reference(pc))
+            return false ;
+        switch (opcode) {
+            case LITERAL: depth++ ; break ;
+            case LOAD: {
+                if(read_u32(buffer , pc) >= numSlots)
+                    return false ;
+                depth++ ;
+            }
+            break ;
+            case NEGATE: {
+                if(depth < 1)
+                    return false ;
+            }
+            break ;
+            case ADD:
+            case SUBTRACT:
+            case MULTIPLY:
+            case DIVIDE: {
+                if(depth < 2)
+                    return false ;
+                depth-- ;
+            }
+            break ;
+            case ASSIGN: {
+                uint32_t slot = read_u32(buffer , pc) ;
+                if(depth != 1 || slot < numParameters || slot >= static_cast<uint64_t>(numParameters) + numVariables)
+                    return false ;
+                depth-- ;
+            }
+            break ;
+            case RETURN: {
+                if(depth != 1)
+                    return false ;
+                depth-- ;
+                returnTriggered = true ;
+            }
+            break ;
+            default: return false ;
+        }
+        maxStackDepth = max(maxStackDepth , depth) ;
+        pc += operand_size(opcode , arithmeticMode) ;
+    }
+    return returnTriggered ;
+}
+//---------------------------------------------------------------------------
+bool SerializedFunction::isValid() const {
+    return valid ;
+}
+//---------------------------------------------------------------------------
+size_t SerializedFunction::num_parameters() const {
+    return numParameters ;
+}
+//---------------------------------------------------------------------------
+std::optional<int64_t> SerializedFunction::evaluate(const std::vector<int64_t>& parameterList) {
+    assert(valid) ;
+    assert(parameterList.size() >= numParameters) ;
+
+    // values of variables (parameters and constants are read in place)
+    vector<int64_t> variables(numVariables , 0) ;
+    // operand stack , nullopt marks an operand whose evaluation triggered a runtime error
+    vector<optional<int64_t>> stack ;
+    stack.reserve(maxStackDepth) ;
+
+    for(size_t pc = codeOffset ; pc < buffer.size() ;) {
+        uint8_t opcode = static_cast<uint8_t>(buffer[pc++]) ;
+        switch (opcode) {
+            case LITERAL: stack.emplace_back(read_i64(buffer , pc)) ; break ;
+            case LOAD: {
+                size_t slot = read_u32(buffer , pc) ;
+                if(slot < numParameters)
+                    stack.emplace_back(parameterList[slot]) ;
+                else if(slot < numParameters + numVariables)
+                    stack.emplace_back(variables[slot - numParameters]) ;
+                else
+                    stack.emplace_back(read_i64(buffer , constantOffset + 8 * (slot - numParameters - numVariables))) ;
+            }
+            break ;
+            case NEGATE: {
+                optional<int64_t>& result = stack.back() ;
+                if(!result.has_value())
+                    break ;
+                if(arithmeticMode == management::ArithmeticMode::WRAPAROUND) {
+                    result = management::wrapping_negate(result.value()) ;
+                    break ;
+                }
+                result = management::checked_negate(result.value()) ;
+                if(!result.has_value())
+                    // trigger runtime error given position of "-" operator
+                    codeManager->printOverflowError(read_reference(buffer , pc)) ;
+            }
+            break ;
+            case ADD:
+            case SUBTRACT:
+            case MULTIPLY:
+            case DIVIDE: {
+                optional<int64_t> rightResult = stack.back() ;
+                stack.pop_back() ;
+                optional<int64_t>& result = stack.back() ;
+                if(!result.has_value() || !rightResult.has_value()) {
+                    // runtime error is already triggered by one of the operands
+                    result = nullopt ;
+                    break ;
+                }
+                int64_t left = result.value() , right = rightResult.value() ;
+                if(opcode == DIVIDE && right == 0) {
+                    // trigger runtime error given position of "/" operator
+                    codeManager->printDivZeroError(read_reference(buffer , pc)) ;
+                    result = nullopt ;
+                    break ;
+                }
+                if(arithmeticMode == management::ArithmeticMode::WRAPAROUND) {
+                    switch (opcode) {
+                        case ADD: result = management::wrapping_add(left , right) ; break ;
+                        case SUBTRACT: result = management::wrapping_subtract(left , right) ; break ;
+                        case MULTIPLY: result = management::wrapping_multiply(left , right) ; break ;
+                        default: result = management::wrapping_divide(left , right) ; break ;
+                    }
+                    break ;
+                }
+                switch (opcode) {
+                    case ADD: result = management::checked_add(left , right) ; break ;
+                    case SUBTRACT: result = management::checked_subtract(left , right) ; break ;
+                    case MULTIPLY: result = management::checked_multiply(left , right) ; break ;
+                    default: result = management::checked_divide(left , right) ; break ;
+                }
+                if(!result.has_value())
+                    // trigger runtime error given position of operator
+                    codeManager->printOverflowError(read_reference(buffer , pc)) ;
+            }
+            break ;
+            case ASSIGN: {
+                optional<int64_t> result = stack.back() ;
+                stack.pop_back() ;
+                if(!result.has_value())
+                    return nullopt ;
+                variables[read_u32(buffer , pc) - numParameters] = result.value() ;
+            }
+            break ;
+            case RETURN: return stack.back() ;
+            default: assert(false) ; return nullopt ;
+        }
+        pc += operand_size(opcode , arithmeticMode) ;
+    }
+    return nullopt ;
+}
+//---------------------------------------------------------------------------
+std::string SerializedFunction::runtimeErrorMessage() {
+    assert(codeManager.has_value()) ;
+    return codeManager->runtimeErrorMessage() ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
@@ -0,0 +1,86 @@
+#ifndef PLJIT_SERIALIZEDFUNCTION_HPP
+#define PLJIT_SERIALIZEDFUNCTION_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/Arithmetic.hpp"
+#include "pljit/management/CodeManager.hpp"
+//---------------------------------------------------------------------------
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::semantic{
+//---------------------------------------------------------------------------
+/// Binary encoding of a FunctionAST (all integers are little-endian)
+///
+///     "PLJB" , u16 version , u8 arithmetic mode , u8 reserved
+///     u32 #parameters , u32 #variables , u32 #constants
+///     i64 constant value (one per constant slot)
+///     u32 source size , source code (used for error messages)
+///     u32 code size , code
+///
+/// code is a sequence of statements , each statement is its expression in postfix order followed by
+/// ASSIGN or RETURN . identifiers are encoded as frame slots (see SymbolTable::getSlot()) and all offsets
+/// are relative to the buffer , therefore the encoding is position-independent . a code reference is encoded as
+/// u32 start line , u32 start index , u32 end line , u32 end index
+class SerializedFunction {
+    public:
+    // version of the binary encoding
+    static constexpr uint16_t FORMAT_VERSION = 2 ;
+
+    enum Opcode : uint8_t {
+        LITERAL = 1 ,   // i64 value
+        LOAD ,          // u32 slot
+        NEGATE ,        // code reference of "-" if arithmetic is checked
+        ADD ,           // code reference of "+" if arithmetic is checked
+        SUBTRACT ,      // code reference of "-" if arithmetic is checked
+        MULTIPLY ,      // code reference of "*" if arithmetic is checked
+        DIVIDE ,        // code reference of "/"
+        ASSIGN ,        // u32 slot
+        RETURN
+    };
+
+    private:
+    // encoded function (not owned)
+    std::string_view buffer ;
+    // check if buffer is a well formed encoding
+    bool valid = false ;
+    // semantics of overflow , overflow triggers a runtime error if arithmetic is checked
+    management::ArithmeticMode arithmeticMode = management::ArithmeticMode::WRAPAROUND ;
+    uint32_t numParameters = 0 ;
+    uint32_t numVariables = 0 ;
+    uint32_t numConstants = 0 ;
+    // offset of constant values within buffer
+    size_t constantOffset = 0 ;
+    // offset and size of code within buffer
+    size_t codeOffset = 0 ;
+    size_t codeSize = 0 ;
+    // maximal depth of operand stack over all statements
+    size_t maxStackDepth = 0 ;
+    // code manager over embedded source code , used to print runtime errors
+    std::optional<management::CodeManager> codeManager ;
+
+    /// check header and code of buffer
+    bool validate() ;
+
+    public:
+    /// construct reader over buffer without copying it , buffer must outlive reader
+    explicit SerializedFunction(std::string_view buffer) ;
+
+    /// check if buffer is a valid encoding of current format version
+    bool isValid() const ;
+
+    /// number of parameters expected by evaluate()
+    size_t num_parameters() const ;
+
+    /// evaluate function directly from buffer , !has_value() if runtime error is triggered
+    std::optional<int64_t> evaluate(const std::vector<int64_t>& parameterList) ;
+
+    /// get runtime error message of last evaluation and clear it
+    std::string runtimeErrorMessage() ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::semantic
+//---------------------------------------------------------------------------
+#endif //PLJIT_SERIALIZEDFUNCTION_HPP
@@ -0,0 +1,68 @@
+#ifndef PLJIT_GRAMMAR_HPP
+#define PLJIT_GRAMMAR_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <string_view>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::syntax{
+//---------------------------------------------------------------------------
+/// token which is expected by the parser , printed as "expected <text>" (see CodeManager::printCompileError)
+struct ExpectedToken {
+    std::string_view text ;
+    // width of the marker behind the last line if the token is missing at end of file
+    size_t length = 1 ;
+};
+//---------------------------------------------------------------------------
+/// keywords and compile error messages of the PL language , shared by the runtime front end (TokenStream ,
+/// ParseTree , AST) and the static compiler (StaticPljit) so that both report the same errors
+struct Grammar {
+    static constexpr std::array<std::string_view , 6> KEYWORDS = {"PARAM" , "VAR" , "CONST" , "BEGIN" , "END" , "RETURN"} ;
+
+    // expected tokens of syntax errors
+    static constexpr ExpectedToken TERMINATOR = {"." , 1} ;
+    static constexpr ExpectedToken SEMI_COLON = {";" , 1} ;
+    static constexpr ExpectedToken CONST_ASSIGNMENT = {"=" , 1} ;
+    static constexpr ExpectedToken VAR_ASSIGNMENT = {":=" , 2} ;
+    static constexpr ExpectedToken CLOSE_BRACKET = {")" , 1} ;
+    static constexpr ExpectedToken BEGIN = {"BEGIN" , 5} ;
+    static constexpr ExpectedToken END = {"END" , 3} ;
+    static constexpr ExpectedToken IDENTIFIER = {"Identifier Token" , 1} ;
+    static constexpr ExpectedToken LITERAL = {"Literal Token" , 1} ;
+    static constexpr ExpectedToken PRIMARY_EXPRESSION = {"Identifier , Literal or Open Bracket" , 1} ;
+    // the parser words the expected statement differently at end of file , at a keyword and at any other token
+    static constexpr ExpectedToken STATEMENT_AT_END = {"Return or Identifier token" , 1} ;
+    static constexpr ExpectedToken STATEMENT_AT_KEYWORD = {"RETURN statement or Identifier token" , 1} ;
+    static constexpr ExpectedToken STATEMENT = {"RETURN or Identifier Token" , 1} ;
+
+    // messages of semantic errors
+    static constexpr std::string_view ALREADY_DECLARED = "Already declared" ;
+    static constexpr std::string_view UNDECLARED_IDENTIFIER = "Undeclared Identifier" ;
+    static constexpr std::string_view UNINITIALIZED_IDENTIFIER = "Uninitialized Identifier" ;
+    static constexpr std::string_view CONSTANT_ASSIGNMENT = "Constant Assignment" ;
+    static constexpr std::string_view MISSING_RETURN = "Missing Return Statement" ;
+
+    /// true if text is a keyword
+    static constexpr bool isKeyword(std::string_view text) {
+        for(std::string_view keyword : KEYWORDS)
+            if(keyword == text)
+                return true ;
+        return false ;
+    }
+    /// character of identifiers
+    static constexpr bool isLetter(char c) {
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ;
+    }
+    /// character of literals
+    static constexpr bool isDigit(char c) {
+        return '0' <= c && c <= '9' ;
+    }
+    /// separator of tokens
+    static constexpr bool isWhiteSpace(char c) {
+        return c == ' ' || c == '\f' || c == '\n' || c == '\r' || c == '\t' || c == '\v' ;
+    }
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::syntax
+//---------------------------------------------------------------------------
+#endif //PLJIT_GRAMMAR_HPP
@@ -1,4 +1,5 @@
 #include "pljit/syntax/ParseTree.hpp"
+#include "pljit/syntax/Grammar.hpp"
 #include "pljit/syntax/ParseTreeVisitor.hpp"
 #include "pljit/syntax/PrintParseTreeVisitor.hpp"
 
@@ -58,7 +59,7 @@ std::string_view TerminalNode::print_token() const {
     size_t last = codeReference.getEndLineRange().second ;
     return codeManager->getCurrentLine(line).substr(begin , last - begin + 1) ;
 }
-NonTerminalNode::NonTerminalNode(management::CodeManager* manager) {
+NonTerminalNode::NonTerminalNode(management::CodeManager* manager , std::pmr::memory_resource* resource) : children(resource) {
     node_index = node_index_incrementer++ ;
     codeManager = manager ;
 }
@@ -68,30 +69,45 @@ const ParseTreeNode& NonTerminalNode::getChild(size_t index) const {
 std::size_t NonTerminalNode::num_children() const {
     return children.size() ;
 }
+std::size_t NonTerminalNode::num_nodes() const {
+    size_t count = 1 ;
+    for(const management::ResourcePointer<ParseTreeNode>& child : children)
+        count += child->num_nodes() ;
+    return count ;
+}
+std::size_t TerminalNode::num_nodes() const {
+    return 1 ;
+}
 
 ParseTreeNode::Type FunctionDeclaration::getType() const {
     return Type::FUNCTION_DECLARATION ;
 }
-FunctionDeclaration::FunctionDeclaration(management::CodeManager* manager) : NonTerminalNode(manager) {
+FunctionDeclaration::FunctionDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool FunctionDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     { // PARAMETER
-        unique_ptr<ParameterDeclaration> parameter_ptr = make_unique<ParameterDeclaration>(codeManager);
+        management::ResourcePointer<ParameterDeclaration> parameter_ptr = makeChild<ParameterDeclaration>(codeManager);
         if (parameter_ptr->recursiveDescentParser(tokenStream)) // optional
             children.emplace_back(std::move(parameter_ptr));
+        else if (codeManager->isCodeError()) // declaration is present but invalid
+            return false;
     }
     { // VARIABLE
-        unique_ptr<VariableDeclaration> variable_ptr = make_unique<VariableDeclaration>(codeManager);
+        management::ResourcePointer<VariableDeclaration> variable_ptr = makeChild<VariableDeclaration>(codeManager);
         if (variable_ptr->recursiveDescentParser(tokenStream)) // optional
             children.emplace_back(std::move(variable_ptr));
+        else if (codeManager->isCodeError()) // declaration is present but invalid
+            return false;
     }
     { // CONSTANT
-        unique_ptr<ConstantDeclaration> constant_ptr = make_unique<ConstantDeclaration>(codeManager);
+        management::ResourcePointer<ConstantDeclaration> constant_ptr = makeChild<ConstantDeclaration>(codeManager);
         if (constant_ptr->recursiveDescentParser(tokenStream)) // optional
             children.emplace_back(std::move(constant_ptr));
+        else if (codeManager->isCodeError()) // declaration is present but invalid
+            return false;
     }
     { // COMPOUND
-        unique_ptr<CompoundStatement> compound_ptr = make_unique<CompoundStatement>(codeManager);
+        management::ResourcePointer<CompoundStatement> compound_ptr = makeChild<CompoundStatement>(codeManager);
         if (compound_ptr->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(compound_ptr));
         else {
@@ -100,17 +116,17 @@ bool FunctionDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     }
     { // TERMINATOR
         if(tokenStream.isEmpty()) {
-            codeManager->printCompileError(1 , ".") ;
+            codeManager->printCompileError(Grammar::TERMINATOR.length , Grammar::TERMINATOR.text) ;
             return false ;
         }
         else if (tokenStream.lookup().getTokenType() == TokenStream::TokenType::TERMINATOR) {
             TokenStream::Token token = tokenStream.lookup();
             tokenStream.nextToken();
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager , token.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager , token.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference()  , ".") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::TERMINATOR.text) ;
             return false;
         }
     }
@@ -122,7 +138,7 @@ void FunctionDeclaration::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type ParameterDeclaration::getType() const {
     return Type::PARAMETER_DECLARATION ;
 }
-ParameterDeclaration::ParameterDeclaration(management::CodeManager* manager) : NonTerminalNode(manager) {
+ParameterDeclaration::ParameterDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool ParameterDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     { // KEYWORD "PARAM"
@@ -138,7 +154,7 @@ bool ParameterDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
             size_t last_index = token.getCodeReference().getEndLineRange().second ;
             string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
             if(token_str == "PARAM") {
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager , token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager , token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
@@ -153,7 +169,7 @@ bool ParameterDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
         }
     }
     { // declarator-list
-        unique_ptr<DeclaratorList> declaratorList = make_unique<DeclaratorList>(codeManager ) ;
+        management::ResourcePointer<DeclaratorList> declaratorList = makeChild<DeclaratorList>(codeManager ) ;
         if(declaratorList->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(declaratorList)) ;
         else {
@@ -163,17 +179,17 @@ bool ParameterDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     { // semi-colon line separator
         if(tokenStream.isEmpty()) {
             // compile error , since PARAM keyword is passed
-            codeManager->printCompileError(1 , ";") ;
+            codeManager->printCompileError(Grammar::SEMI_COLON.length , Grammar::SEMI_COLON.text) ;
             return false ;
         }
         // inside terminal node
         if(tokenStream.lookup().getTokenType() == TokenStream::SEMI_COLON_SEPARATOR) {
             TokenStream::Token token = tokenStream.nextToken();
-            children.emplace_back(make_unique<GenericToken>(this->codeManager , token.getCodeReference()));
+            children.emplace_back(makeChild<GenericToken>(this->codeManager , token.getCodeReference()));
         }
         else {
             // compile error , since PARAM keyword is passed
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , ";") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::SEMI_COLON.text) ;
             return false ;
         }
     }
@@ -182,7 +198,7 @@ bool ParameterDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
 void ParameterDeclaration::accept(ParseTreeVisitor& parseTreeVisitor) const {
     parseTreeVisitor.visit(*this) ;
 }
-VariableDeclaration::VariableDeclaration(management::CodeManager* manager) : NonTerminalNode(manager) {
+VariableDeclaration::VariableDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
     node_index = node_index_incrementer++ ;
 }
 ParseTreeNode::Type VariableDeclaration::getType() const {
@@ -201,7 +217,7 @@ bool VariableDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
             size_t last_index = token.getCodeReference().getEndLineRange().second ;
             string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
             if(token_str == "VAR") {
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
@@ -214,7 +230,7 @@ bool VariableDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
         }
     }
     { // declarator list
-        unique_ptr<DeclaratorList> declaratorList = make_unique<DeclaratorList>(codeManager ) ;
+        management::ResourcePointer<DeclaratorList> declaratorList = makeChild<DeclaratorList>(codeManager ) ;
         if(declaratorList->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(declaratorList)) ;
         else
@@ -223,19 +239,19 @@ bool VariableDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     { // semi-colon
         if(tokenStream.isEmpty()){
             // compile error , since VAR keyword is passed
-            codeManager->printCompileError(1 , ";")  ;
+            codeManager->printCompileError(Grammar::SEMI_COLON.length , Grammar::SEMI_COLON.text)  ;
             return false ;
         }
         // inside terminal node
         if(tokenStream.lookup().getTokenType() == TokenStream::SEMI_COLON_SEPARATOR) {
             TokenStream::Token token = tokenStream.nextToken();
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
         else
         {
             // compile error , since VAR keyword is passed
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , ";") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::SEMI_COLON.text) ;
             return false ;
         }
     }
@@ -248,7 +264,7 @@ void VariableDeclaration::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type ConstantDeclaration::getType() const {
     return Type::CONSTANT_DECLARATION ;
 }
-ConstantDeclaration::ConstantDeclaration(management::CodeManager* manager) : NonTerminalNode(manager) {
+ConstantDeclaration::ConstantDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool ConstantDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
     { // Keyword "CONST"
@@ -263,7 +279,7 @@ bool ConstantDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
             size_t last_index = token.getCodeReference().getEndLineRange().second ;
             string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
             if(token_str == "CONST") {
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager , token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager , token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
@@ -278,7 +294,7 @@ bool ConstantDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
         }
     }
     { // init-declarator-list
-        unique_ptr<InitDeclaratorList> initDeclaratorList = make_unique<InitDeclaratorList>(codeManager) ;
+        management::ResourcePointer<InitDeclaratorList> initDeclaratorList = makeChild<InitDeclaratorList>(codeManager) ;
         if(initDeclaratorList->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(initDeclaratorList)) ;
         else
@@ -289,18 +305,18 @@ bool ConstantDeclaration::recursiveDescentParser(TokenStream& tokenStream) {
         if(tokenStream.isEmpty())
         {
             // compile error , since CONST keyword is passed
-            codeManager->printCompileError(1 , ";") ;
+            codeManager->printCompileError(Grammar::SEMI_COLON.length , Grammar::SEMI_COLON.text) ;
             return false ;
         }
         if(tokenStream.lookup().getTokenType() == TokenStream::SEMI_COLON_SEPARATOR)
         {
             TokenStream::Token token = tokenStream.nextToken();
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
         else
         {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference(), ";") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::SEMI_COLON.text) ;
             return false ;
         }
     }
@@ -312,11 +328,11 @@ void ConstantDeclaration::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type DeclaratorList::getType() const {
     return Type::DECLARATOR_LIST ;
 }
-DeclaratorList::DeclaratorList(management::CodeManager* manager) : NonTerminalNode(manager) {
+DeclaratorList::DeclaratorList(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool DeclaratorList::recursiveDescentParser(TokenStream& tokenStream) {
     { // identifier
-        unique_ptr<Identifier> identifierToken = make_unique<Identifier>(codeManager) ;
+        management::ResourcePointer<Identifier> identifierToken = makeChild<Identifier>(codeManager) ;
         if(identifierToken->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(identifierToken)) ;
         else
@@ -327,11 +343,11 @@ bool DeclaratorList::recursiveDescentParser(TokenStream& tokenStream) {
         {
             { // ","
                 TokenStream::Token commaToken = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, commaToken.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, commaToken.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // "identifier"
-                unique_ptr<Identifier> identifierToken = make_unique<Identifier>(codeManager);
+                management::ResourcePointer<Identifier> identifierToken = makeChild<Identifier>(codeManager);
                 if (identifierToken->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(identifierToken));
                 else {
@@ -348,11 +364,11 @@ void DeclaratorList::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type InitDeclaratorList::getType() const {
     return Type::INIT_DECLARATOR_LIST ;
 }
-InitDeclaratorList::InitDeclaratorList(management::CodeManager* manager) : NonTerminalNode(manager) {
+InitDeclaratorList::InitDeclaratorList(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool InitDeclaratorList::recursiveDescentParser(TokenStream& tokenStream) {
     { // init-declarator
-        unique_ptr<InitDeclarator> initDeclarator = make_unique<InitDeclarator>(codeManager);
+        management::ResourcePointer<InitDeclarator> initDeclarator = makeChild<InitDeclarator>(codeManager);
 
         if (initDeclarator->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(initDeclarator));
@@ -364,11 +380,11 @@ bool InitDeclaratorList::recursiveDescentParser(TokenStream& tokenStream) {
         while (!tokenStream.isEmpty() && tokenStream.lookup().getTokenType() == TokenStream::COMMA_SEPARATOR) {
             { // ","
                 TokenStream::Token commaToken = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, commaToken.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, commaToken.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // "init-declarator"
-                unique_ptr<InitDeclarator> initDeclarator = make_unique<InitDeclarator>(codeManager);
+                management::ResourcePointer<InitDeclarator> initDeclarator = makeChild<InitDeclarator>(codeManager);
                 if (initDeclarator->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(initDeclarator));
                 else {
@@ -386,11 +402,11 @@ void InitDeclaratorList::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type InitDeclarator::getType() const {
     return Type::INIT_DECLARATOR ;
 }
-InitDeclarator::InitDeclarator(management::CodeManager* manager) : NonTerminalNode(manager) {
+InitDeclarator::InitDeclarator(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool InitDeclarator::recursiveDescentParser(TokenStream& tokenStream) {
     { // identifier
-        unique_ptr<Identifier> identifierToken = make_unique<Identifier>(codeManager ) ;
+        management::ResourcePointer<Identifier> identifierToken = makeChild<Identifier>(codeManager ) ;
         if(identifierToken->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(identifierToken)) ;
         else
@@ -400,21 +416,21 @@ bool InitDeclarator::recursiveDescentParser(TokenStream& tokenStream) {
     }
     { // "="
         if(tokenStream.isEmpty()) {
-            codeManager->printCompileError(1 , "=") ;
+            codeManager->printCompileError(Grammar::CONST_ASSIGNMENT.length , Grammar::CONST_ASSIGNMENT.text) ;
             return false ;
         }
         else if (tokenStream.lookup().getTokenType() == TokenStream::CONST_ASSIGNMENT) {
             TokenStream::Token constAssignment = tokenStream.nextToken();
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,constAssignment.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,constAssignment.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "=") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::CONST_ASSIGNMENT.text) ;
             return false ;
         }
     }
     { // literal
-        unique_ptr<Literal> literal_ptr = make_unique<Literal>(codeManager) ;
+        management::ResourcePointer<Literal> literal_ptr = makeChild<Literal>(codeManager) ;
         if(literal_ptr->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(literal_ptr)) ;
         else {
@@ -429,12 +445,12 @@ void InitDeclarator::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type CompoundStatement::getType() const {
     return Type::COMPOUND_STATEMENT ;
 }
-CompoundStatement::CompoundStatement(management::CodeManager* manager) : NonTerminalNode(manager) {
+CompoundStatement::CompoundStatement(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool CompoundStatement::recursiveDescentParser(TokenStream& tokenStream) {
     { // Keyword "BEGIN"
         if(tokenStream.isEmpty()) {
-            codeManager->printCompileError(5 , "BEGIN") ;
+            codeManager->printCompileError(Grammar::BEGIN.length , Grammar::BEGIN.text) ;
             return false ;
         }
         if (tokenStream.lookup().getTokenType() == TokenStream::KEYWORD) {
@@ -443,23 +459,23 @@ bool CompoundStatement::recursiveDescentParser(TokenStream& tokenStream) {
             size_t start_index = token.getCodeReference().getStartLineRange().second ;
             size_t last_index = token.getCodeReference().getEndLineRange().second ;
             string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
-            if(token_str == "BEGIN") {
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+            if(token_str == Grammar::BEGIN.text) {
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
             else {
-                codeManager->printCompileError(tokenStream.lookup().getCodeReference(), "BEGIN") ;
+                codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::BEGIN.text) ;
                 return false ;
             }
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "BEGIN") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::BEGIN.text) ;
             return false ;
         }
     }
     { // statement-list
-        unique_ptr<StatementList> statementList = make_unique<StatementList>(codeManager) ;
+        management::ResourcePointer<StatementList> statementList = makeChild<StatementList>(codeManager) ;
         if(statementList->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(statementList)) ;
         else {
@@ -468,7 +484,7 @@ bool CompoundStatement::recursiveDescentParser(TokenStream& tokenStream) {
     }
     { // Keyword "END"
         if(tokenStream.isEmpty()) {
-            codeManager->printCompileError(3 , "END") ;
+            codeManager->printCompileError(Grammar::END.length , Grammar::END.text) ;
             return false ;
         }
         if (tokenStream.lookup().getTokenType() == TokenStream::KEYWORD) {
@@ -477,18 +493,18 @@ bool CompoundStatement::recursiveDescentParser(TokenStream& tokenStream) {
             size_t start_index = token.getCodeReference().getStartLineRange().second ;
             size_t last_index = token.getCodeReference().getEndLineRange().second ;
             string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
-            if(token_str == "END") {
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+            if(token_str == Grammar::END.text) {
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
             else {
-                codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "END") ;
+                codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::END.text) ;
                 return false ;
             }
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "END") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::END.text) ;
             return false ;
         }
     }
@@ -500,11 +516,11 @@ void CompoundStatement::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type StatementList::getType() const {
     return Type::STATEMENT_LIST ;
 }
-StatementList::StatementList(management::CodeManager* manager) : NonTerminalNode(manager) {
+StatementList::StatementList(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool StatementList::recursiveDescentParser(TokenStream& tokenStream) {
     { // statement
-        unique_ptr<Statement> statement_ptr = make_unique<Statement>(codeManager);
+        management::ResourcePointer<Statement> statement_ptr = makeChild<Statement>(codeManager);
         if(statement_ptr->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(statement_ptr)) ;
         else
@@ -515,11 +531,11 @@ bool StatementList::recursiveDescentParser(TokenStream& tokenStream) {
         while (!tokenStream.isEmpty() && tokenStream.lookup().getTokenType() == TokenStream::SEMI_COLON_SEPARATOR) {
             { // ";"
                 TokenStream::Token commaToken = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, commaToken.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, commaToken.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // statement
-                unique_ptr<Statement> statement_ptr = make_unique<Statement>(codeManager);
+                management::ResourcePointer<Statement> statement_ptr = makeChild<Statement>(codeManager);
                 if (statement_ptr->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(statement_ptr));
                 else
@@ -535,11 +551,11 @@ void StatementList::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type Statement::getType() const {
     return Type::STATEMENT ;
 }
-Statement::Statement(management::CodeManager* manager) : NonTerminalNode(manager) {
+Statement::Statement(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool Statement::recursiveDescentParser(TokenStream& tokenStream) {
     if(tokenStream.isEmpty()) {
-        codeManager->printCompileError(1 , "Return or Identifier token") ;
+        codeManager->printCompileError(Grammar::STATEMENT_AT_END.length , Grammar::STATEMENT_AT_END.text) ;
         return false ;
     }
     // "RETURN" additive-expression
@@ -551,12 +567,12 @@ bool Statement::recursiveDescentParser(TokenStream& tokenStream) {
         string_view token_str = line.substr(start_index , last_index - start_index + 1) ;
         if(token_str == "RETURN") {
             { // "RETURN"
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
                 tokenStream.nextToken();
             }
             { // "additive-statement"
-                unique_ptr<AdditiveExpression> additiveExpression = make_unique<AdditiveExpression>(codeManager ) ;
+                management::ResourcePointer<AdditiveExpression> additiveExpression = makeChild<AdditiveExpression>(codeManager ) ;
                 if(additiveExpression->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(additiveExpression)) ;
                 else
@@ -564,20 +580,20 @@ bool Statement::recursiveDescentParser(TokenStream& tokenStream) {
             }
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "RETURN statement or Identifier token") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::STATEMENT_AT_KEYWORD.text) ;
             return false ;
         }
     }
     /// assignment-expression
     else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::IDENTIFIER) {
-        unique_ptr<AssignmentExpression> assignmentExpression = make_unique<AssignmentExpression>(codeManager) ;
+        management::ResourcePointer<AssignmentExpression> assignmentExpression = makeChild<AssignmentExpression>(codeManager) ;
         if(assignmentExpression->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(assignmentExpression)) ;
         else
             return false ;
     }
     else {
-        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "RETURN or Identifier Token") ;
+        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::STATEMENT.text) ;
         return false ;
     }
     return true ;
@@ -588,11 +604,11 @@ void Statement::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type AdditiveExpression::getType() const {
     return Type::ADDITIVE_EXPRESSION ;
 }
-AdditiveExpression::AdditiveExpression(management::CodeManager* manager) : NonTerminalNode(manager) {
+AdditiveExpression::AdditiveExpression(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool AdditiveExpression::recursiveDescentParser(TokenStream& tokenStream) {
     { // multiplicative-expression
-        unique_ptr<MultiplicativeExpression> multiplicativeExpression = make_unique<MultiplicativeExpression>(codeManager) ;
+        management::ResourcePointer<MultiplicativeExpression> multiplicativeExpression = makeChild<MultiplicativeExpression>(codeManager) ;
         if(multiplicativeExpression->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(multiplicativeExpression)) ;
         else {
@@ -604,11 +620,11 @@ bool AdditiveExpression::recursiveDescentParser(TokenStream& tokenStream) {
         {
             { //('+' | '-')
                 TokenStream::Token operatorToken = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, operatorToken.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, operatorToken.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // additive-expression
-                unique_ptr<AdditiveExpression> additiveExpression = make_unique<AdditiveExpression>(codeManager);
+                management::ResourcePointer<AdditiveExpression> additiveExpression = makeChild<AdditiveExpression>(codeManager);
                 if (additiveExpression->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(additiveExpression));
                 else {
@@ -625,11 +641,11 @@ void AdditiveExpression::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type MultiplicativeExpression::getType() const {
     return Type::MULTIPLICATIVE_EXPRESSION ;
 }
-MultiplicativeExpression::MultiplicativeExpression(management::CodeManager* manager) : NonTerminalNode(manager) {
+MultiplicativeExpression::MultiplicativeExpression(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool MultiplicativeExpression::recursiveDescentParser(TokenStream& tokenStream) {
     { // unary-expression
-        unique_ptr<UnaryExpression> unaryExpression = make_unique<UnaryExpression>(codeManager);
+        management::ResourcePointer<UnaryExpression> unaryExpression = makeChild<UnaryExpression>(codeManager);
         if (unaryExpression->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(unaryExpression)) ;
         else
@@ -639,11 +655,11 @@ bool MultiplicativeExpression::recursiveDescentParser(TokenStream& tokenStream)
         if(!tokenStream.isEmpty() && (tokenStream.lookup().getTokenType() == TokenStream::TokenType::MULTIPLY_OPERATOR || tokenStream.lookup().getTokenType() == TokenStream::TokenType::DIVIDE_OPERATOR)) {
             { // ('*' | '/')
                 TokenStream::Token operatorToken = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, operatorToken.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, operatorToken.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // multiplicative-expression
-                unique_ptr<MultiplicativeExpression> multiplicativeExpression = make_unique<MultiplicativeExpression>(codeManager);
+                management::ResourcePointer<MultiplicativeExpression> multiplicativeExpression = makeChild<MultiplicativeExpression>(codeManager);
                 if (multiplicativeExpression->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(multiplicativeExpression));
                 else {
@@ -660,11 +676,11 @@ void MultiplicativeExpression::accept(ParseTreeVisitor& parseTreeVisitor) const
 ParseTreeNode::Type AssignmentExpression::getType() const {
     return Type::ASSIGNMENT_EXPRESSION ;
 }
-AssignmentExpression::AssignmentExpression(management::CodeManager* manager) : NonTerminalNode(manager) {
+AssignmentExpression::AssignmentExpression(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool AssignmentExpression::recursiveDescentParser(TokenStream& tokenStream) {
     { // identifier
-        unique_ptr<Identifier> identifierToken = make_unique<Identifier>(codeManager) ;
+        management::ResourcePointer<Identifier> identifierToken = makeChild<Identifier>(codeManager) ;
         if(identifierToken->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(identifierToken)) ;
         else
@@ -674,17 +690,17 @@ bool AssignmentExpression::recursiveDescentParser(TokenStream& tokenStream) {
     }
     { // ":= additive-expression"
         if(tokenStream.isEmpty()) {
-            codeManager->printCompileError(2 , ":=") ;
+            codeManager->printCompileError(Grammar::VAR_ASSIGNMENT.length , Grammar::VAR_ASSIGNMENT.text) ;
             return false ;
         }
         else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::VAR_ASSIGNMENT) {
             { // ":="
                 TokenStream::Token token = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             { // "additive-expression"
-                unique_ptr<AdditiveExpression> additiveExpression = make_unique<AdditiveExpression>(codeManager);
+                management::ResourcePointer<AdditiveExpression> additiveExpression = makeChild<AdditiveExpression>(codeManager);
                 if (additiveExpression->recursiveDescentParser(tokenStream))
                     children.emplace_back(std::move(additiveExpression));
                 else
@@ -692,7 +708,7 @@ bool AssignmentExpression::recursiveDescentParser(TokenStream& tokenStream) {
             }
         }
         else {
-            codeManager->printCompileError(tokenStream.lookup().getCodeReference(), ":=") ;
+            codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::VAR_ASSIGNMENT.text) ;
             return false ;
         }
     }
@@ -704,18 +720,18 @@ void AssignmentExpression::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type UnaryExpression::getType() const {
     return Type::UNARY_EXPRESSION ;
 }
-UnaryExpression::UnaryExpression(management::CodeManager* manager) : NonTerminalNode(manager) {
+UnaryExpression::UnaryExpression(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool UnaryExpression::recursiveDescentParser(TokenStream& tokenStream) {
     { // ['+' | '-']
         if ((tokenStream.lookup().getTokenType() == TokenStream::TokenType::PLUS_OPERATOR) || (tokenStream.lookup().getTokenType() == TokenStream::TokenType::MINUS_OPERATOR)) {
             TokenStream::Token token = tokenStream.nextToken();
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager, token.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager, token.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
     }
     { // primary-expression
-        unique_ptr<PrimaryExpression> primaryExpression = make_unique<PrimaryExpression>(codeManager);
+        management::ResourcePointer<PrimaryExpression> primaryExpression = makeChild<PrimaryExpression>(codeManager);
         if (primaryExpression->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(primaryExpression));
         else {
@@ -730,17 +746,17 @@ void UnaryExpression::accept(ParseTreeVisitor& parseTreeVisitor) const {
 ParseTreeNode::Type PrimaryExpression::getType() const {
     return Type::PRIMARY_EXPRESSION ;
 }
-PrimaryExpression::PrimaryExpression(management::CodeManager* manager) : NonTerminalNode(manager) {
+PrimaryExpression::PrimaryExpression(management::CodeManager* manager , std::pmr::memory_resource* resource) : NonTerminalNode(manager , resource) {
 }
 bool PrimaryExpression::recursiveDescentParser(TokenStream& tokenStream) {
     if(tokenStream.isEmpty())
     {
-        codeManager->printCompileError(1 , "Identifier , Literal or Open Bracket") ;
+        codeManager->printCompileError(Grammar::PRIMARY_EXPRESSION.length , Grammar::PRIMARY_EXPRESSION.text) ;
         return false ;
     }
     // identifier
     else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::IDENTIFIER) {
-        unique_ptr<Identifier> identifier = make_unique<Identifier>(codeManager) ;
+        management::ResourcePointer<Identifier> identifier = makeChild<Identifier>(codeManager) ;
         if(identifier->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(identifier)) ;
         else
@@ -748,7 +764,7 @@ bool PrimaryExpression::recursiveDescentParser(TokenStream& tokenStream) {
     }
     // literal
     else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::LITERAL) {
-        unique_ptr<Literal> literal = make_unique<Literal>(codeManager) ;
+        management::ResourcePointer<Literal> literal = makeChild<Literal>(codeManager) ;
         if(literal->recursiveDescentParser(tokenStream))
             children.emplace_back(std::move(literal)) ;
         else
@@ -758,11 +774,11 @@ bool PrimaryExpression::recursiveDescentParser(TokenStream& tokenStream) {
     else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::OPEN_BRACKET) {
         { // "("
             TokenStream::Token open_bracket_token = tokenStream.nextToken() ;
-            unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,open_bracket_token.getCodeReference());
+            management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,open_bracket_token.getCodeReference());
             children.emplace_back(std::move(genericToken));
         }
         { // "additive-expression"
-            unique_ptr<AdditiveExpression> additiveExpression = make_unique<AdditiveExpression>(codeManager) ;
+            management::ResourcePointer<AdditiveExpression> additiveExpression = makeChild<AdditiveExpression>(codeManager) ;
             if(additiveExpression->recursiveDescentParser(tokenStream))
                 children.emplace_back(std::move(additiveExpression)) ;
             else
@@ -770,22 +786,22 @@ bool PrimaryExpression::recursiveDescentParser(TokenStream& tokenStream) {
         }
         { // ")"
             if(tokenStream.isEmpty()) {
-                codeManager->printCompileError(1 , ")") ;
+                codeManager->printCompileError(Grammar::CLOSE_BRACKET.length , Grammar::CLOSE_BRACKET.text) ;
                 return false ;
             }
             else if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::CLOSE_BRACKET) {
                 TokenStream::Token close_bracket_token = tokenStream.nextToken();
-                unique_ptr<GenericToken> genericToken = make_unique<GenericToken>(this->codeManager ,close_bracket_token.getCodeReference());
+                management::ResourcePointer<GenericToken> genericToken = makeChild<GenericToken>(this->codeManager ,close_bracket_token.getCodeReference());
                 children.emplace_back(std::move(genericToken));
             }
             else {
-                codeManager->printCompileError(tokenStream.lookup().getCodeReference() , ")") ;
+                codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::CLOSE_BRACKET.text) ;
                 return false ;
             }
         }
     }
     else {
-        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "Identifier , Literal or Open Bracket") ;
+        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::PRIMARY_EXPRESSION.text) ;
         return false ;
     }
     return true ;
@@ -801,7 +817,7 @@ Identifier::Identifier(management::CodeManager* manager) : TerminalNode(manager)
 bool Identifier::recursiveDescentParser(TokenStream& tokenStream) {
     // identifier
     if(tokenStream.isEmpty()) {
-        codeManager->printCompileError(1 , "Identifier Token") ;
+        codeManager->printCompileError(Grammar::IDENTIFIER.length , Grammar::IDENTIFIER.text) ;
         return false ;
     }
     if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::IDENTIFIER) {
@@ -809,7 +825,7 @@ bool Identifier::recursiveDescentParser(TokenStream& tokenStream) {
         this->codeReference = identifier_token.getCodeReference() ;
     }
     else {
-        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "Identifier Token") ;
+        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::IDENTIFIER.text) ;
         return false ;
     }
     return true ;
@@ -825,7 +841,7 @@ ParseTreeNode::Type Literal::getType() const {
 bool Literal::recursiveDescentParser(TokenStream& tokenStream) {
     // literal
     if(tokenStream.isEmpty()) {
-        codeManager->printCompileError(1 , "Literal Token") ;
+        codeManager->printCompileError(Grammar::LITERAL.length , Grammar::LITERAL.text) ;
         return false ;
     }
     if(tokenStream.lookup().getTokenType() == TokenStream::TokenType::LITERAL) {
@@ -833,7 +849,7 @@ bool Literal::recursiveDescentParser(TokenStream& tokenStream) {
         this->codeReference = literal.getCodeReference();
     }
     else {
-        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , "Literal Token") ;
+        codeManager->printCompileError(tokenStream.lookup().getCodeReference() , Grammar::LITERAL.text) ;
         return false ;
     }
     node_index = node_index_incrementer++ ;
@@ -1,8 +1,10 @@
 #ifndef PLJIT_PARSETREE_HPP
 #define PLJIT_PARSETREE_HPP
 //---------------------------------------------------------------------------
+#include "pljit/management/MemoryAccount.hpp"
 #include "pljit/syntax/TokenStream.hpp"
 #include <memory>
+#include <type_traits>
 namespace jitcompiler ::syntax{
 //---------------------------------------------------------------------------
 /// forward declaration to use it in accept() member function
@@ -51,6 +53,8 @@ public:
     virtual Type getType() const = 0 ;
     /// accept method using Visitor design pattern
     virtual void accept(ParseTreeVisitor& parseTreeVisitor) const  = 0 ;
+    /// number of nodes of subtree (including this node)
+    virtual std::size_t num_nodes() const = 0 ;
 
     private:
     /// apply recursive descent parser algorithm
@@ -88,13 +92,25 @@ class TerminalNode : public ParseTreeNode {
 
     /// get code reference of terminal token
     management::CodeReference getReference() const ;
+
+    std::size_t num_nodes() const override ;
 };
 class NonTerminalNode : public ParseTreeNode {
     protected:
-    /// children parse tree node of a non terminal node
-    std::vector<std::unique_ptr<ParseTreeNode>> children ;
+    /// children parse tree node of a non terminal node , children and their list are allocated from the same resource
+    std::pmr::vector<management::ResourcePointer<ParseTreeNode>> children ;
+
+    explicit NonTerminalNode(management::CodeManager* manager , std::pmr::memory_resource* resource)  ;
 
-    explicit NonTerminalNode(management::CodeManager* manager)  ;
+    /// allocate child from resource of children , non terminal children pass it on to their own children
+    template <typename T , typename... Args>
+    management::ResourcePointer<T> makeChild(Args&&... args) const {
+        std::pmr::memory_resource* resource = children.get_allocator().resource() ;
+        if constexpr(std::is_base_of_v<NonTerminalNode , T>)
+            return management::make_resource<T>(resource , std::forward<Args>(args)... , resource) ;
+        else
+            return management::make_resource<T>(resource , std::forward<Args>(args)...) ;
+    }
 
     public:
     /// get a child with corresponding index
@@ -102,6 +118,8 @@ class NonTerminalNode : public ParseTreeNode {
 
     /// get number of children
     std::size_t num_children() const ;
+
+    std::size_t num_nodes() const override ;
 };
 //---------------------------------------------------------------------------
 class FunctionDeclaration final : public NonTerminalNode {
@@ -109,7 +127,7 @@ class FunctionDeclaration final : public NonTerminalNode {
     bool recursiveDescentParser(TokenStream& tokenStream) override;
     
     public:
-    explicit FunctionDeclaration(management::CodeManager* manager)  ;
+    explicit FunctionDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
     
     Type getType() const override ;
     
@@ -123,7 +141,7 @@ class ParameterDeclaration final : public NonTerminalNode {
     friend class FunctionDeclaration ; 
 
     public:
-    explicit ParameterDeclaration(management::CodeManager* manager) ;
+    explicit ParameterDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
     Type getType() const override ;
     void accept(ParseTreeVisitor& parseTreeVisitor) const override ;
 };
@@ -134,7 +152,7 @@ class VariableDeclaration final : public NonTerminalNode {
     friend class FunctionDeclaration ; 
     
     public:
-    explicit VariableDeclaration(management::CodeManager* manager) ;
+    explicit VariableDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
     Type getType() const override ;
     void accept(ParseTreeVisitor& parseTreeVisitor) const override ;
 };
@@ -145,7 +163,7 @@ class ConstantDeclaration final : public NonTerminalNode {
     friend class FunctionDeclaration ; 
 
     public:
-    explicit ConstantDeclaration(management::CodeManager* manager )   ;
+    explicit ConstantDeclaration(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
     
@@ -162,7 +180,7 @@ class DeclaratorList final : public NonTerminalNode {
     
     public:
 
-    explicit DeclaratorList(management::CodeManager* manager) ;
+    explicit DeclaratorList(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
     
@@ -172,7 +190,7 @@ class DeclaratorList final : public NonTerminalNode {
 class InitDeclaratorList final : public NonTerminalNode {
     public:
 
-    explicit InitDeclaratorList(management::CodeManager* manager) ;
+    explicit InitDeclaratorList(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -188,7 +206,7 @@ class InitDeclarator final : public NonTerminalNode {
     friend class InitDeclaratorList ; 
     
     public:
-    explicit InitDeclarator(management::CodeManager* manager) ;
+    explicit InitDeclarator(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
     
@@ -201,7 +219,7 @@ class CompoundStatement final : public NonTerminalNode {
     friend class FunctionDeclaration ;
     
     public:
-    explicit CompoundStatement(management::CodeManager* manager) ;
+    explicit CompoundStatement(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
     
@@ -214,7 +232,7 @@ class StatementList final : public NonTerminalNode {
     friend class CompoundStatement ; 
 
     public:
-    explicit StatementList(management::CodeManager* manager) ;
+    explicit StatementList(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -227,7 +245,7 @@ class Statement final : public NonTerminalNode {
     friend class StatementList ;
 
     public:
-    explicit Statement(management::CodeManager* manager) ;
+    explicit Statement(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -240,7 +258,7 @@ class AssignmentExpression final : public NonTerminalNode {
     friend class Statement ;
 
     public:
-    explicit AssignmentExpression(management::CodeManager* manager) ;
+    explicit AssignmentExpression(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -255,7 +273,7 @@ class AdditiveExpression final : public NonTerminalNode {
     friend class PrimaryExpression ;
 
     public:
-    explicit AdditiveExpression(management::CodeManager* manager) ;
+    explicit AdditiveExpression(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -268,7 +286,7 @@ class MultiplicativeExpression final : public NonTerminalNode {
     friend class AdditiveExpression ;
 
     public:
-    explicit MultiplicativeExpression(management::CodeManager* manager) ;
+    explicit MultiplicativeExpression(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -281,7 +299,7 @@ class UnaryExpression final : public NonTerminalNode {
     friend class MultiplicativeExpression ;
 
     public:
-    explicit UnaryExpression(management::CodeManager* manager ) ;
+    explicit UnaryExpression(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -294,7 +312,7 @@ class PrimaryExpression final : public NonTerminalNode {
     friend class UnaryExpression ;
     public:
 
-    explicit PrimaryExpression(management::CodeManager* manager) ;
+    explicit PrimaryExpression(management::CodeManager* manager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
 
     Type getType() const override ;
 
@@ -1,34 +1,16 @@
 #include "pljit/syntax/TokenStream.hpp"
+#include "pljit/syntax/Grammar.hpp"
 #include <array>
 #include <cassert>
 #include <algorithm>
 #include <optional>
 //---------------------------------------------------------------------------
 using namespace std ;
+using jitcompiler::syntax::Grammar ;
 //---------------------------------------------------------------------------
 namespace
 // helper functions
 {
-    //---------------------------------------------------------------------------
-    constexpr array<string_view , 6> keywords = {"PARAM" , "VAR" , "CONST" , "BEGIN" , "END" , "RETURN"} ;
-    //---------------------------------------------------------------------------
-    bool isWhiteSpace(char c)
-    /// if char is white space
-    {
-        return c == ' ' || c == '\f' || c == '\n' || c == '\r' || c == '\t' || c == '\v' ;
-    }
-    //---------------------------------------------------------------------------
-    bool isDigit(char c)
-    /// check if char is digit
-    {
-        return '0' <= c && c <= '9' ;
-    }
-    //---------------------------------------------------------------------------
-    bool isLetter(char c)
-    /// check if char is letter
-    {
-        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'z') ;
-    }
     //---------------------------------------------------------------------------
     bool isValidSpecialChar(char c)
     /// check if character is valid character for non-letter or non-digit chars
@@ -37,19 +19,11 @@ namespace
                 c == '=' || c == '(' || c == ')' ;
     }
     //---------------------------------------------------------------------------
-    bool isKeyword(string_view token)
-    /// check if token is keyword
-    {
-        return ranges::any_of(keywords.begin() , keywords.end() , [&token](string_view curr){
-            return curr == token ;
-        }) ;
-    }
-    //---------------------------------------------------------------------------
     bool isIdentifier(string_view token)
     /// check if token is identifier
     {
         return ranges::all_of(token.begin() , token.end() , [](char c){
-            return isLetter(c) ;
+            return Grammar::isLetter(c) ;
         }) ;
     }
     //---------------------------------------------------------------------------
@@ -57,7 +31,7 @@ namespace
     /// check if token is literal
     {
         return ranges::all_of(token.begin() , token.end() , [](char c){
-            return isDigit(c) ;
+            return Grammar::isDigit(c) ;
         }) ;
     }
     //---------------------------------------------------------------------------
@@ -66,9 +40,9 @@ namespace
     {
         size_t next_index = begin_index ;
         // if first character is letter or digit , then move next_index until it hits non letter and non digit char
-        if(isLetter(currentLine[begin_index]) || isDigit(currentLine[begin_index])) {
+        if(Grammar::isLetter(currentLine[begin_index]) || Grammar::isDigit(currentLine[begin_index])) {
             ++next_index ;
-            while(next_index != end_index && (isLetter(currentLine[next_index]) || isDigit(currentLine[next_index])))
+            while(next_index != end_index && (Grammar::isLetter(currentLine[next_index]) || Grammar::isDigit(currentLine[next_index])))
                 ++next_index ;
             return next_index ;
         }
@@ -88,7 +62,7 @@ namespace
 //---------------------------------------------------------------------------
 namespace jitcompiler ::syntax{
 //---------------------------------------------------------------------------
-TokenStream::TokenStream(management::CodeManager* currentManager) : manager(currentManager)  {}
+TokenStream::TokenStream(management::CodeManager* currentManager , std::pmr::memory_resource* resource) : manager(currentManager) , streamTokens(resource) {}
 //---------------------------------------------------------------------------
 bool TokenStream::compileCode() {
     for(size_t line_index = 0 ; line_index < manager->countLines() ; line_index++) {
@@ -98,7 +72,7 @@ bool TokenStream::compileCode() {
         for(size_t begin_index = 0 , line_size = currentLine.size() ; begin_index < line_size ; ++begin_index) {
             size_t end_index = begin_index ;
             /// move end_index until it reaches whitespace
-            while (end_index < line_size && !isWhiteSpace(currentLine[end_index]))
+            while (end_index < line_size && !Grammar::isWhiteSpace(currentLine[end_index]))
                 ++end_index ;
 
             while (begin_index != end_index) {
@@ -113,7 +87,7 @@ bool TokenStream::compileCode() {
                     string_view currentToken = currentLine.substr(begin_index , current_index - begin_index) ;
                     assert(!currentToken.empty());
                     // check for type of valid token
-                    if(isKeyword(currentToken))
+                    if(Grammar::isKeyword(currentToken))
                         streamTokens.emplace_back(codeReference , TokenType::KEYWORD) ;
                     else if(isIdentifier(currentToken))
                         streamTokens.emplace_back(codeReference , TokenType::IDENTIFIER) ;
@@ -180,6 +154,10 @@ bool TokenStream::isEmpty() const {
     return iterator_token == streamTokens.size() ;
 }
 //---------------------------------------------------------------------------
+size_t TokenStream::size() const {
+    return streamTokens.size() ;
+}
+//---------------------------------------------------------------------------
 TokenStream::Token::Token(management::CodeReference reference, TokenStream::TokenType tokenType)
     : codeReference(std::move(reference)) , type(tokenType){}
 //---------------------------------------------------------------------------
@@ -40,8 +40,8 @@ public:
         TokenType getTokenType() const ;
     };
     //---------------------------------------------------------------------------
-    /// Constructor for TokenStream (without code compilation)
-    explicit TokenStream(management::CodeManager* currentManager) ;
+    /// Constructor for TokenStream (without code compilation) , tokens are allocated from resource
+    explicit TokenStream(management::CodeManager* currentManager , std::pmr::memory_resource* resource = std::pmr::get_default_resource()) ;
     //---------------------------------------------------------------------------
     /// Compile code after construction and check if compilation process succeed
     bool compileCode()  ;
@@ -49,6 +49,9 @@ public:
     /// After compilation , check if token stream is empty
     bool isEmpty() const ;
     //---------------------------------------------------------------------------
+    /// After compilation , return number of tokens (including consumed tokens)
+    size_t size() const ;
+    //---------------------------------------------------------------------------
     /// After compilation , check for a token on front stream
     Token lookup() const ;
     //---------------------------------------------------------------------------
@@ -59,7 +62,7 @@ private:
     /// CodeManager for source code
     management::CodeManager *manager ;
     /// Stream of tokens after calling member function -> compileCode()
-    std::vector<Token> streamTokens ;
+    std::pmr::vector<Token> streamTokens ;
     /// iterator for member function -> nextToken()
     size_t iterator_token = 0 ;
 };
@@ -0,0 +1,122 @@
+#include "pljit/tools/LoadDriver.hpp"
+#include "pljit/Pljit.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <latch>
+#include <sstream>
+#include <thread>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::tools{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    // names of compile phases in reports
+    constexpr array<string_view , management::CompileStatistics::NUM_PHASES> phaseNames = {
+        "lexing" , "parsing" , "semantic analysis" , "optimization" , "closure compilation" , "lowering" , "code generation"
+    } ;
+    //---------------------------------------------------------------------------
+    vector<double> zipf_distribution(size_t functions , double skew)
+    /// cumulative probability of calling functions 0 to i , function i has weight 1 / (i + 1)^skew
+    {
+        vector<double> cumulative(functions) ;
+        double total = 0 ;
+        for(size_t index = 0 ; index < functions ; ++index) {
+            total += 1 / pow(static_cast<double>(index + 1) , skew) ;
+            cumulative[index] = total ;
+        }
+        for(double& probability : cumulative)
+            probability /= total ;
+        return cumulative ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+double LoadReport::throughput() const {
+    return seconds > 0 ? static_cast<double>(calls) / seconds : 0 ;
+}
+//---------------------------------------------------------------------------
+std::string LoadReport::format() const {
+    ostringstream output ;
+    output << "calls          " << calls << " (" << errors << " runtime errors)\n" ;
+    output << "seconds        " << seconds << '\n' ;
+    output << "throughput     " << static_cast<uint64_t>(throughput()) << " calls/s\n" ;
+    output << "latency ns     p50 " << latency.p50 << " , p90 " << latency.p90 << " , p99 " << latency.p99 << " , max " << latency.max << '\n' ;
+    uint64_t compileTotal = 0 ;
+    for(uint64_t nanoseconds : compileNanoseconds)
+        compileTotal += nanoseconds ;
+    output << "compilations   " << compilations << " , " << compileTotal << " ns\n" ;
+    for(size_t phase = 0 ; phase < management::CompileStatistics::NUM_PHASES ; ++phase)
+        output << "  " << phaseNames[phase] << ' ' << compileNanoseconds[phase] << " ns\n" ;
+    return output.str() ;
+}
+//---------------------------------------------------------------------------
+LoadReport LoadDriver::run(const LoadOptions& options) {
+    // source code must outlive pljit
+    vector<string> programs ;
+    ProgramGenerator generator(options.shape , options.seed) ;
+    for(size_t index = 0 ; index < options.functions ; ++index)
+        programs.push_back(generator.generate()) ;
+    Pljit pljit(options.profileCalls) ;
+    vector<Pljit::FunctionHandle> functions ;
+    for(const string& program : programs)
+        functions.push_back(pljit.registerFunction(program)) ;
+    vector<double> cumulative = zipf_distribution(options.functions , options.skew) ;
+
+    // latencies and errors of each thread , merged after all threads are done
+    vector<vector<uint64_t>> latencies(options.threads) ;
+    vector<uint64_t> errors(options.threads) ;
+    latch start(static_cast<ptrdiff_t>(options.threads) + 1) ;
+    vector<thread> threads ;
+    for(size_t id = 0 ; id < options.threads && !functions.empty() ; ++id)
+        threads.emplace_back([&options , &functions , &cumulative , &latencies , &errors , &start , id] {
+            mt19937_64 random(options.seed + id + 1) ;
+            uniform_real_distribution<double> functionChoice(0 , 1) ;
+            uniform_int_distribution<int64_t> argument(-options.argumentRange , options.argumentRange) ;
+            vector<int64_t> arguments(options.shape.parameters) ;
+            latencies[id].reserve(options.callsPerThread) ;
+            start.arrive_and_wait() ;
+            for(uint64_t call = 0 ; call < options.callsPerThread ; ++call) {
+                size_t function = static_cast<size_t>(upper_bound(cumulative.begin() , cumulative.end() , functionChoice(random)) - cumulative.begin()) ;
+                function = min(function , functions.size() - 1) ;
+                for(int64_t& value : arguments)
+                    value = argument(random) ;
+                chrono::steady_clock::time_point begin = chrono::steady_clock::now() ;
+                bool isError = !functions[function](arguments).first.has_value() ;
+                chrono::steady_clock::time_point end = chrono::steady_clock::now() ;
+                latencies[id].push_back(static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(end - begin).count())) ;
+                errors[id] += isError ;
+            }
+        }) ;
+    if(threads.size() < options.threads)
+        start.count_down(static_cast<ptrdiff_t>(options.threads - threads.size())) ;
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now() ;
+    start.arrive_and_wait() ;
+    for(auto &t : threads)
+        t.join() ;
+    chrono::steady_clock::time_point end = chrono::steady_clock::now() ;
+
+    LoadReport report ;
+    report.seconds = chrono::duration<double>(end - begin).count() ;
+    vector<uint64_t> allLatencies ;
+    for(size_t id = 0 ; id < options.threads ; ++id) {
+        allLatencies.insert(allLatencies.end() , latencies[id].begin() , latencies[id].end()) ;
+        report.errors += errors[id] ;
+    }
+    report.calls = allLatencies.size() ;
+    report.latency = management::CompileStatistics::distribution(std::move(allLatencies)) ;
+    for(const management::CompileStatistics::Compilation& compilation : pljit.getCompileStatistics().getCompilations()) {
+        ++report.compilations ;
+        for(size_t phase = 0 ; phase < management::CompileStatistics::NUM_PHASES ; ++phase)
+            if(compilation.phases[phase].has_value())
+                report.compileNanoseconds[phase] += compilation.phases[phase]->nanoseconds ;
+    }
+    return report ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::tools
+//---------------------------------------------------------------------------
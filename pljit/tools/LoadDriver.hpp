@@ -0,0 +1,61 @@
+#ifndef PLJIT_LOADDRIVER_HPP
+#define PLJIT_LOADDRIVER_HPP
+//---------------------------------------------------------------------------
+#include "pljit/management/CompileStatistics.hpp"
+#include "pljit/management/ValueProfile.hpp"
+#include "pljit/tools/ProgramGenerator.hpp"
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::tools{
+//---------------------------------------------------------------------------
+/// configuration of a load run , runs with the same options call the same functions with the same arguments
+struct LoadOptions {
+    ProgramShape shape ;
+    // number of generated functions registered in pljit
+    size_t functions = 64 ;
+    size_t threads = 4 ;
+    uint64_t callsPerThread = 100000 ;
+    // exponent of the Zipf distribution of calls over functions , 0 calls all functions equally often
+    double skew = 1.0 ;
+    // arguments are drawn uniformly from [-argumentRange , argumentRange]
+    int64_t argumentRange = 100 ;
+    uint64_t seed = 42 ;
+    // calls profiled before guarded versions are compiled (0 disables them)
+    uint64_t profileCalls = management::ValueProfile::DEFAULT_PROFILE_CALLS ;
+};
+//---------------------------------------------------------------------------
+/// result of a load run
+struct LoadReport {
+    uint64_t calls = 0 ;
+    // calls which failed with a runtime error
+    uint64_t errors = 0 ;
+    // wall time of all threads , including lazy compilation on first calls
+    double seconds = 0 ;
+    // nearest-rank percentiles of latency of calls in nanoseconds
+    management::CompileStatistics::Distribution latency ;
+    // compilations of generic and guarded versions
+    size_t compilations = 0 ;
+    // total nanoseconds of each compile phase over all compilations
+    std::array<uint64_t , management::CompileStatistics::NUM_PHASES> compileNanoseconds {} ;
+
+    /// calls per second
+    double throughput() const ;
+    /// text report for humans
+    std::string format() const ;
+};
+//---------------------------------------------------------------------------
+/// register generated functions in a Pljit and call them from several threads
+class LoadDriver {
+    public:
+    /// run load , functions are generated from options.seed and each thread draws functions and arguments from
+    /// its own generator seeded by options.seed and its index
+    static LoadReport run(const LoadOptions& options) ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::tools
+//---------------------------------------------------------------------------
+#endif //PLJIT_LOADDRIVER_HPP
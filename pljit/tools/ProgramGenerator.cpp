@@ -0,0 +1,119 @@
+#include "pljit/tools/ProgramGenerator.hpp"
+//---------------------------------------------------------------------------
+#include <algorithm>
+//---------------------------------------------------------------------------
+using namespace std ;
+//---------------------------------------------------------------------------
+namespace jitcompiler ::tools{
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    string identifier(char prefix , size_t index)
+    /// identifiers consist of letters only , index is written in base 26
+    {
+        string name(1 , prefix) ;
+        do {
+            name += static_cast<char>('a' + index % 26) ;
+            index /= 26 ;
+        } while(index != 0) ;
+        return name ;
+    }
+    //---------------------------------------------------------------------------
+    template <typename Suffix>
+    void append_list(string& program , string_view keyword , char prefix , size_t count , Suffix suffix)
+    /// append declaration "keyword a , b ... ;" of count identifiers , suffix appends text after each identifier
+    {
+        if(count == 0)
+            return ;
+        program += keyword ;
+        for(size_t index = 0 ; index < count ; ++index) {
+            program += index == 0 ? " " : " , " ;
+            program += identifier(prefix , index) ;
+            suffix(program) ;
+        }
+        program += ";\n" ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+ProgramGenerator::ProgramGenerator(const ProgramShape& shape , uint64_t seed) : shape(shape) , random(seed) {
+    this->shape.statements = max(this->shape.statements , this->shape.variables) ;
+    // nothing can be assigned without parameters and variables
+    if(this->shape.parameters + this->shape.variables == 0)
+        this->shape.statements = 0 ;
+}
+//---------------------------------------------------------------------------
+void ProgramGenerator::generateOperand(std::string& program) {
+    // literals are always available , so a function without identifiers is valid as well
+    size_t identifiers = shape.parameters + initializedVariables + shape.constants ;
+    size_t choice = uniform_int_distribution<size_t>(0 , identifiers)(random) ;
+    if(choice == identifiers)
+        program += to_string(uniform_int_distribution<uint32_t>(0 , 99)(random)) ;
+    else if(choice < shape.parameters)
+        program += identifier('p' , choice) ;
+    else if(choice < shape.parameters + initializedVariables)
+        program += identifier('v' , choice - shape.parameters) ;
+    else
+        program += identifier('c' , choice - shape.parameters - initializedVariables) ;
+}
+//---------------------------------------------------------------------------
+void ProgramGenerator::generateExpression(std::string& program , size_t depth) {
+    if(depth == 0) {
+        if(bernoulli_distribution(0.1)(random))
+            program += '-' ;
+        generateOperand(program) ;
+        return ;
+    }
+    // operands which are binary expressions are parenthesized
+    auto subexpression = [this , &program , depth] {
+        size_t subDepth = bernoulli_distribution(0.25)(random) ? 0 : depth - 1 ;
+        if(subDepth == 0) {
+            generateExpression(program , 0) ;
+        }
+        else {
+            program += '(' ;
+            generateExpression(program , subDepth) ;
+            program += ')' ;
+        }
+    } ;
+    subexpression() ;
+    bool noWeights = ranges::all_of(shape.operatorWeights , [](uint32_t weight) { return weight == 0 ; }) ;
+    if(noWeights || bernoulli_distribution(shape.divisionDensity)(random))
+        program += " / " ;
+    else {
+        constexpr array<string_view , 3> operators = {" + " , " - " , " * "} ;
+        discrete_distribution<size_t> distribution(shape.operatorWeights.begin() , shape.operatorWeights.end()) ;
+        program += operators[distribution(random)] ;
+    }
+    subexpression() ;
+}
+//---------------------------------------------------------------------------
+std::string ProgramGenerator::generate() {
+    string program ;
+    append_list(program , "PARAM" , 'p' , shape.parameters , [](string&) {}) ;
+    append_list(program , "VAR" , 'v' , shape.variables , [](string&) {}) ;
+    append_list(program , "CONST" , 'c' , shape.constants , [this](string& text) {
+        text += " = " + to_string(uniform_int_distribution<uint32_t>(1 , 99)(random)) ;
+    }) ;
+    program += "BEGIN\n" ;
+    initializedVariables = 0 ;
+    for(size_t statement = 0 ; statement < shape.statements ; ++statement) {
+        // variables are initialized in order , then parameters and variables are assigned at random
+        size_t target = initializedVariables < shape.variables ? shape.parameters + initializedVariables :
+                        uniform_int_distribution<size_t>(0 , shape.parameters + shape.variables - 1)(random) ;
+        program += target < shape.parameters ? identifier('p' , target) : identifier('v' , target - shape.parameters) ;
+        program += " := " ;
+        generateExpression(program , shape.expressionDepth) ;
+        program += ";\n" ;
+        if(target == shape.parameters + initializedVariables)
+            ++initializedVariables ;
+    }
+    program += "RETURN " ;
+    generateExpression(program , shape.expressionDepth) ;
+    program += "\nEND.\n" ;
+    return program ;
+}
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::tools
+//---------------------------------------------------------------------------
@@ -0,0 +1,50 @@
+#ifndef PLJIT_PROGRAMGENERATOR_HPP
+#define PLJIT_PROGRAMGENERATOR_HPP
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+//---------------------------------------------------------------------------
+namespace jitcompiler ::tools{
+//---------------------------------------------------------------------------
+/// shape of generated PL programs
+struct ProgramShape {
+    size_t parameters = 3 ;
+    size_t variables = 2 ;
+    size_t constants = 2 ;
+    // assignment statements before the return statement , the first ones initialize the variables in order
+    size_t statements = 4 ;
+    // depth of binary operators of each expression , subexpressions end early with probability 1/4
+    size_t expressionDepth = 3 ;
+    // relative weights of "+" , "-" and "*" (all operators are "/" if every weight is 0)
+    std::array<uint32_t , 3> operatorWeights {1 , 1 , 1} ;
+    // probability that a binary operator is "/" , divisors are arbitrary expressions and may be zero
+    double divisionDensity = 0.1 ;
+};
+//---------------------------------------------------------------------------
+/// generate valid PL programs of a shape , the same seed generates the same programs
+class ProgramGenerator {
+    ProgramShape shape ;
+    std::mt19937_64 random ;
+    // number of variables which are assigned before the current statement
+    size_t initializedVariables = 0 ;
+
+    /// append expression of depth at most depth to program
+    void generateExpression(std::string& program , size_t depth) ;
+    /// append identifier or literal to program
+    void generateOperand(std::string& program) ;
+
+    public:
+    /// statements are raised to the number of variables , so that each variable is initialized (and lowered to 0
+    /// if there are neither parameters nor variables)
+    ProgramGenerator(const ProgramShape& shape , uint64_t seed) ;
+
+    /// next program , it compiles without errors (runtime errors are possible)
+    std::string generate() ;
+};
+//---------------------------------------------------------------------------
+} // namespace jitcompiler::tools
+//---------------------------------------------------------------------------
+#endif //PLJIT_PROGRAMGENERATOR_HPP
@@ -0,0 +1,96 @@
+#include "pljit/tools/LoadDriver.hpp"
+#include <charconv>
+#include <iostream>
+#include <string_view>
+//---------------------------------------------------------------------------
+using namespace std;
+using namespace jitcompiler ;
+using namespace jitcompiler::tools ;
+//---------------------------------------------------------------------------
+//helper functions
+namespace {
+//---------------------------------------------------------------------------
+    constexpr string_view usage =
+        "usage: pljit_load [option value] ... [--print]\n"
+        "  --functions N      generated functions (64)\n"
+        "  --threads T        calling threads (4)\n"
+        "  --calls C          calls per thread (100000)\n"
+        "  --skew S           Zipf exponent of calls over functions , 0 is uniform (1.0)\n"
+        "  --range R          arguments are drawn from [-R , R] (100)\n"
+        "  --seed X           seed of programs and calls (42)\n"
+        "  --profile-calls P  calls profiled before tier-up , 0 disables it (1000)\n"
+        "  --params N , --vars N , --consts N , --statements N , --depth N\n"
+        "                     shape of programs (3 , 2 , 2 , 4 , 3)\n"
+        "  --add W , --sub W , --mul W\n"
+        "                     relative weights of operators (1 , 1 , 1)\n"
+        "  --divisions D      probability that an operator is a division (0.1)\n"
+        "  --print            print one generated program and exit\n" ;
+    //---------------------------------------------------------------------------
+    template <typename T>
+    bool parse(string_view text , T& value)
+    /// parse whole text as number
+    {
+        auto [end , error] = from_chars(text.data() , text.data() + text.size() , value) ;
+        return error == errc() && end == text.data() + text.size() ;
+    }
+//---------------------------------------------------------------------------
+} // anonymous namespace
+//---------------------------------------------------------------------------
+int main(int argc , char** argv) {
+    LoadOptions options ;
+    bool print = false ;
+    for(int index = 1 ; index < argc ; ++index) {
+        string_view option = argv[index] ;
+        if(option == "--print") {
+            print = true ;
+            continue ;
+        }
+        if(index + 1 == argc) {
+            cerr << usage ;
+            return 2 ;
+        }
+        string_view value = argv[++index] ;
+        bool isValid ;
+        if(option == "--functions")
+            isValid = parse(value , options.functions) ;
+        else if(option == "--threads")
+            isValid = parse(value , options.threads) ;
+        else if(option == "--calls")
+            isValid = parse(value , options.callsPerThread) ;
+        else if(option == "--skew")
+            isValid = parse(value , options.skew) && options.skew >= 0 ;
+        else if(option == "--range")
+            isValid = parse(value , options.argumentRange) && options.argumentRange >= 0 ;
+        else if(option == "--seed")
+            isValid = parse(value , options.seed) ;
+        else if(option == "--profile-calls")
+            isValid = parse(value , options.profileCalls) ;
+        else if(option == "--params")
+            isValid = parse(value , options.shape.parameters) ;
+        else if(option == "--vars")
+            isValid = parse(value , options.shape.variables) ;
+        else if(option == "--consts")
+            isValid = parse(value , options.shape.constants) ;
+        else if(option == "--statements")
+            isValid = parse(value , options.shape.statements) ;
+        else if(option == "--depth")
+            isValid = parse(value , options.shape.expressionDepth) ;
+        else if(option == "--add" || option == "--sub" || option == "--mul")
+            isValid = parse(value , options.shape.operatorWeights[option == "--add" ? 0 : option == "--sub" ? 1 : 2]) ;
+        else if(option == "--divisions")
+            isValid = parse(value , options.shape.divisionDensity) && options.shape.divisionDensity >= 0 && options.shape.divisionDensity <= 1 ;
+        else
+            isValid = false ;
+        if(!isValid) {
+            cerr << "invalid option " << option << ' ' << value << '\n' << usage ;
+            return 2 ;
+        }
+    }
+    if(print) {
+        cout << ProgramGenerator(options.shape , options.seed).generate() ;
+        return 0 ;
+    }
+    cout << LoadDriver::run(options).format() ;
+    return 0 ;
+}
+//---------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 #include <thread>
 #include <mutex>
 #include "pljit/Pljit.hpp"
+#include "pljit/management/Tracer.hpp"
 
 using namespace std ;
 using namespace jitcompiler ;
@@ -182,6 +183,31 @@ TEST(TestPljit , TestThreadSafe){
         ASSERT_EQ(mpThread[res] , cnt) ;
     }
 }
+TEST(TestPljit , TestConcurrentTierUp) {
+    // profile completes while other threads compile , lower or evaluate the function
+    vector<string> codes ;
+    for(int64_t factor = 1 ; factor <= 4 ; ++factor)
+        codes.push_back("PARAM a , b;\nBEGIN\nRETURN a * " + to_string(factor) + " / b\nEND.\n") ;
+    for(uint64_t profileCalls : {1 , 2 , 5}) {
+        Pljit pljit(profileCalls) ;
+        vector<Pljit::FunctionHandle> functions ;
+        for(const string& code : codes)
+            functions.push_back(pljit.registerFunction(code)) ;
+        vector<thread> threads ;
+        for(int64_t id = 0 ; id < 8 ; ++id)
+            threads.emplace_back([&functions , id] {
+                for(int64_t call = 0 ; call < 20 ; ++call) {
+                    for(size_t index = 0 ; index < functions.size() ; ++index) {
+                        int64_t b = (call + id) % 4 + 1 ;
+                        // operators are right associative
+                        ASSERT_EQ(functions[index]({id , b}).first.value() , id * (static_cast<int64_t>(index + 1) / b)) ;
+                    }
+                }
+            }) ;
+        for(auto &t : threads)
+            t.join() ;
+    }
+}
 TEST(TestPljit , TestHeavyMultipleCases) {
     constexpr string_view code = "PARAM yb;\n"
                                  "VAR x , y , d;\n"
@@ -235,4 +261,362 @@ TEST(TestPljit , TestHeavyMultipleCases) {
         ASSERT_TRUE(mpThread.find(res) != mpThread.end()) ;
         ASSERT_EQ(mpThread[res] , cnt) ;
     }
-}
\ No newline at end of file
+}
+TEST(TestPljit , TestSpecialize) {
+    Pljit pljit ;
+    constexpr string_view code = "PARAM width , height , density;\n"
+                                 "VAR volume;\n"
+                                 "BEGIN\n"
+                                 "volume := width * height;\n"
+                                 "density := density / 2;\n"
+                                 "RETURN volume * density / height\n"
+                                 "END.\n" ;
+    auto func = pljit.registerFunction(code) ;
+    auto specialized = pljit.specialize(func , {{2 , 2400}}) ;
+    auto specializedTwice = pljit.specialize(specialized , {{1 , 0}}) ;
+    for(int64_t width = -4 ; width <= 4 ; width++)
+        for(int64_t height = -4 ; height <= 4 ; height++) {
+            auto expected = func({width , height , 2400}) ;
+            // value of bound parameter is ignored
+            ASSERT_EQ(specialized({width , height , 0}) , expected) ;
+        }
+    // second specialization keeps parameter 2 bound
+    auto result = specializedTwice({3 , 5 , 7}) ;
+    ASSERT_FALSE(result.first.has_value()) ;
+    ASSERT_EQ(result.second , "6:25: Runtime Error: Divide by Zero\n"
+                              "RETURN volume * density / height\n"
+                              "                        ^\n") ;
+}
+TEST(TestPljit , TestSpecializeCompileError) {
+    Pljit pljit ;
+    constexpr string_view code = "PARAM a;\n"
+                                 "BEGIN\n"
+                                 "RETURN b\n"
+                                 "END.\n" ;
+    auto func = pljit.registerFunction(code) ;
+    auto specialized = pljit.specialize(func , {{0 , 1}}) ;
+    auto result = specialized({0}) ;
+    ASSERT_FALSE(result.first.has_value()) ;
+    ASSERT_EQ(result.second , func({0}).second) ;
+}
+TEST(TestPljit , TestGuardedSpecialization) {
+    Pljit pljit(10) ;
+    constexpr string_view code = "PARAM width , density;\n"
+                                 "VAR mass;\n"
+                                 "BEGIN\n"
+                                 "mass := width * (density - 2400);\n"
+                                 "RETURN width / mass\n"
+                                 "END.\n" ;
+    constexpr string_view expectedRuntimeError = "5:14: Runtime Error: Divide by Zero\n"
+                                                 "RETURN width / mass\n"
+                                                 "             ^\n" ;
+    auto func = pljit.registerFunction(code) ;
+    // density is always 2401 while profiling
+    for(int64_t width = 1 ; width <= 10 ; width++) {
+        auto result = func({width , 2401}) ;
+        ASSERT_EQ(result.first.value() , 1) ;
+    }
+    for(int64_t width = -20 ; width <= 20 ; width++)
+        for(int64_t density : {2399 , 2400 , 2401 , 2402}) {
+            auto result = func({width , density}) ;
+            if(width == 0 || density == 2400) {
+                ASSERT_FALSE(result.first.has_value()) ;
+                ASSERT_EQ(result.second , expectedRuntimeError) ;
+            }
+            else {
+                ASSERT_TRUE(result.second.empty()) ;
+                ASSERT_EQ(result.first.value() , width / (width * (density - 2400))) ;
+            }
+        }
+}
+TEST(TestPljit , TestHotCodePlacement) {
+    if(!backend::PatchedFunction::isSupported())
+        GTEST_SKIP() << "copy-and-patch is not supported on this platform" ;
+    Pljit pljit(10) ;
+    auto func = pljit.registerFunction("PARAM a , b;\nBEGIN\nRETURN a * a - b\nEND.\n") ;
+    // first call is evaluated by closures
+    ASSERT_EQ(func({3 , 1}).first.value() , 8) ;
+    ASSERT_EQ(pljit.getCodeHeapStatistics().mappedBytes , 0) ;
+    // code of second call is cold
+    ASSERT_EQ(func({2 , 1}).first.value() , 3) ;
+    backend::CodeHeap::Statistics statistics = pljit.getCodeHeapStatistics() ;
+    ASSERT_EQ(statistics.mappedBytes , backend::CodeHeap::CHUNK_SIZE) ;
+    ASSERT_GT(statistics.allocatedBytes , 0) ;
+    ASSERT_EQ(statistics.freeBytes , 0) ;
+    for(int64_t a = 0 ; a < 10 ; a++)
+        ASSERT_EQ(func({a , a}).first.value() , a * a - a) ;
+    // generic and guarded code are moved to hot chunk , block of cold code is free
+    statistics = pljit.getCodeHeapStatistics() ;
+    ASSERT_EQ(statistics.mappedBytes , 2 * backend::CodeHeap::CHUNK_SIZE) ;
+    ASSERT_GT(statistics.freeBytes , 0) ;
+    ASSERT_EQ(func({-4 , 2}).first.value() , 14) ;
+
+    // profile of first call completes before function is lowered , so it is lowered into the hot arena
+    Pljit eager(1) ;
+    auto eagerFunc = eager.registerFunction("PARAM a , b;\nBEGIN\nRETURN a * a - b\nEND.\n") ;
+    ASSERT_EQ(eagerFunc({3 , 1}).first.value() , 8) ;
+    ASSERT_EQ(eagerFunc({2 , 1}).first.value() , 3) ;
+    // all code is within the hot chunk , no cold chunk is mapped
+    statistics = eager.getCodeHeapStatistics() ;
+    ASSERT_EQ(statistics.mappedBytes , backend::CodeHeap::CHUNK_SIZE) ;
+    ASSERT_GT(statistics.hotBytes , 0) ;
+    ASSERT_EQ(statistics.hotBytes , statistics.allocatedBytes) ;
+    ASSERT_EQ(statistics.freeBytes , 0) ;
+}
+TEST(TestPljit , TestCompileStatistics) {
+    Pljit pljit ;
+    auto func = pljit.registerFunction("PARAM a;\nCONST c = 4;\nBEGIN\nRETURN a * c\nEND.\n") ;
+    auto broken = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN b\nEND.\n") ;
+    ASSERT_TRUE(pljit.getCompileStatistics().getCompilations().empty()) ;
+    ASSERT_EQ(func({2}).first.value() , 8) ;
+    ASSERT_FALSE(broken({2}).first.has_value()) ;
+    // each function is compiled once
+    ASSERT_EQ(func({3}).first.value() , 12) ;
+
+    using management::CompileStatistics ;
+    vector<CompileStatistics::Compilation> compilations = pljit.getCompileStatistics().getCompilations() ;
+    ASSERT_EQ(compilations.size() , 3) ;
+    ASSERT_EQ(compilations[0].function , 0) ;
+    ASSERT_FALSE(compilations[0].guarded) ;
+    // first call is compiled to closures
+    for(size_t phase = 0 ; phase < CompileStatistics::NUM_PHASES ; ++phase)
+        ASSERT_EQ(compilations[0].phases[phase].has_value() , phase <= CompileStatistics::CLOSURE_COMPILATION) << phase ;
+    // tokens : PARAM a ; CONST c = 4 ; BEGIN RETURN a * c END .
+    ASSERT_EQ(compilations[0].phases[CompileStatistics::LEXING]->outputSize , 15) ;
+    // allocations are counted through the memory account of the function
+    ASSERT_GT(compilations[0].phases[CompileStatistics::PARSING]->allocations , 0) ;
+    // semantic analysis fails on undeclared identifier
+    ASSERT_EQ(compilations[1].function , 1) ;
+    ASSERT_TRUE(compilations[1].phases[CompileStatistics::SEMANTIC_ANALYSIS].has_value()) ;
+    ASSERT_FALSE(compilations[1].phases[CompileStatistics::OPTIMIZATION].has_value()) ;
+    // second call lowers function
+    ASSERT_EQ(compilations[2].function , 0) ;
+    for(size_t phase = 0 ; phase < CompileStatistics::NUM_PHASES ; ++phase)
+        ASSERT_EQ(compilations[2].phases[phase].has_value() , phase >= CompileStatistics::LOWERING) << phase ;
+    ASSERT_GT(compilations[2].phases[CompileStatistics::LOWERING]->allocations , 0) ;
+
+    CompileStatistics::PhaseSummary lexing = pljit.getCompileStatistics().summarize(CompileStatistics::LEXING) ;
+    ASSERT_EQ(lexing.samples , 2) ;
+    ASSERT_EQ(lexing.outputSize.max , 15) ;
+    ASSERT_EQ(pljit.getCompileStatistics().summarize(CompileStatistics::LOWERING).samples , 1) ;
+}
+TEST(TestPljit , TestTelemetry) {
+    Pljit pljit ;
+    auto func = pljit.registerFunction("PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n") ;
+    auto other = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN a\nEND.\n") ;
+    ASSERT_FALSE(pljit.getTelemetry(func).has_value()) ;
+    // calls before telemetry is enabled are not recorded
+    ASSERT_EQ(func({4 , 2}).first.value() , 2) ;
+    pljit.enableTelemetry(func) ;
+    pljit.enableMemoization(func , 8) ;
+    vector<thread> threads ;
+    for(int64_t id = 0 ; id < 4 ; ++id)
+        threads.emplace_back([&func] {
+            for(int64_t b = -5 ; b <= 5 ; ++b)
+                func({10 , b}) ;
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    ASSERT_EQ(other({1}).first.value() , 1) ;
+
+    optional<management::CallTelemetry::Snapshot> snapshot = pljit.getTelemetry(func) ;
+    ASSERT_TRUE(snapshot.has_value()) ;
+    // memoized results are counted as calls , cached runtime errors as errors
+    ASSERT_EQ(snapshot->calls , 44) ;
+    ASSERT_EQ(snapshot->errors , 4) ;
+    ASSERT_FALSE(pljit.getTelemetry(other).has_value()) ;
+    string text = pljit.dumpTelemetry() ;
+    ASSERT_NE(text.find("pljit_calls_total{function=\"pljit_function_0\"} 44\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_errors_total{function=\"pljit_function_0\"} 4\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_count{function=\"pljit_function_0\"} 44\n") , string::npos) << text ;
+    ASSERT_EQ(text.find("pljit_function_1") , string::npos) << text ;
+}
+TEST(TestPljit , TestMemoryUsage) {
+    string error ;
+    {
+        Pljit pljit ;
+        auto small = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN a\nEND.\n") ;
+        auto large = pljit.registerFunction("PARAM a , b;\nVAR c , d;\nCONST e = 7;\nBEGIN\nc := a * e + b;\nd := (c - a) / b;\nRETURN c + d * 3\nEND.\n") ;
+        auto broken = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN b\nEND.\n") ;
+        using Stage = Pljit::MemoryUsage::Stage ;
+        Pljit::MemoryUsage initial = pljit.getMemoryUsage(large) ;
+        ASSERT_GT(initial.bytes[Stage::SOURCE_LINES] , 0) ;
+        ASSERT_EQ(initial.bytes[Stage::COMPILED_CODE] , 0) ;
+
+        ASSERT_EQ(small({1}).first.value() , 1) ;
+        ASSERT_EQ(large({1 , 2}).first.value() , 21) ;
+        // first call is evaluated by closures , compiled code is built by the second call
+        ASSERT_EQ(pljit.getMemoryUsage(large).bytes[Stage::COMPILED_CODE] , 0) ;
+        ASSERT_EQ(small({1}).first.value() , 1) ;
+        ASSERT_EQ(large({1 , 2}).first.value() , 21) ;
+        Pljit::MemoryUsage smallUsage = pljit.getMemoryUsage(small) ;
+        Pljit::MemoryUsage largeUsage = pljit.getMemoryUsage(large) ;
+        for(Stage stage : {Stage::TOKENS , Stage::PARSE_TREE , Stage::AST , Stage::COMPILED_CODE}) {
+            ASSERT_GT(largeUsage.bytes[stage] , initial.bytes[stage]) << static_cast<int>(stage) ;
+            ASSERT_GT(largeUsage.bytes[stage] , smallUsage.bytes[stage]) << static_cast<int>(stage) ;
+        }
+        ASSERT_EQ(largeUsage.bytes[Stage::SOURCE_LINES] , initial.bytes[Stage::SOURCE_LINES]) ;
+        ASSERT_GT(largeUsage.total() , smallUsage.total()) ;
+        if(backend::PatchedFunction::isSupported()) {
+            ASSERT_GE(largeUsage.bytes[Stage::COMPILED_CODE] , backend::CodeHeap::MIN_BLOCK_SIZE) ;
+        }
+
+        // compile error stops the pipeline
+        error = broken({1}).second ;
+        ASSERT_FALSE(error.empty()) ;
+        ASSERT_EQ(pljit.getMemoryUsage(broken).bytes[Stage::COMPILED_CODE] , 0) ;
+    }
+    // returned error message outlives pljit
+    ASSERT_NE(error.find("Undeclared Identifier") , string::npos) << error ;
+}
+TEST(TestPljit , TestTracing) {
+    management::Tracer::flush() ;
+    management::Tracer::enable(true) ;
+    {
+        Pljit pljit(2) ;
+        auto func = pljit.registerFunction("PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n") ;
+        vector<thread> threads ;
+        for(int64_t id = 0 ; id < 4 ; ++id)
+            threads.emplace_back([&func] {
+                for(int64_t b = 1 ; b <= 10 ; ++b)
+                    ASSERT_EQ(func({10 , b}).first.value() , 10 / b) ;
+            }) ;
+        for(auto &t : threads)
+            t.join() ;
+    }
+    management::Tracer::enable(false) ;
+    string json = management::Tracer::flush() ;
+    for(string_view name : {"lexing" , "parsing" , "semantic analysis" , "optimization" , "closure compilation" , "lowering" , "code generation" , "tier-up" , "evaluate"})
+        ASSERT_NE(json.find("{\"name\":\"" + string(name) + "\"") , string::npos) << name << '\n' << json ;
+    // each function is compiled and tiered up once
+    ASSERT_EQ(json.find("\"name\":\"lexing\"") , json.rfind("\"name\":\"lexing\"")) ;
+    ASSERT_EQ(json.find("\"name\":\"tier-up\"") , json.rfind("\"name\":\"tier-up\"")) ;
+}
+TEST(TestPljit , TestLockContention) {
+    Pljit pljit(0) ;
+    auto first = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN a\nEND.\n") ;
+    auto second = pljit.registerFunction("PARAM a;\nBEGIN\nRETURN a * 2\nEND.\n") ;
+    ASSERT_EQ(first({1}).first.value() , 1) ;
+    pljit.enableLockProfiling(true) ;
+    vector<thread> threads ;
+    for(int64_t id = 0 ; id < 8 ; ++id)
+        threads.emplace_back([&first , &second] {
+            for(int64_t a = 0 ; a < 100 ; ++a) {
+                ASSERT_EQ(first({a}).first.value() , a) ;
+                ASSERT_EQ(second({a}).first.value() , 2 * a) ;
+            }
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    pljit.enableLockProfiling(false) ;
+    ASSERT_EQ(first({1}).first.value() , 1) ;
+
+    // each call takes an exclusive and a shared lock
+    vector<Pljit::LockContention> contention = pljit.getLockContention() ;
+    ASSERT_EQ(contention.size() , 4) ;
+    for(const Pljit::LockContention& entry : contention) {
+        ASSERT_EQ(entry.counters.acquisitions , 800) ;
+        ASSERT_LE(entry.counters.contended , entry.counters.acquisitions) ;
+        ASSERT_GE(entry.counters.waitNanoseconds , entry.counters.maxWaitNanoseconds) ;
+    }
+    for(size_t index = 1 ; index < contention.size() ; ++index)
+        ASSERT_GE(contention[index - 1].counters.waitNanoseconds , contention[index].counters.waitNanoseconds) ;
+    ASSERT_EQ(pljit.getLockContention(1).size() , 1) ;
+}
+TEST(TestPljit , TestMemoization) {
+    Pljit pljit ;
+    constexpr string_view code = "PARAM x , y;\n"
+                                 "BEGIN\n"
+                                 "RETURN x / y\n"
+                                 "END.\n" ;
+    constexpr string_view expectedRuntimeError = "3:10: Runtime Error: Divide by Zero\n"
+                                                 "RETURN x / y\n"
+                                                 "         ^\n" ;
+    auto func = pljit.registerFunction(code) ;
+    pljit.enableMemoization(func , 32) ;
+    vector<thread> threads ;
+    for(int64_t id = 0 ; id < 8 ; ++id)
+        threads.emplace_back([&func , &expectedRuntimeError] {
+            for(int64_t round = 0 ; round < 3 ; ++round)
+                for(int64_t x = -10 ; x <= 10 ; x++)
+                    for(int64_t y = -3 ; y <= 3 ; y++) {
+                        auto result = func({x , y}) ;
+                        if(y == 0) {
+                            // runtime errors are cached as well
+                            ASSERT_FALSE(result.first.has_value()) ;
+                            ASSERT_EQ(result.second , expectedRuntimeError) ;
+                        }
+                        else {
+                            ASSERT_TRUE(result.second.empty()) ;
+                            ASSERT_EQ(result.first.value() , x / y) ;
+                        }
+                    }
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    pljit.enableMemoization(func , 0) ;
+    ASSERT_EQ(func({7 , 2}).first.value() , 3) ;
+}
+TEST(TestPljit , TestCheckedArithmetic) {
+    Pljit pljit ;
+    constexpr string_view code = "PARAM a;\n"
+                                 "CONST c = 9223372036854775807;\n"
+                                 "BEGIN\n"
+                                 "RETURN a * 4 + c\n"
+                                 "END.\n" ;
+    constexpr string_view expectedMultiply = "4:10: Runtime Error: Integer Overflow\n"
+                                             "RETURN a * 4 + c\n"
+                                             "         ^\n" ;
+    constexpr string_view expectedAdd = "4:14: Runtime Error: Integer Overflow\n"
+                                        "RETURN a * 4 + c\n"
+                                        "             ^\n" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    auto wraparound = pljit.registerFunction(code) ;
+    auto checked = pljit.registerFunction(code , ArithmeticMode::CHECKED) ;
+    ASSERT_EQ(wraparound({1}).first , wrapping_add(4 , maximum)) ;
+    ASSERT_EQ(wraparound({maximum / 2}).first , wrapping_add(wrapping_multiply(maximum / 2 , 4) , maximum)) ;
+
+    ASSERT_EQ(checked({-1}) , make_pair(optional<int64_t>(maximum - 4) , string())) ;
+    ASSERT_EQ(checked({maximum / 2}) , make_pair(optional<int64_t>() , string(expectedMultiply))) ;
+    ASSERT_EQ(checked({1}) , make_pair(optional<int64_t>() , string(expectedAdd))) ;
+    ASSERT_EQ(checked({minimum / 4}) , make_pair(optional<int64_t>(-1) , string())) ;
+    // constant overflow is not folded , specialized function keeps checked arithmetic
+    auto specialized = pljit.specialize(checked , {{0 , 1}}) ;
+    ASSERT_EQ(specialized({0}) , make_pair(optional<int64_t>() , string(expectedAdd))) ;
+}
+TEST(TestPljit , TestCompileNative) {
+    Pljit pljit ;
+    constexpr string_view code = "PARAM width , height , depth;\n"
+                                 "VAR volume;\n"
+                                 "CONST density = 2400;\n"
+                                 "BEGIN\n"
+                                 "volume := width * height * depth;\n"
+                                 "RETURN density * volume / depth\n"
+                                 "END.\n" ;
+    constexpr string_view expectedRuntimeError = "6:25: Runtime Error: Divide by Zero\n"
+                                                 "RETURN density * volume / depth\n"
+                                                 "                        ^\n" ;
+    auto func = pljit.registerFunction(code) ;
+    ASSERT_EQ(func({1 , 2 , 3}).first , 4800) ;
+    optional<string> error = pljit.compileNative(func) ;
+    if(error.has_value())
+        GTEST_SKIP() << "C compiler is not available: " << error.value() ;
+    vector<thread> threads ;
+    for(int64_t id = 0 ; id < 4 ; ++id)
+        threads.emplace_back([&func , &expectedRuntimeError] {
+            for(int64_t depth = -5 ; depth <= 5 ; depth++) {
+                auto result = func({3 , 4 , depth}) ;
+                if(depth == 0)
+                    ASSERT_EQ(result , make_pair(optional<int64_t>() , string(expectedRuntimeError))) ;
+                else
+                    ASSERT_EQ(result , make_pair(optional<int64_t>(2400 * 12) , string())) ;
+            }
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+
+    // compile errors are reported instead of native code
+    auto invalid = pljit.registerFunction("BEGIN\nRETURN a\nEND.\n") ;
+    ASSERT_TRUE(pljit.compileNative(invalid).has_value()) ;
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "pljit/Pljit.hpp"
+#include "pljit/StaticPljit.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+
+TEST(TestStaticPljit , TestEvaluation) {
+    constexpr auto volume = compile<"PARAM width, height, depth;\n"
+                                    "VAR volume;\n"
+                                    "CONST density = 2400;\n"
+                                    "BEGIN\n"
+                                    "volume := width * height * depth;\n"
+                                    "RETURN density * volume\n"
+                                    "END.">() ;
+    static_assert(volume.numParameters == 3) ;
+    // evaluated during C++ compilation
+    static_assert(volume(1 , 2 , 3).first == 14400) ;
+    for(int64_t width = -3 ; width <= 3 ; ++width) {
+        auto result = volume(width , 5 , 7) ;
+        ASSERT_TRUE(result.second.empty()) ;
+        ASSERT_EQ(result.first.value() , 2400 * width * 5 * 7) ;
+    }
+
+    // right associative operators , unary operators and statements behind RETURN as in the runtime pipeline
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a - b - -(2 * 3);\n"
+                                 "RETURN c / 2 / b;\n"
+                                 "c := 0;\n"
+                                 "RETURN c\n"
+                                 "END.\n" ;
+    constexpr auto function = compile<"PARAM a , b;\n"
+                                      "VAR c;\n"
+                                      "BEGIN\n"
+                                      "c := a - b - -(2 * 3);\n"
+                                      "RETURN c / 2 / b;\n"
+                                      "c := 0;\n"
+                                      "RETURN c\n"
+                                      "END.\n">() ;
+    Pljit pljit ;
+    auto handle = pljit.registerFunction(code) ;
+    for(int64_t a = -20 ; a <= 20 ; a += 7) {
+        for(int64_t b = -3 ; b <= 3 ; ++b) {
+            auto expected = handle({a , b}) ;
+            auto result = function(a , b) ;
+            ASSERT_EQ(result.first , expected.first) ;
+            ASSERT_EQ(result.second , expected.second) ;
+        }
+    }
+    ASSERT_EQ(function(1 , 2).first , -7) ;
+    ASSERT_EQ(function(1 , 1).first , -3) ;
+    ASSERT_EQ(function(1 , 0).second , "5:14: Runtime Error: Divide by Zero\nRETURN c / 2 / b;\n             ^\n") ;
+}
+TEST(TestStaticPljit , TestCompileErrors) {
+    using namespace jitcompiler::static_compilation ;
+    constexpr auto missingSemicolon = compile_program<"PARAM a\nBEGIN\nRETURN a\nEND.">() ;
+    static_assert(missingSemicolon.error.message.view() == "expected ;") ;
+    static_assert(missingSemicolon.error.reference.line == 1 && missingSemicolon.error.reference.begin == 0) ;
+
+    constexpr auto unexpectedToken = compile_program<"BEGIN\nRETURN 1 $\nEND.">() ;
+    static_assert(unexpectedToken.error.message.view() == "unexpected token \"$\"") ;
+    static_assert(unexpectedToken.error.reference.line == 1 && unexpectedToken.error.reference.begin == 9) ;
+
+    constexpr auto missingTerminator = compile_program<"BEGIN\nRETURN 1\nEND\n">() ;
+    static_assert(missingTerminator.error.message.view() == "expected \".\"") ;
+    static_assert(missingTerminator.error.reference.line == 2 && missingTerminator.error.reference.begin == 3) ;
+
+    constexpr auto undeclared = compile_program<"PARAM a;\nBEGIN\nRETURN a + b\nEND.">() ;
+    static_assert(undeclared.error.message.view() == "Undeclared Identifier") ;
+    static_assert(undeclared.error.reference.line == 2 && undeclared.error.reference.begin == 11) ;
+
+    constexpr auto uninitialized = compile_program<"VAR a;\nBEGIN\nRETURN a\nEND.">() ;
+    static_assert(uninitialized.error.message.view() == "Uninitialized Identifier") ;
+
+    constexpr auto constantAssignment = compile_program<"CONST a = 1;\nBEGIN\na := 2;\nRETURN a\nEND.">() ;
+    static_assert(constantAssignment.error.message.view() == "Constant Assignment") ;
+
+    constexpr auto alreadyDeclared = compile_program<"PARAM a;\nVAR a;\nBEGIN\nRETURN 1\nEND.">() ;
+    static_assert(alreadyDeclared.error.message.view() == "Already declared") ;
+    static_assert(alreadyDeclared.error.reference.line == 1 && alreadyDeclared.error.reference.begin == 4) ;
+
+    constexpr auto missingReturn = compile_program<"PARAM a;\nBEGIN\na := 1\nEND.">() ;
+    static_assert(missingReturn.error.message.view() == "Missing Return Statement") ;
+    static_assert(missingReturn.error.reference.line == 3 && missingReturn.error.reference.begin == 0) ;
+
+    // syntax errors are reported before semantic errors
+    constexpr auto syntaxFirst = compile_program<"BEGIN\nRETURN b\nEND">() ;
+    static_assert(syntaxFirst.error.message.view() == "expected \".\"") ;
+
+    // constant expressions are folded , division by constant zero is kept as runtime error
+    constexpr auto folded = compile_program<"CONST a = 6;\nBEGIN\nRETURN -a * 7 + 1 / 0\nEND.">() ;
+    static_assert(!folded.error.failed()) ;
+    static_assert(folded.size == 9) ;
+    static_assert(folded.instructions[3].opcode == ir::Instruction::Opcode::CONSTANT && folded.instructions[3].constant == -42) ;
+    static_assert(folded.instructions[6].opcode == ir::Instruction::Opcode::DIVIDE) ;
+}
+TEST(TestStaticPljit , TestCompileErrorsMatchRuntime) {
+    using namespace jitcompiler::static_compilation ;
+    constexpr array<string_view , 23> sources = {
+        "PARAM a\nBEGIN\nRETURN a\nEND." ,
+        "PARAM a ,\nBEGIN\nRETURN a\nEND." ,
+        "PARAM" ,
+        "VAR a ; CONST b 1 ;\nBEGIN\nRETURN a\nEND." ,
+        "CONST b = c ;\nBEGIN\nRETURN b\nEND." ,
+        "CONST b =" ,
+        "BEGIN\nRETURN 1 $\nEND." ,
+        "BEGIN\nRETURN a_b\nEND." ,
+        "BEGIN\nRETURN 12ab\nEND." ,
+        "BEGIN\nRETURN 1 : 2\nEND." ,
+        "RETURN 1\nEND." ,
+        "BEGIN\nRETURN (1 + 2\nEND." ,
+        "BEGIN\nRETURN 1 +\nEND." ,
+        "BEGIN\nRETURN (1 + 2" ,
+        "BEGIN\nVAR a\nEND." ,
+        "BEGIN\n" ,
+        "BEGIN\n1 := 2\nEND." ,
+        "PARAM a ;\nBEGIN\na = 1 ;\nRETURN a\nEND." ,
+        "BEGIN\nRETURN 1\nEND\n" ,
+        "BEGIN\nRETURN 1\nEND. END" ,
+        "PARAM a;\nVAR a;\nBEGIN\nRETURN b\nEND." ,
+        "CONST a = 1;\nBEGIN\na := 2;\nRETURN a\nEND." ,
+        "PARAM a;\nBEGIN\na := 1\nEND." ,
+    } ;
+    Pljit pljit ;
+    for(string_view source : sources) {
+        // static compiler is usable at runtime , errors are printed by CodeManager
+        StaticProgram<64> program = StaticCompiler<64>(source).compile() ;
+        ASSERT_TRUE(program.error.failed()) << source ;
+        string expected = pljit.registerFunction(source)({}).second ;
+        ASSERT_EQ(compile_error_text(source , program.error) , expected) << source ;
+        // message of static_assert is the first line of the runtime message behind the position
+        string_view header = string_view(expected).substr(0 , expected.find('\n')) ;
+        ASSERT_EQ(header.substr(header.find("error: ") + 7) , program.error.message.view()) << source ;
+    }
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "pljit/backend/CCompiler.hpp"
+#include "pljit/backend/CEmitter.hpp"
+#include "pljit/backend/SharedObject.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+
+#include <limits>
+#include <memory>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+using namespace jitcompiler ::syntax;
+using namespace jitcompiler ::semantic;
+
+TEST(TestCBackend , TestEquivalence) {
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    vector<string_view> codes = {
+        "PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n" ,
+        "PARAM a , b;\nVAR x;\nBEGIN\nx := a / 1000;\nRETURN x * 1000 + a * b - -x\nEND.\n" ,
+        "PARAM a , b;\nCONST c = 7;\nBEGIN\nRETURN a * 8 + b / c - 16 * (a / -3) + -b / (a * a + 1)\nEND.\n" ,
+        "PARAM a , b;\nVAR x , y;\nBEGIN\nx := a / b;\ny := (a + 1) / b;\nRETURN x + y\nEND.\n"
+    } ;
+    vector<int64_t> values = {minimum , minimum + 1 , -1000 , -3 , -1 , 0 , 1 , 2 , 7 , 4321 , maximum - 1 , maximum} ;
+
+    // all functions are compiled into a single shared object , each with both arithmetic modes
+    vector<unique_ptr<CodeManager>> managers ;
+    vector<unique_ptr<ir::Function>> functions ;
+    backend::CEmitter emitter ;
+    for(string_view code : codes)
+        for(ArithmeticMode mode : {ArithmeticMode::WRAPAROUND , ArithmeticMode::CHECKED}) {
+            managers.push_back(make_unique<CodeManager>(code)) ;
+            TokenStream tokenStream(managers.back().get()) ;
+            ASSERT_TRUE(tokenStream.compileCode()) ;
+            FunctionDeclaration functionDeclaration(managers.back().get()) ;
+            ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+            FunctionAST functionAst(managers.back().get()) ;
+            ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+            OptimizationVisitor optimizationVisitor(OptimizationVisitor::ALL_PASSES , {} , mode) ;
+            functionAst.acceptOptimization(optimizationVisitor) ;
+            functions.push_back(make_unique<ir::Function>(functionAst , mode)) ;
+            emitter.emitFunction(*functions.back() , "function" + to_string(functions.size() - 1)) ;
+        }
+
+    string directory = backend::CCompiler::createTemporaryDirectory() ;
+    ASSERT_FALSE(directory.empty()) ;
+    string path = directory + "/functions.so" ;
+    optional<string> error = backend::CCompiler::compile(emitter.getSource() , path , backend::CCompiler::Output::SHARED_OBJECT) ;
+    if(error.has_value()) {
+        backend::CCompiler::removeTemporaryDirectory(directory) ;
+        GTEST_SKIP() << "C compiler is not available: " << error.value() ;
+    }
+    string loadError ;
+    unique_ptr<backend::SharedObject> library = backend::SharedObject::load(path , loadError) ;
+    backend::CCompiler::removeTemporaryDirectory(directory) ;
+    ASSERT_NE(library , nullptr) << loadError ;
+
+    for(size_t index = 0 ; index < functions.size() ; ++index) {
+        auto entry = reinterpret_cast<backend::CEmitter::Entry>(library->getSymbol("function" + to_string(index))) ;
+        ASSERT_NE(entry , nullptr) ;
+        for(int64_t a : values)
+            for(int64_t b : values) {
+                vector<int64_t> param = {a , b} ;
+                const char* nativeError = nullptr ;
+                int64_t nativeResult = entry(param.data() , &nativeError) ;
+                optional<int64_t> result = functions[index]->evaluate(param) ;
+                // native code reports the same runtime error as the interpreter
+                string expectedError = managers[index]->runtimeErrorMessage() ;
+                ASSERT_EQ(nativeError == nullptr , result.has_value()) << index << ": " << a << " " << b ;
+                if(result.has_value())
+                    ASSERT_EQ(nativeResult , result.value()) << index << ": " << a << " " << b ;
+                else
+                    ASSERT_EQ(string(nativeError) , expectedError) ;
+            }
+    }
+}
+TEST(TestCBackend , TestCompilerDiagnostics) {
+    string directory = backend::CCompiler::createTemporaryDirectory() ;
+    ASSERT_FALSE(directory.empty()) ;
+    optional<string> error = backend::CCompiler::compile("int f( {" , directory + "/broken.so" , backend::CCompiler::Output::SHARED_OBJECT) ;
+    backend::CCompiler::removeTemporaryDirectory(directory) ;
+    ASSERT_TRUE(error.has_value()) ;
+    ASSERT_FALSE(error.value().empty()) ;
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+
+#include "pljit/backend/CodeHeap.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::backend;
+
+TEST(TestCodeHeap , TestExecution) {
+#if defined(__x86_64__) && defined(__linux__)
+    CodeHeap heap ;
+    // mov rax , 42 ; ret
+    const uint8_t code[] = {0x48 , 0xC7 , 0xC0 , 0x2A , 0x00 , 0x00 , 0x00 , 0xC3} ;
+    optional<CodeHeap::Block> block = heap.allocate(code , sizeof(code) , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(block.has_value()) ;
+    ASSERT_EQ(block->size , CodeHeap::MIN_BLOCK_SIZE) ;
+    auto function = reinterpret_cast<int64_t (*)()>(const_cast<void*>(block->code)) ;
+    ASSERT_EQ(function() , 42) ;
+
+    // no mapping of the process is writable and executable at once
+    ifstream maps("/proc/self/maps") ;
+    string line ;
+    while(getline(maps , line)) {
+        istringstream fields(line) ;
+        string range , permissions ;
+        fields >> range >> permissions ;
+        ASSERT_FALSE(permissions[1] == 'w' && permissions[2] == 'x') << line ;
+    }
+    heap.release(block.value()) ;
+#else
+    GTEST_SKIP() << "code heap is not executable on this platform" ;
+#endif
+}
+TEST(TestCodeHeap , TestSizeClasses) {
+    if(!CodeHeap::isSupported())
+        GTEST_SKIP() << "code heap is not supported on this platform" ;
+    CodeHeap heap ;
+    vector<uint8_t> code(CodeHeap::CHUNK_SIZE + 1 , 0xC3) ;
+    ASSERT_FALSE(heap.allocate(code.data() , code.size() , CodeHeap::Temperature::COLD).has_value()) ;
+
+    optional<CodeHeap::Block> first = heap.allocate(code.data() , 100 , CodeHeap::Temperature::COLD) ;
+    optional<CodeHeap::Block> second = heap.allocate(code.data() , 128 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(first.has_value() && second.has_value()) ;
+    ASSERT_EQ(first->size , 128) ;
+    // consecutive blocks of an arena are adjacent
+    ASSERT_EQ(static_cast<const uint8_t*>(first->code) + 128 , second->code) ;
+    ASSERT_EQ(heap.getStatistics().allocatedBytes , 256) ;
+
+    // released block is reused by next allocation of its size class
+    heap.release(first.value()) ;
+    ASSERT_EQ(heap.getStatistics().freeBytes , 128) ;
+    optional<CodeHeap::Block> third = heap.allocate(code.data() , 65 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(third.has_value()) ;
+    ASSERT_EQ(third->code , first->code) ;
+    ASSERT_EQ(heap.getStatistics().freeBytes , 0) ;
+
+    // a whole chunk forces a new chunk , remainder of previous chunk is kept in free lists
+    optional<CodeHeap::Block> large = heap.allocate(code.data() , CodeHeap::CHUNK_SIZE , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(large.has_value()) ;
+    CodeHeap::Statistics statistics = heap.getStatistics() ;
+    ASSERT_EQ(statistics.mappedBytes , 2 * CodeHeap::CHUNK_SIZE) ;
+    ASSERT_EQ(statistics.allocatedBytes + statistics.freeBytes , statistics.mappedBytes) ;
+    heap.release(large.value()) ;
+    // free chunk is split for smaller size classes
+    optional<CodeHeap::Block> small = heap.allocate(code.data() , 1 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(small.has_value()) ;
+    ASSERT_EQ(heap.getStatistics().mappedBytes , 2 * CodeHeap::CHUNK_SIZE) ;
+    heap.release(small.value()) ;
+    heap.release(second.value()) ;
+    heap.release(third.value()) ;
+    ASSERT_EQ(heap.getStatistics().allocatedBytes , 0) ;
+}
+TEST(TestCodeHeap , TestCoalescing) {
+    if(!CodeHeap::isSupported())
+        GTEST_SKIP() << "code heap is not supported on this platform" ;
+    CodeHeap heap ;
+    vector<uint8_t> code(CodeHeap::CHUNK_SIZE , 0xC3) ;
+    optional<CodeHeap::Block> first = heap.allocate(code.data() , 1 , CodeHeap::Temperature::COLD) ;
+    optional<CodeHeap::Block> second = heap.allocate(code.data() , 1 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(first.has_value() && second.has_value()) ;
+    // blocks are aligned to their size , fresh memory in front of them is kept in free lists
+    optional<CodeHeap::Block> large = heap.allocate(code.data() , 200 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(large.has_value()) ;
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(large->code) % large->size , 0) ;
+    ASSERT_EQ(heap.getStatistics().freeBytes , 128) ;
+
+    // released buddies are merged into a block of the next larger size class
+    heap.release(first.value()) ;
+    heap.release(second.value()) ;
+    ASSERT_EQ(heap.getStatistics().freeBytes , 256) ;
+    optional<CodeHeap::Block> merged = heap.allocate(code.data() , 250 , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(merged.has_value()) ;
+    ASSERT_EQ(merged->code , first->code) ;
+    ASSERT_EQ(heap.getStatistics().freeBytes , 0) ;
+
+    // a chunk whose blocks are all released is a whole free chunk again
+    heap.release(merged.value()) ;
+    heap.release(large.value()) ;
+    optional<CodeHeap::Block> chunk = heap.allocate(code.data() , CodeHeap::CHUNK_SIZE , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(chunk.has_value()) ;
+    ASSERT_EQ(heap.getStatistics().mappedBytes , 2 * CodeHeap::CHUNK_SIZE) ;
+    optional<CodeHeap::Block> reused = heap.allocate(code.data() , CodeHeap::CHUNK_SIZE , CodeHeap::Temperature::COLD) ;
+    ASSERT_TRUE(reused.has_value()) ;
+    ASSERT_EQ(reused->code , first->code) ;
+    ASSERT_EQ(heap.getStatistics().mappedBytes , 2 * CodeHeap::CHUNK_SIZE) ;
+    heap.release(chunk.value()) ;
+    heap.release(reused.value()) ;
+}
+TEST(TestCodeHeap , TestTemperature) {
+    if(!CodeHeap::isSupported())
+        GTEST_SKIP() << "code heap is not supported on this platform" ;
+    // huge pages are used if they are reserved , otherwise heap falls back to normal pages
+    CodeHeap heap(true) ;
+    const uint8_t code[] = {0xC3} ;
+    vector<CodeHeap::Block> hot ;
+    for(size_t index = 0 ; index < 8 ; ++index) {
+        optional<CodeHeap::Block> cold = heap.allocate(code , sizeof(code) , CodeHeap::Temperature::COLD) ;
+        ASSERT_TRUE(cold.has_value()) ;
+        hot.push_back(heap.allocate(code , sizeof(code) , CodeHeap::Temperature::HOT).value()) ;
+        // hot code is not interleaved with cold code
+        uintptr_t distance = reinterpret_cast<uintptr_t>(hot.back().code) - reinterpret_cast<uintptr_t>(hot.front().code) ;
+        ASSERT_EQ(distance , index * CodeHeap::MIN_BLOCK_SIZE) ;
+        heap.release(cold.value()) ;
+    }
+    ASSERT_EQ(heap.getStatistics().mappedBytes , 2 * CodeHeap::CHUNK_SIZE) ;
+    ASSERT_LE(heap.getStatistics().hugePageChunks , 2) ;
+    for(const CodeHeap::Block& block : hot)
+        heap.release(block) ;
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "pljit/Pljit.hpp"
+#include "pljit/backend/CCompiler.hpp"
+#include "pljit/backend/CodeRegistry.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::backend;
+
+TEST(TestCodeRegistry , TestSymfile) {
+    // line table : prologue and first statement on line 4 , second statement on line 5
+    const uint8_t code[64] = {} ;
+    vector<char> symfile = CodeRegistry::buildSymfile("pljit_function_7" , "pljit_function_7.pl" , code , sizeof(code) , {{0 , 3} , {40 , 4}}) ;
+    if(symfile.empty())
+        GTEST_SKIP() << "code registry is not supported on this platform" ;
+    ASSERT_EQ(string_view(symfile.data() , 4) , "\x7f" "ELF") ;
+
+    string directory = CCompiler::createTemporaryDirectory() ;
+    ASSERT_FALSE(directory.empty()) ;
+    string path = directory + "/symfile.o" ;
+    ofstream(path , ios::binary).write(symfile.data() , static_cast<streamsize>(symfile.size())) ;
+    int status = system(("readelf -W -s --debug-dump=decodedline " + path + " > " + directory + "/readelf.txt 2>&1").c_str()) ;
+    stringstream output ;
+    output << ifstream(directory + "/readelf.txt").rdbuf() ;
+    CCompiler::removeTemporaryDirectory(directory) ;
+    if(status != 0)
+        GTEST_SKIP() << "readelf is not available" ;
+
+    char address[32] ;
+    snprintf(address , sizeof(address) , "%llx" , static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(code) + 40)) ;
+    ASSERT_NE(output.str().find("64 FUNC    GLOBAL DEFAULT    1 pljit_function_7") , string::npos) << output.str() ;
+    ASSERT_NE(output.str().find("pljit_function_7.pl") , string::npos) << output.str() ;
+    // readelf prints file name , source line and address of each row
+    string row , fileName , line , rowAddress ;
+    while(getline(output , row)) {
+        istringstream(row) >> fileName >> line >> rowAddress ;
+        if(rowAddress == string("0x") + address)
+            break ;
+    }
+    ASSERT_EQ(line , "5") << output.str() ;
+}
+TEST(TestCodeRegistry , TestRegistration) {
+    if(!PatchedFunction::isSupported())
+        GTEST_SKIP() << "copy-and-patch is not supported on this platform" ;
+    CodeRegistry::enable(CodeRegistry::PERF_MAP | CodeRegistry::JITDUMP | CodeRegistry::GDB) ;
+    ASSERT_EQ(CodeRegistry::getOutputs() , CodeRegistry::PERF_MAP | CodeRegistry::JITDUMP | CodeRegistry::GDB) ;
+    jit_code_entry* previousEntry = __jit_debug_descriptor.first_entry ;
+    {
+        Pljit pljit ;
+        auto func = pljit.registerFunction("PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n") ;
+        // first call is evaluated by closures , the second call patches machine code
+        ASSERT_EQ(func({7 , 2}).first.value() , 3) ;
+        ASSERT_EQ(__jit_debug_descriptor.first_entry , previousEntry) ;
+        ASSERT_EQ(func({9 , 2}).first.value() , 4) ;
+
+        // function is registered at GDB JIT interface
+        jit_code_entry* entry = __jit_debug_descriptor.first_entry ;
+        ASSERT_NE(entry , previousEntry) ;
+        ASSERT_EQ(entry->next_entry , previousEntry) ;
+        string_view symfile(entry->symfile_addr , entry->symfile_size) ;
+        ASSERT_NE(symfile.find("pljit_function_0.pl") , string_view::npos) ;
+
+        stringstream perfMap ;
+        perfMap << ifstream(CodeRegistry::getPerfMapPath()).rdbuf() ;
+        ASSERT_NE(perfMap.str().find(" pljit_function_0\n") , string::npos) ;
+        stringstream jitdump ;
+        jitdump << ifstream(CodeRegistry::getJitdumpPath() , ios::binary).rdbuf() ;
+        ASSERT_EQ(jitdump.str().substr(0 , 4) , "DTiJ") ;
+        ASSERT_NE(jitdump.str().find("pljit_function_0") , string::npos) ;
+    }
+    // code is unregistered with its function
+    ASSERT_EQ(__jit_debug_descriptor.first_entry , previousEntry) ;
+    CodeRegistry::enable(0) ;
+    ASSERT_EQ(CodeRegistry::getOutputs() , 0) ;
+    remove(CodeRegistry::getPerfMapPath().c_str()) ;
+    remove(CodeRegistry::getJitdumpPath().c_str()) ;
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "pljit/backend/CCompiler.hpp"
+#include "pljit/backend/ObjectCompiler.hpp"
+#include "pljit/backend/SharedObject.hpp"
+
+#include <cstdlib>
+#include <elf.h>
+#include <fstream>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestObjectCompiler , TestRelocatableObject) {
+    backend::ObjectCompiler objectCompiler ;
+    ASSERT_FALSE(objectCompiler.addFunction("volume" , "PARAM width , height , depth;\nBEGIN\nRETURN width * height * depth\nEND.\n" , ArithmeticMode::WRAPAROUND).has_value()) ;
+    ASSERT_FALSE(objectCompiler.addFunction("ratio" , "PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n" , ArithmeticMode::CHECKED).has_value()) ;
+    // compile errors and invalid symbols are reported
+    ASSERT_TRUE(objectCompiler.addFunction("broken" , "BEGIN\nRETURN a\nEND.\n" , ArithmeticMode::WRAPAROUND).has_value()) ;
+    ASSERT_TRUE(objectCompiler.addFunction("ratio" , "BEGIN\nRETURN 1\nEND.\n" , ArithmeticMode::WRAPAROUND).has_value()) ;
+    ASSERT_TRUE(objectCompiler.addFunction("1st" , "BEGIN\nRETURN 1\nEND.\n" , ArithmeticMode::WRAPAROUND).has_value()) ;
+    ASSERT_NE(objectCompiler.getHeader().find("int64_t ratio(const int64_t* parameterList , const char** error) ;") , string::npos) ;
+
+    string directory = backend::CCompiler::createTemporaryDirectory() ;
+    ASSERT_FALSE(directory.empty()) ;
+    string objectPath = directory + "/functions.o" ;
+    if(optional<string> error = objectCompiler.writeObject(objectPath)) {
+        backend::CCompiler::removeTemporaryDirectory(directory) ;
+        GTEST_SKIP() << "C compiler is not available: " << error.value() ;
+    }
+    Elf64_Ehdr elfHeader {} ;
+    ifstream(objectPath , ios::binary).read(reinterpret_cast<char*>(&elfHeader) , sizeof(elfHeader)) ;
+    ASSERT_EQ(string_view(reinterpret_cast<const char*>(elfHeader.e_ident) , 4) , ELFMAG) ;
+    ASSERT_EQ(elfHeader.e_type , ET_REL) ;
+
+    // link object like a service binary would and call exported functions
+    string libraryPath = directory + "/functions.so" ;
+    ASSERT_EQ(system(("cc -shared -o " + libraryPath + " " + objectPath).c_str()) , 0) ;
+    string loadError ;
+    unique_ptr<backend::SharedObject> library = backend::SharedObject::load(libraryPath , loadError) ;
+    backend::CCompiler::removeTemporaryDirectory(directory) ;
+    ASSERT_NE(library , nullptr) << loadError ;
+    auto volume = reinterpret_cast<backend::CEmitter::Entry>(library->getSymbol("volume")) ;
+    auto ratio = reinterpret_cast<backend::CEmitter::Entry>(library->getSymbol("ratio")) ;
+    ASSERT_NE(volume , nullptr) ;
+    ASSERT_NE(ratio , nullptr) ;
+    ASSERT_EQ(library->getSymbol("broken") , nullptr) ;
+
+    const char* error = nullptr ;
+    int64_t parameterList[] = {2 , 3 , 4} ;
+    ASSERT_EQ(volume(parameterList , &error) , 24) ;
+    ASSERT_EQ(error , nullptr) ;
+    int64_t division[] = {numeric_limits<int64_t>::min() , -1} ;
+    ratio(division , &error) ;
+    ASSERT_STREQ(error , "3:10: Runtime Error: Integer Overflow\nRETURN a / b\n         ^\n") ;
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "pljit/backend/PatchedFunction.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+
+#include <limits>
+#include <memory>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+using namespace jitcompiler ::syntax;
+using namespace jitcompiler ::semantic;
+
+TEST(TestPatchedFunction , TestEquivalence) {
+    if(!backend::PatchedFunction::isSupported())
+        GTEST_SKIP() << "copy-and-patch is not supported on this platform" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    vector<string_view> codes = {
+        "PARAM a , b;\nBEGIN\nRETURN a / b\nEND.\n" ,
+        "PARAM a , b;\nVAR x;\nBEGIN\nx := a / 1000;\nRETURN x * 1000 + a * b - -x\nEND.\n" ,
+        "PARAM a , b;\nCONST c = 7;\nBEGIN\nRETURN a * 8 + b / c - 16 * (a / -3) + -b / (a * a + 1)\nEND.\n" ,
+        "PARAM a , b;\nVAR x , y;\nBEGIN\nx := a / b;\ny := (a + 1) / b;\nRETURN x + y\nEND.\n" ,
+        "PARAM a , b;\nBEGIN\nRETURN a / 3 + b / -5 + a / 641 - b / 4 + a / -1 + 42\nEND.\n"
+    } ;
+    backend::CodeHeap heap ;
+    vector<int64_t> values = {minimum , minimum + 1 , -1000 , -3 , -1 , 0 , 1 , 2 , 7 , 4321 , maximum - 1 , maximum} ;
+
+    for(string_view code : codes) {
+        CodeManager manager(code) ;
+        TokenStream tokenStream(&manager) ;
+        ASSERT_TRUE(tokenStream.compileCode()) ;
+        FunctionDeclaration functionDeclaration(&manager) ;
+        ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+        FunctionAST functionAst(&manager) ;
+        ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+        OptimizationVisitor optimizationVisitor ;
+        functionAst.acceptOptimization(optimizationVisitor) ;
+        ir::Function function(functionAst) ;
+        unique_ptr<backend::PatchedFunction> patchedFunction = backend::PatchedFunction::compile(function , heap) ;
+        ASSERT_NE(patchedFunction , nullptr) ;
+        ASSERT_GT(patchedFunction->getCodeSize() , 0) ;
+
+        for(int64_t a : values) {
+            for(int64_t b : values) {
+                vector<int64_t> param = {a , b} ;
+                CodeReference reference ;
+                optional<int64_t> patchedResult = patchedFunction->evaluate(param , reference) ;
+                optional<int64_t> result = function.evaluate(param) ;
+                ASSERT_EQ(patchedResult , result) << code << a << " " << b ;
+                // division by zero traps and is mapped back to the "/" operator
+                if(!result.has_value()) {
+                    ASSERT_EQ(manager.runtimeErrorText(reference , "Divide by Zero") , manager.runtimeErrorMessage()) ;
+                }
+            }
+        }
+    }
+}
+TEST(TestPatchedFunction , TestCheckedArithmetic) {
+    // overflow checks are left to the interpreter
+    constexpr string_view code = "PARAM a;\nBEGIN\nRETURN a + 1\nEND.\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    ASSERT_TRUE(tokenStream.compileCode()) ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+    backend::CodeHeap heap ;
+    ASSERT_EQ(backend::PatchedFunction::compile(ir::Function(functionAst , ArithmeticMode::CHECKED) , heap) , nullptr) ;
+}
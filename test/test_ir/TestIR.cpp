@@ -0,0 +1,291 @@
+#include <gtest/gtest.h>
+
+#include "pljit/ir/IR.hpp"
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/EvaluationContext.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+
+#include <limits>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+using namespace jitcompiler ::syntax;
+using namespace jitcompiler ::semantic;
+
+TEST(TestIR , TestRenaming) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a + b;\n"
+                                 "a := c * b;\n"
+                                 "c := a - c;\n"
+                                 "RETURN c\n"
+                                 "END.\n" ;
+    constexpr string_view expectedIR = "%0 = param 0\n"
+                                       "%1 = param 1\n"
+                                       "%2 = add %0 %1\n"
+                                       "%3 = mul %2 %1\n"
+                                       "%4 = sub %3 %2\n"
+                                       "ret %4\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ir::Function function(functionAst) ;
+    ASSERT_EQ(function.print() , expectedIR) ;
+    ASSERT_EQ(function.num_parameters() , 2) ;
+    ASSERT_EQ(function.evaluate({3 , 4}).value() , 28 - 7) ;
+}
+TEST(TestIR , TestSourceLines) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a + b;\n"
+                                 "a := c * b;\n"
+                                 "c := a - c;\n"
+                                 "RETURN c\n"
+                                 "END.\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    // instructions are mapped to the (0-based) line of the statement which computes them
+    ir::Function function(functionAst) ;
+    vector<size_t> lines ;
+    for(size_t index = 0 ; index < function.getInstructions().size() ; ++index)
+        lines.push_back(function.getLine(index)) ;
+    ASSERT_EQ(lines , vector<size_t>({3 , 3 , 3 , 4 , 5 , 6})) ;
+}
+TEST(TestIR , TestValueNumberingAndDeadCode) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c , d;\n"
+                                 "CONST two = 2;\n"
+                                 "BEGIN\n"
+                                 "c := a * b;\n"
+                                 "d := b - a;\n"
+                                 "d := a / b;\n"
+                                 "RETURN a * b + c * two\n"
+                                 "END.\n" ;
+    // "b - a" is never used , "a / b" may trigger a runtime error and is kept
+    constexpr string_view expectedIR = "%0 = param 0\n"
+                                       "%1 = param 1\n"
+                                       "%2 = mul %0 %1\n"
+                                       "%3 = div %0 %1\n"
+                                       "%4 = shl %2 1\n"
+                                       "%5 = add %2 %4\n"
+                                       "ret %5\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ir::Function function(functionAst) ;
+    ASSERT_EQ(function.print() , expectedIR) ;
+    ASSERT_EQ(function.evaluate({3 , 4}).value() , 36) ;
+    ASSERT_FALSE(function.evaluate({3 , 0}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "7:8: Runtime Error: Divide by Zero\n"
+                                              "d := a / b;\n"
+                                              "       ^\n") ;
+}
+TEST(TestIR , TestStrengthReduction) {
+    constexpr string_view code = "PARAM a;\n"
+                                 "BEGIN\n"
+                                 "RETURN a * 8 + a / 7 - 16 * (a / -3) + (a / 1) * 0\n"
+                                 "END.\n" ;
+    constexpr string_view expectedIR = "%0 = param 0\n"
+                                       "%1 = shl %0 3\n"
+                                       "%2 = divc %0 7\n"
+                                       "%3 = divc %0 -3\n"
+                                       "%4 = shl %3 4\n"
+                                       "%5 = sub %2 %4\n"
+                                       "%6 = add %1 %5\n"
+                                       "ret %6\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ir::Function function(functionAst) ;
+    ASSERT_EQ(function.print() , expectedIR) ;
+    for(int64_t a = -100 ; a <= 100 ; a++) {
+        vector<int64_t> param = {a} ;
+        EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+        ASSERT_EQ(function.evaluate(param) , functionAst.evaluate(evaluationContext)) ;
+    }
+}
+TEST(TestIR , TestDivideConstant) {
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    vector<int64_t> divisors = {2 , 3 , 5 , 6 , 7 , 10 , 16 , 641 , 1000000007 , maximum , minimum , minimum + 1} ;
+    vector<int64_t> values = {0 , 1 , 2 , 3 , 6 , 7 , 100 , 1000000006 , maximum , maximum - 1 , minimum + 1 , minimum} ;
+    for(size_t index = 0 , size = divisors.size() ; index < size ; ++index)
+        divisors.push_back(divisors[index] == minimum ? minimum : -divisors[index]) ;
+    for(size_t index = 0 , size = values.size() ; index < size ; ++index)
+        if(values[index] != minimum)
+            values.push_back(-values[index]) ;
+
+    for(int64_t divisor : divisors) {
+        string code = "PARAM a;\nBEGIN\nRETURN a / " + (divisor == minimum ? string("(") + to_string(minimum + 1) + " - 1)" : "(" + to_string(divisor) + ")") + "\nEND.\n" ;
+        CodeManager manager(code) ;
+        TokenStream tokenStream(&manager) ;
+        tokenStream.compileCode() ;
+        FunctionDeclaration functionDeclaration(&manager) ;
+        ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+        FunctionAST functionAst(&manager) ;
+        ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+        ir::Function function(functionAst) ;
+        ASSERT_EQ(function.getInstructions()[1].opcode , ir::Instruction::Opcode::DIVIDE_CONSTANT) ;
+        for(int64_t value : values)
+            ASSERT_EQ(function.evaluate({value}).value() , value / divisor) << value << " / " << divisor ;
+    }
+}
+TEST(TestIR , TestNonzeroDivisor) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR x , y;\n"
+                                 "BEGIN\n"
+                                 "x := a / b;\n"
+                                 "y := (a + 1) / b;\n"
+                                 "RETURN x + y\n"
+                                 "END.\n" ;
+    // second division is reached only if b is non zero
+    constexpr string_view expectedIR = "%0 = param 0\n"
+                                       "%1 = param 1\n"
+                                       "%2 = div %0 %1\n"
+                                       "%3 = const 1\n"
+                                       "%4 = add %0 %3\n"
+                                       "%5 = divnz %4 %1\n"
+                                       "%6 = add %2 %5\n"
+                                       "ret %6\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ir::Function function(functionAst) ;
+    ASSERT_EQ(function.print() , expectedIR) ;
+    ASSERT_EQ(function.evaluate({7 , 2}) , 7) ;
+    ASSERT_FALSE(function.evaluate({7 , 0}).has_value()) ;
+}
+TEST(TestIR , TestCheckedArithmetic) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR x;\n"
+                                 "BEGIN\n"
+                                 "x := a / 1000;\n"
+                                 "RETURN x * 1000 + a * b - -x\n"
+                                 "END.\n" ;
+    // operators whose operand ranges prove that they cannot overflow are not checked
+    constexpr string_view expectedIR = "%0 = param 0\n"
+                                       "%1 = const 1000\n"
+                                       "%2 = divc %0 1000\n"
+                                       "%3 = mul %2 %1\n"
+                                       "%4 = param 1\n"
+                                       "%5 = cmul %0 %4\n"
+                                       "%6 = neg %2\n"
+                                       "%7 = csub %5 %6\n"
+                                       "%8 = cadd %3 %7\n"
+                                       "ret %8\n" ;
+    constexpr string_view expectedRuntimeError = "5:25: Runtime Error: Integer Overflow\n"
+                                                 "RETURN x * 1000 + a * b - -x\n"
+                                                 "                        ^\n" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ir::Function function(functionAst , ArithmeticMode::CHECKED) ;
+    ASSERT_EQ(function.print() , expectedIR) ;
+    ASSERT_FALSE(function.evaluate({maximum , 1}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , expectedRuntimeError) ;
+    for(int64_t a : {minimum , minimum + 1 , int64_t(-5000) , int64_t(0) , int64_t(4321) , maximum})
+        for(int64_t b : {int64_t(-1) , int64_t(0) , int64_t(1) , int64_t(2)}) {
+            vector<int64_t> param = {a , b} ;
+            EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+            evaluationContext.setArithmeticMode(ArithmeticMode::CHECKED) ;
+            ASSERT_EQ(function.evaluate(param) , functionAst.evaluate(evaluationContext)) << a << " " << b ;
+            manager.runtimeErrorMessage() ;
+        }
+}
+TEST(TestIR , TestCheckedDivision) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "BEGIN\n"
+                                 "RETURN a / b + a / (b * b + 1)\n"
+                                 "END.\n" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    // INT64_MIN / -1 wraps around to INT64_MIN unless arithmetic is checked
+    ir::Function wraparound(functionAst) ;
+    ASSERT_EQ(wraparound.evaluate({minimum , -1}) , wrapping_add(minimum , minimum / 2)) ;
+    ir::Function checked(functionAst , ArithmeticMode::CHECKED) ;
+    ASSERT_EQ(checked.getInstructions()[2].opcode , ir::Instruction::Opcode::CHECKED_DIVIDE) ;
+    ASSERT_FALSE(checked.evaluate({minimum , -1}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "3:10: Runtime Error: Integer Overflow\nRETURN a / b + a / (b * b + 1)\n         ^\n") ;
+    ASSERT_FALSE(checked.evaluate({minimum , 0}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "3:10: Runtime Error: Divide by Zero\nRETURN a / b + a / (b * b + 1)\n         ^\n") ;
+    ASSERT_EQ(checked.evaluate({7 , 2}) , 3 + 1) ;
+}
+TEST(TestIR , TestOptimizedEquivalence) {
+    constexpr string_view code = "PARAM width , height , depth;\n"
+                                 "VAR volume , area;\n"
+                                 "CONST density = 2400 , offset = 7;\n"
+                                 "BEGIN\n"
+                                 "area := width * -height;\n"
+                                 "width := area / 4 + -(-width);\n"
+                                 "volume := area * depth + offset;\n"
+                                 "RETURN density * volume / (depth - 2) - +width\n"
+                                 "END.\n" ;
+    for(bool optimize : {false , true}) {
+        CodeManager manager(code) ;
+        TokenStream tokenStream(&manager) ;
+        tokenStream.compileCode() ;
+        FunctionDeclaration functionDeclaration(&manager) ;
+        ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+        FunctionAST functionAst(&manager) ;
+        ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+        if(optimize) {
+            OptimizationVisitor optimizationVisitor(OptimizationVisitor::ALL_PASSES) ;
+            functionAst.acceptOptimization(optimizationVisitor) ;
+        }
+
+        ir::Function function(functionAst) ;
+        for(int64_t width = -9 ; width <= 9 ; width++)
+            for(int64_t depth = 0 ; depth <= 4 ; depth++) {
+                vector<int64_t> param = {width , 5 , depth} ;
+                EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+                auto expected = functionAst.evaluate(evaluationContext) ;
+                string expectedError = manager.runtimeErrorMessage() ;
+                ASSERT_EQ(function.evaluate(param) , expected) ;
+                ASSERT_EQ(manager.runtimeErrorMessage() , expectedError) ;
+            }
+    }
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "pljit/management/CallTelemetry.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestCallTelemetry , TestBuckets) {
+    // small latencies have a bucket of their own
+    for(uint64_t nanoseconds = 0 ; nanoseconds < 4 ; ++nanoseconds)
+        ASSERT_EQ(CallTelemetry::bucket(nanoseconds) , nanoseconds) ;
+    size_t previous = 0 ;
+    for(uint64_t nanoseconds = 1 ; nanoseconds < (uint64_t(1) << 42) ; nanoseconds += nanoseconds / 3 + 1) {
+        size_t bucket = CallTelemetry::bucket(nanoseconds) ;
+        ASSERT_GE(bucket , previous) ;
+        ASSERT_LT(bucket , CallTelemetry::NUM_BUCKETS) ;
+        ASSERT_GT(CallTelemetry::upperBound(bucket) , nanoseconds) ;
+        if(bucket > 0) {
+            ASSERT_LE(CallTelemetry::upperBound(bucket - 1) , nanoseconds) ;
+        }
+        previous = bucket ;
+    }
+    // 4 linear sub buckets per power of two
+    ASSERT_EQ(CallTelemetry::upperBound(CallTelemetry::bucket(1000)) , 1024) ;
+    ASSERT_EQ(CallTelemetry::bucket(1024) , CallTelemetry::bucket(1279)) ;
+    ASSERT_EQ(CallTelemetry::bucket(1280) , CallTelemetry::bucket(1024) + 1) ;
+    ASSERT_EQ(CallTelemetry::bucket(uint64_t(1) << 50) , CallTelemetry::NUM_BUCKETS - 1) ;
+}
+TEST(TestCallTelemetry , TestShards) {
+    CallTelemetry telemetry ;
+    vector<thread> threads ;
+    for(uint64_t id = 0 ; id < 2 * CallTelemetry::SHARDS ; ++id)
+        threads.emplace_back([&telemetry , id] {
+            for(uint64_t call = 0 ; call < 1000 ; ++call)
+                telemetry.record(id , call % 10 == 0) ;
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    CallTelemetry::Snapshot snapshot = telemetry.snapshot() ;
+    ASSERT_EQ(snapshot.calls , 32000) ;
+    ASSERT_EQ(snapshot.errors , 3200) ;
+    // sum of ids 0 to 31
+    ASSERT_EQ(snapshot.totalNanoseconds , 496000) ;
+    uint64_t count = 0 ;
+    for(uint64_t calls : snapshot.buckets)
+        count += calls ;
+    ASSERT_EQ(count , 32000) ;
+    ASSERT_EQ(snapshot.buckets[CallTelemetry::bucket(31)] , 4000) ;
+}
+TEST(TestCallTelemetry , TestFormat) {
+    CallTelemetry telemetry ;
+    telemetry.record(500 , false) ;
+    telemetry.record(500 , false) ;
+    telemetry.record(2000 , true) ;
+    string text = CallTelemetry::format({{"f" , telemetry.snapshot()} , {"g" , CallTelemetry().snapshot()}}) ;
+    ASSERT_NE(text.find("# TYPE pljit_calls_total counter\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_calls_total{function=\"f\"} 3\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_errors_total{function=\"f\"} 1\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_calls_total{function=\"g\"} 0\n") , string::npos) << text ;
+    // buckets are cumulative with inclusive upper bound in seconds
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"f\",le=\"5.11e-07\"} 2\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"f\",le=\"2.047e-06\"} 3\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"f\",le=\"+Inf\"} 3\n") , string::npos) << text ;
+    // empty buckets are part of the layout
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"f\",le=\"0\"} 0\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"f\",le=\"2.559e-06\"} 3\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_bucket{function=\"g\",le=\"5.11e-07\"} 0\n") , string::npos) << text ;
+    size_t bucketLines = 0 ;
+    for(size_t position = text.find("_bucket{") ; position != string::npos ; position = text.find("_bucket{" , position + 1))
+        ++bucketLines ;
+    ASSERT_EQ(bucketLines , 2 * CallTelemetry::NUM_BUCKETS) ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_sum{function=\"f\"} 3e-06\n") , string::npos) << text ;
+    ASSERT_NE(text.find("pljit_call_latency_seconds_count{function=\"g\"} 0\n") , string::npos) << text ;
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "pljit/management/CompileStatistics.hpp"
+#include "pljit/management/MemoryAccount.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestCompileStatistics , TestPhaseTimer) {
+    MemoryAccount account ;
+    CompileStatistics::PhaseTimer timer ;
+    pmr::vector<ResourcePointer<int64_t>> values(&account) ;
+    for(int64_t value = 0 ; value < 10 ; ++value)
+        values.push_back(make_resource<int64_t>(&account , value)) ;
+    // allocations which do not pass through an account are not counted
+    vector<unique_ptr<int64_t>> uncharged ;
+    uncharged.push_back(make_unique<int64_t>(0)) ;
+    CompileStatistics::Sample sample = timer.finishPhase(42) ;
+    // vector may allocate more than once while growing
+    ASSERT_GE(sample.allocations , 11) ;
+    ASSERT_LT(sample.allocations , 20) ;
+    ASSERT_EQ(sample.outputSize , 42) ;
+    // next phase starts where previous phase finished
+    ASSERT_EQ(timer.finishPhase(0).allocations , 0) ;
+}
+TEST(TestCompileStatistics , TestSummary) {
+    CompileStatistics statistics ;
+    ASSERT_EQ(statistics.summarize(CompileStatistics::LEXING).samples , 0) ;
+    for(uint64_t value = 1 ; value <= 100 ; ++value) {
+        CompileStatistics::Compilation compilation ;
+        compilation.function = value ;
+        compilation.phases[CompileStatistics::LEXING] = CompileStatistics::Sample{value * 1000 , value , 2 * value} ;
+        // later phases did not run after compile error
+        if(value % 2 == 0)
+            compilation.phases[CompileStatistics::PARSING] = CompileStatistics::Sample{value , 0 , 0} ;
+        statistics.record(compilation) ;
+    }
+    ASSERT_EQ(statistics.getCompilations().size() , 100) ;
+    ASSERT_EQ(statistics.getCompilations()[9].totalNanoseconds() , 10010) ;
+
+    CompileStatistics::PhaseSummary lexing = statistics.summarize(CompileStatistics::LEXING) ;
+    ASSERT_EQ(lexing.samples , 100) ;
+    ASSERT_EQ(lexing.nanoseconds.p50 , 50000) ;
+    ASSERT_EQ(lexing.nanoseconds.p90 , 90000) ;
+    ASSERT_EQ(lexing.nanoseconds.p99 , 99000) ;
+    ASSERT_EQ(lexing.nanoseconds.max , 100000) ;
+    ASSERT_EQ(lexing.allocations.total , 5050) ;
+    ASSERT_EQ(lexing.outputSize.p50 , 100) ;
+
+    CompileStatistics::PhaseSummary parsing = statistics.summarize(CompileStatistics::PARSING) ;
+    ASSERT_EQ(parsing.samples , 50) ;
+    ASSERT_EQ(parsing.nanoseconds.p50 , 50) ;
+    ASSERT_EQ(parsing.nanoseconds.max , 100) ;
+    ASSERT_EQ(statistics.summarize(CompileStatistics::CODE_GENERATION).samples , 0) ;
+}
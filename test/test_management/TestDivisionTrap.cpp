@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <csignal>
+#include <limits>
+
+#include "pljit/management/DivisionTrap.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/wait.h>
+// native function : return parameterList[0] / parameterList[1] without checking the divisor
+extern "C" int64_t pljit_test_divide(const int64_t* parameterList) ;
+extern "C" const char pljit_test_divide_end[] ;
+asm(".text\n"
+    ".globl pljit_test_divide\n"
+    "pljit_test_divide:\n"
+    "    movq (%rdi) , %rax\n"      // 3 bytes
+    "    movq 8(%rdi) , %rcx\n"     // 4 bytes
+    "    cqto\n"                    // 2 bytes
+    "    idivq %rcx\n"              // offset 9
+    "    ret\n"
+    ".globl pljit_test_divide_end\n"
+    "pljit_test_divide_end:\n") ;
+//---------------------------------------------------------------------------
+TEST(TestDivisionTrap , TestTrap) {
+    ASSERT_TRUE(DivisionTrap::isSupported()) ;
+    const void* begin = reinterpret_cast<const void*>(&pljit_test_divide) ;
+    size_t size = static_cast<size_t>(pljit_test_divide_end - reinterpret_cast<const char*>(begin)) ;
+    CodeReference division({3 , 11} , {3 , 11}) ;
+    optional<size_t> region = DivisionTrap::registerCode(begin , size , {{9 , division}}) ;
+    ASSERT_TRUE(region.has_value()) ;
+
+    CodeReference reference ;
+    int64_t parameterList[] = {42 , 5} ;
+    ASSERT_EQ(DivisionTrap::call(pljit_test_divide , parameterList , reference) , 8) ;
+    // trap is mapped to code reference of faulting division
+    parameterList[1] = 0 ;
+    ASSERT_FALSE(DivisionTrap::call(pljit_test_divide , parameterList , reference).has_value()) ;
+    ASSERT_EQ(reference.getStartLineRange() , division.getStartLineRange()) ;
+    // guarded calls can be repeated after a trap
+    parameterList[1] = -2 ;
+    ASSERT_EQ(DivisionTrap::call(pljit_test_divide , parameterList , reference) , -21) ;
+    parameterList[1] = 0 ;
+    ASSERT_FALSE(DivisionTrap::call(pljit_test_divide , parameterList , reference).has_value()) ;
+    // INT64_MIN / -1 wraps around and returns from native code
+    parameterList[0] = numeric_limits<int64_t>::min() ;
+    parameterList[1] = -1 ;
+    ASSERT_EQ(DivisionTrap::call(pljit_test_divide , parameterList , reference) , numeric_limits<int64_t>::min()) ;
+
+    DivisionTrap::unregisterCode(region.value()) ;
+    // region can be reused
+    region = DivisionTrap::registerCode(begin , size , {{9 , division}}) ;
+    ASSERT_TRUE(region.has_value()) ;
+    DivisionTrap::unregisterCode(region.value()) ;
+}
+//---------------------------------------------------------------------------
+TEST(TestDivisionTrap , TestManyRegions) {
+    const void* begin = reinterpret_cast<const void*>(&pljit_test_divide) ;
+    size_t size = static_cast<size_t>(pljit_test_divide_end - reinterpret_cast<const char*>(begin)) ;
+    CodeReference division({7 , 2} , {7 , 2}) ;
+    // more regions than fit into one block , the region of the code is the last one
+    vector<size_t> regions ;
+    for(size_t index = 0 ; index < 3 * DivisionTrap::REGIONS_PER_BLOCK ; ++index) {
+        optional<size_t> region = DivisionTrap::registerCode(&regions , 1 , {}) ;
+        ASSERT_TRUE(region.has_value()) ;
+        regions.push_back(region.value()) ;
+    }
+    optional<size_t> region = DivisionTrap::registerCode(begin , size , {{9 , division}}) ;
+    ASSERT_TRUE(region.has_value()) ;
+
+    CodeReference reference ;
+    int64_t parameterList[] = {42 , 0} ;
+    ASSERT_FALSE(DivisionTrap::call(pljit_test_divide , parameterList , reference).has_value()) ;
+    ASSERT_EQ(reference.getStartLineRange() , division.getStartLineRange()) ;
+    DivisionTrap::unregisterCode(region.value()) ;
+    for(size_t index : regions)
+        DivisionTrap::unregisterCode(index) ;
+}
+//---------------------------------------------------------------------------
+TEST(TestDivisionTrap , TestUnregisteredTrap) {
+    const void* begin = reinterpret_cast<const void*>(&pljit_test_divide) ;
+    size_t size = static_cast<size_t>(pljit_test_divide_end - reinterpret_cast<const char*>(begin)) ;
+    optional<size_t> region = DivisionTrap::registerCode(begin , size , {{9 , CodeReference({1 , 1} , {1 , 1})}}) ;
+    ASSERT_TRUE(region.has_value()) ;
+    DivisionTrap::unregisterCode(region.value()) ;
+    // trap of code which is not registered keeps previous behaviour : default action or handler of a sanitizer
+    int64_t parameterList[] = {42 , 0} ;
+    CodeReference reference ;
+    auto trapped = [](int status) {
+        return testing::KilledBySignal(SIGFPE)(status) || (WIFEXITED(status) && WEXITSTATUS(status) != 0) ;
+    } ;
+    ASSERT_EXIT(DivisionTrap::call(pljit_test_divide , parameterList , reference) , trapped , "") ;
+}
+#endif
+//---------------------------------------------------------------------------
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "pljit/management/LockProfile.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestLockProfile , TestCounters) {
+    LockProfile profile ;
+    vector<thread> threads ;
+    for(uint64_t id = 0 ; id < 8 ; ++id)
+        threads.emplace_back([&profile , id] {
+            for(uint64_t round = 0 ; round < 100 ; ++round) {
+                profile.record(LockProfile::SHARED , false , 0) ;
+                profile.record(LockProfile::EXCLUSIVE , round % 10 == 0 , id * 100 + round) ;
+            }
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    LockProfile::Counters shared = profile.getCounters(LockProfile::SHARED) ;
+    ASSERT_EQ(shared.acquisitions , 800) ;
+    ASSERT_EQ(shared.contended , 0) ;
+    ASSERT_EQ(shared.waitNanoseconds , 0) ;
+    LockProfile::Counters exclusive = profile.getCounters(LockProfile::EXCLUSIVE) ;
+    ASSERT_EQ(exclusive.acquisitions , 800) ;
+    ASSERT_EQ(exclusive.contended , 80) ;
+    // each thread waits id * 1000 + 450 in total
+    ASSERT_EQ(exclusive.waitNanoseconds , 28000 + 8 * 450) ;
+    ASSERT_EQ(exclusive.maxWaitNanoseconds , 790) ;
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "pljit/management/MemoCache.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestMemoCache , TestLookup) {
+    MemoCache cache(64) ;
+    ASSERT_FALSE(cache.lookup({1 , 2}).has_value()) ;
+    cache.insert({1 , 2} , {3 , ""}) ;
+    cache.insert({2 , 0} , {nullopt , "Divide by Zero"}) ;
+    ASSERT_EQ(cache.lookup({1 , 2}) , MemoCache::Result(3 , "")) ;
+    ASSERT_EQ(cache.lookup({2 , 0}) , MemoCache::Result(nullopt , "Divide by Zero")) ;
+    ASSERT_FALSE(cache.lookup({2 , 1}).has_value()) ;
+    ASSERT_FALSE(cache.lookup({1}).has_value()) ;
+    // inserting same parameters again replaces result
+    cache.insert({1 , 2} , {3 , ""}) ;
+    ASSERT_EQ(cache.size() , 2) ;
+}
+TEST(TestMemoCache , TestBoundedSize) {
+    MemoCache cache(MemoCache::STRIPES * 4) ;
+    for(int64_t value = 0 ; value < 10000 ; ++value) {
+        cache.insert({value} , {value , ""}) ;
+        ASSERT_LE(cache.size() , MemoCache::STRIPES * 4) ;
+    }
+    // most recent result is always cached
+    ASSERT_EQ(cache.lookup({9999}) , MemoCache::Result(9999 , "")) ;
+}
+TEST(TestMemoCache , TestSecondChance) {
+    // entry which is looked up between insertions is skipped by clock hand , entries which are never looked up are evicted
+    MemoCache cache(MemoCache::STRIPES * 4) ;
+    cache.insert({-1} , {-1 , ""}) ;
+    for(int64_t value = 0 ; value < 10000 ; ++value) {
+        ASSERT_EQ(cache.lookup({-1}) , MemoCache::Result(-1 , "")) ;
+        cache.insert({value} , {value , ""}) ;
+    }
+    ASSERT_EQ(cache.lookup({-1}) , MemoCache::Result(-1 , "")) ;
+    ASSERT_FALSE(cache.lookup({0}).has_value()) ;
+}
+TEST(TestMemoCache , TestConcurrentAccess) {
+    MemoCache cache(256) ;
+    vector<thread> threads ;
+    for(int64_t id = 0 ; id < 8 ; ++id)
+        threads.emplace_back([&cache , id] {
+            for(int64_t value = 0 ; value < 2000 ; ++value) {
+                vector<int64_t> parameterList = {value % 300 , id % 2} ;
+                auto cached = cache.lookup(parameterList) ;
+                if(cached.has_value())
+                    ASSERT_EQ(cached->first.value() , value % 300 + id % 2) ;
+                else
+                    cache.insert(parameterList , {value % 300 + id % 2 , ""}) ;
+            }
+        }) ;
+    for(auto &t : threads)
+        t.join() ;
+    ASSERT_LE(cache.size() , 256) ;
+}
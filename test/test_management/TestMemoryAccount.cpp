@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "pljit/management/MemoryAccount.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+namespace {
+    struct Base {
+        virtual ~Base() = default ;
+    };
+    struct Derived : Base {
+        int64_t values[8] = {} ;
+    };
+} // anonymous namespace
+
+TEST(TestMemoryAccount , TestContainers) {
+    MemoryAccount account ;
+    {
+        pmr::vector<int64_t> values(100 , 0 , &account) ;
+        ASSERT_EQ(account.getAllocations() , 1) ;
+        ASSERT_EQ(account.getBytes() , 100 * sizeof(int64_t)) ;
+        // containers with a default allocator are not charged
+        vector<int64_t> uncharged(100) ;
+        values.push_back(1) ;
+        ASSERT_EQ(account.getAllocations() , 1) ;
+        ASSERT_EQ(account.getBytes() , values.capacity() * sizeof(int64_t)) ;
+    }
+    ASSERT_EQ(account.getBytes() , 0) ;
+    ASSERT_EQ(account.getAllocations() , 0) ;
+}
+TEST(TestMemoryAccount , TestResourcePointer) {
+    MemoryAccount account ;
+    uint64_t allocations = MemoryAccount::threadAllocations() ;
+    ResourcePointer<Base> node = make_resource<Derived>(&account) ;
+    ASSERT_EQ(account.getBytes() , sizeof(Derived)) ;
+    ASSERT_EQ(MemoryAccount::threadAllocations() , allocations + 1) ;
+    // node is freed through its base class with the size of the derived class
+    node.reset() ;
+    ASSERT_EQ(account.getBytes() , 0) ;
+}
+TEST(TestMemoryAccount , TestThreads) {
+    MemoryAccount account ;
+    unique_ptr<pmr::string> text = make_unique<pmr::string>(1000 , 'x' , &account) ;
+    // allocations are credited back on any thread
+    thread([&account , &text] {
+        pmr::string other(1000 , 'y' , &account) ;
+        ASSERT_GE(account.getBytes() , 2000) ;
+        text.reset() ;
+    }).join() ;
+    ASSERT_EQ(account.getBytes() , 0) ;
+}
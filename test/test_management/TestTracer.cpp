@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "pljit/management/Tracer.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+namespace {
+size_t count(const string& text , const string& pattern) {
+    size_t result = 0 ;
+    for(size_t position = text.find(pattern) ; position != string::npos ; position = text.find(pattern , position + 1))
+        ++result ;
+    return result ;
+}
+} // anonymous namespace
+
+TEST(TestTracer , TestSpans) {
+    Tracer::flush() ;
+    {
+        // tracing is disabled by default
+        Tracer::Span span("ignored" , "test" , 0) ;
+    }
+    Tracer::enable(true) ;
+    {
+        Tracer::Span span("outer" , "test" , 7) ;
+        thread([] {
+            Tracer::Span span("inner" , "test" , 8) ;
+        }).join() ;
+    }
+    Tracer::enable(false) ;
+    string json = Tracer::flush() ;
+    ASSERT_EQ(json.substr(0 , 40) , "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n") << json ;
+    ASSERT_EQ(json.find("ignored") , string::npos) << json ;
+    ASSERT_NE(json.find("{\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":") , string::npos) << json ;
+    ASSERT_NE(json.find("\"args\":{\"function\":7}}") , string::npos) << json ;
+    ASSERT_NE(json.find("\"args\":{\"function\":8}}") , string::npos) << json ;
+    // events are removed by flush
+    ASSERT_EQ(Tracer::flush() , "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n") ;
+}
+TEST(TestTracer , TestRingBuffer) {
+    Tracer::flush() ;
+    for(uint64_t index = 0 ; index < Tracer::CAPACITY + 10 ; ++index)
+        Tracer::record("event" , "test" , index , 1000 , 2500) ;
+    string json = Tracer::flush() ;
+    // oldest events are overwritten , the slot of the next event is skipped since it may be written concurrently
+    ASSERT_EQ(count(json , "\"name\":\"event\"") , Tracer::CAPACITY - 1) ;
+    ASSERT_EQ(json.find("\"function\":10}") , string::npos) ;
+    ASSERT_NE(json.find("\"function\":11}") , string::npos) ;
+    ASSERT_NE(json.find("\"ts\":1.000,\"dur\":1.500") , string::npos) ;
+}
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include "pljit/management/ValueProfile.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+
+TEST(TestValueProfile , TestStableParameters) {
+    ValueProfile profile(100) ;
+    for(int64_t call = 0 ; call < 99 ; ++call) {
+        // parameter 0 always changes , parameter 1 is 7 except every 20th call , parameter 2 is 3 in half of calls
+        vector<int64_t> param = {call , call % 20 == 0 ? call : 7 , call % 2 ? 3 : call} ;
+        ASSERT_FALSE(profile.record(param)) ;
+        ASSERT_FALSE(profile.isComplete()) ;
+        ASSERT_TRUE(profile.stableParameters().empty()) ;
+    }
+    ASSERT_TRUE(profile.record({0 , 7 , 3})) ;
+    ASSERT_TRUE(profile.isComplete()) ;
+    // later calls are not recorded
+    ASSERT_FALSE(profile.record({0 , 7 , 3})) ;
+
+    unordered_map<size_t , int64_t> expected = {{1 , 7}} ;
+    ASSERT_EQ(profile.stableParameters() , expected) ;
+}
+TEST(TestValueProfile , TestDisabled) {
+    ValueProfile profile(0) ;
+    for(int64_t call = 0 ; call < 10 ; ++call)
+        ASSERT_FALSE(profile.record({1})) ;
+    ASSERT_FALSE(profile.isComplete()) ;
+    ASSERT_TRUE(profile.stableParameters().empty()) ;
+}
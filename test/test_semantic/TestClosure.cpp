@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/ClosureFunction.hpp"
+#include "pljit/semantic/EvaluationContext.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+
+#include <limits>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+using namespace jitcompiler ::syntax;
+using namespace jitcompiler ::semantic;
+
+TEST(TestClosure , TestEquivalence) {
+    constexpr string_view code = "PARAM width , height , depth;\n"
+                                 "VAR volume , area;\n"
+                                 "CONST density = 2400 , offset = 7;\n"
+                                 "BEGIN\n"
+                                 "area := width * -height;\n"
+                                 "volume := area * depth + offset;\n"
+                                 "width := -(width - depth) / 2;\n"
+                                 "RETURN density * volume / (depth - 2) - +width + (area - volume) * (height + 1);\n"
+                                 "volume := 0\n"
+                                 "END.\n" ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    for(ArithmeticMode mode : {ArithmeticMode::WRAPAROUND , ArithmeticMode::CHECKED}) {
+        for(bool optimize : {false , true}) {
+            CodeManager manager(code) ;
+            TokenStream tokenStream(&manager) ;
+            tokenStream.compileCode() ;
+            FunctionDeclaration functionDeclaration(&manager) ;
+            ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+            FunctionAST functionAst(&manager) ;
+            ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+            if(optimize) {
+                OptimizationVisitor optimizationVisitor(OptimizationVisitor::ALL_PASSES , {} , mode) ;
+                functionAst.acceptOptimization(optimizationVisitor) ;
+            }
+
+            ClosureFunction closureFunction(functionAst , mode) ;
+            ASSERT_EQ(closureFunction.num_parameters() , 3) ;
+            for(int64_t width : {int64_t(-3) , int64_t(0) , int64_t(5) , maximum})
+                for(int64_t depth = 0 ; depth <= 4 ; depth++) {
+                    vector<int64_t> param = {width , 5 , depth} ;
+                    EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+                    evaluationContext.setArithmeticMode(mode) ;
+                    auto expected = functionAst.evaluate(evaluationContext) ;
+                    string expectedError = manager.runtimeErrorMessage() ;
+                    auto result = closureFunction.evaluate(param) ;
+                    ASSERT_EQ(result , expected) ;
+                    ASSERT_EQ(manager.runtimeErrorMessage() , expectedError) ;
+                }
+        }
+    }
+}
+TEST(TestClosure , TestRuntimeErrors) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a / b;\n"
+                                 "RETURN -c * 2 + a / 1\n"
+                                 "END.\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    ClosureFunction wrapping(functionAst) ;
+    ASSERT_FALSE(wrapping.evaluate({1 , 0}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "4:8: Runtime Error: Divide by Zero\n"
+                                              "c := a / b;\n"
+                                              "       ^\n") ;
+    ASSERT_EQ(wrapping.evaluate({6 , 3}).value() , 2) ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    ASSERT_EQ(wrapping.evaluate({minimum , -1}).value() , minimum) ;
+    ASSERT_TRUE(manager.runtimeErrorMessage().empty()) ;
+
+    // evaluation stops at the first runtime error
+    ClosureFunction checked(functionAst , ArithmeticMode::CHECKED) ;
+    ASSERT_FALSE(checked.evaluate({minimum , -1}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "4:8: Runtime Error: Integer Overflow\n"
+                                              "c := a / b;\n"
+                                              "       ^\n") ;
+    ASSERT_FALSE(checked.evaluate({minimum , 1}).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , "5:8: Runtime Error: Integer Overflow\n"
+                                              "RETURN -c * 2 + a / 1\n"
+                                              "       ^\n") ;
+}
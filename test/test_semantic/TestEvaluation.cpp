@@ -3,6 +3,8 @@
 #include "pljit/semantic/AST.hpp"
 #include "pljit/semantic/EvaluationContext.hpp"
 
+#include <limits>
+
 using namespace std ;
 using namespace jitcompiler ;
 using namespace jitcompiler ::management;
@@ -263,3 +265,45 @@ TEST(TestEvaluation , TestDivideByZero) {
     ASSERT_TRUE(!val.has_value());
     ASSERT_EQ(manager.runtimeErrorMessage() , expected) ;
 }
+TEST(TestEvaluation , TestCheckedArithmetic) {
+    constexpr string_view code =
+        "PARAM a , b;\n"
+        "BEGIN\n"
+        "RETURN -a + a * b\n"
+        "END.\n" ;
+    constexpr string_view expectedMultiply =
+        "3:15: Runtime Error: Integer Overflow\n"
+        "RETURN -a + a * b\n"
+        "              ^\n" ;
+    constexpr string_view expectedNegate =
+        "3:8: Runtime Error: Integer Overflow\n"
+        "RETURN -a + a * b\n"
+        "       ^\n" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+    SymbolTable symbolTable = functionAst.getSymbolTable();
+
+    // results wrap around by default
+    EvaluationContext wraparoundContext({maximum , 2} , symbolTable);
+    ASSERT_EQ(functionAst.evaluate(wraparoundContext) , maximum) ;
+    EvaluationContext checkedContext({maximum , 2} , symbolTable);
+    checkedContext.setArithmeticMode(ArithmeticMode::CHECKED) ;
+    ASSERT_FALSE(functionAst.evaluate(checkedContext).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , expectedMultiply) ;
+
+    EvaluationContext negateContext({minimum , 1} , symbolTable);
+    negateContext.setArithmeticMode(ArithmeticMode::CHECKED) ;
+    ASSERT_FALSE(functionAst.evaluate(negateContext).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , expectedNegate) ;
+
+    EvaluationContext validContext({maximum , 1} , symbolTable);
+    validContext.setArithmeticMode(ArithmeticMode::CHECKED) ;
+    ASSERT_EQ(functionAst.evaluate(validContext) , 0) ;
+}
@@ -767,3 +767,489 @@ TEST(TestOptimization , TestNestedOptimizations)
     ASSERT_NE(printAstVisitorOptimized.getOutput() , oldDot) ;
     ASSERT_EQ(printAstVisitorOptimized.getOutput() , optimizedDot) ;
 }
+TEST(TestOptimization , TestCommonSubexpressionTemporary)
+{
+    constexpr string_view code = "PARAM width , height;\n"
+                                 "VAR a , b;\n"
+                                 "BEGIN\n"
+                                 "a := width * height + 1;\n"
+                                 "b := height * width - 1;\n"
+                                 "RETURN a * b\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tIdentifier -> \"width\";\n"
+                                         "\tIdentifier -> \"height\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(+) -> Literal;\n"
+                                         "\tIdentifier -> \"$0\";\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(-);\n"
+                                         "\tBinaryExpression(-) -> Identifier;\n"
+                                         "\tBinaryExpression(-) -> Literal;\n"
+                                         "\tIdentifier -> \"$0\";\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tReturn Statement -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tIdentifier -> \"b\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::COMMON_SUBEXPRESSION_ELIMINATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+    // generated identifiers belong to the code manager of the function
+    const auto& temporaryAssignment = static_cast<const AssignmentStatementAST&>(functionAst.getStatement(0)) ;
+    ASSERT_EQ(temporaryAssignment.getLeftIdentifier().getManager() , &manager) ;
+
+    for(int64_t width = -5 ; width <= 5 ; width++) {
+        EvaluationContext evaluationContext({width , 7} , functionAst.getSymbolTable()) ;
+        auto result = functionAst.evaluate(evaluationContext) ;
+        ASSERT_TRUE(result.has_value()) ;
+        ASSERT_EQ(result.value() , (width * 7 + 1) * (width * 7 - 1)) ;
+    }
+}
+TEST(TestOptimization , TestCommonSubexpressionReassignment)
+{
+    // x * y must be recomputed after x is reassigned
+    constexpr string_view code = "PARAM x , y;\n"
+                                 "VAR a;\n"
+                                 "BEGIN\n"
+                                 "a := x * y;\n"
+                                 "x := x + 1;\n"
+                                 "RETURN a + x * y\n"
+                                 "END.\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+    string oldDot = functionAst.testDot() ;
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::COMMON_SUBEXPRESSION_ELIMINATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , oldDot) ;
+
+    EvaluationContext evaluationContext({3 , 4} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 3 * 4 + 4 * 4) ;
+}
+TEST(TestOptimization , TestCommonSubexpressionDivision)
+{
+    // x / y is reused from a , remaining division by y must not be moved before the first one
+    constexpr string_view code = "PARAM x , y;\n"
+                                 "VAR a;\n"
+                                 "BEGIN\n"
+                                 "a := x / y;\n"
+                                 "RETURN (x / y) * (1 / y) + (1 / y)\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(/);\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tIdentifier -> \"x\";\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(/);\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> BinaryExpression(/);\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tBinaryExpression(/) -> Literal;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "\tBinaryExpression(/) -> Literal;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "}\n" ;
+    constexpr string_view expectedRuntimeError = "4:8: Runtime Error: Divide by Zero\n"
+                                                 "a := x / y;\n"
+                                                 "       ^\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::COMMON_SUBEXPRESSION_ELIMINATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    EvaluationContext evaluationContext({5 , 0} , functionAst.getSymbolTable()) ;
+    ASSERT_FALSE(functionAst.evaluate(evaluationContext).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , expectedRuntimeError) ;
+}
+TEST(TestOptimization , TestDeadStoreElimination)
+{
+    // first store to x is overwritten , z is folded into return statement , y is never read but may divide by zero
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR x , y , z;\n"
+                                 "BEGIN\n"
+                                 "x := a * b;\n"
+                                 "y := a / b;\n"
+                                 "x := a + 1;\n"
+                                 "z := 3;\n"
+                                 "RETURN x * z + a\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(/);\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tIdentifier -> \"b\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(+) -> Literal;\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Literal;\n"
+                                         "\tIdentifier -> \"x\";\n"
+                                         "\tLiteral -> \"3\";\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "}\n" ;
+    constexpr string_view expectedRuntimeError = "5:8: Runtime Error: Divide by Zero\n"
+                                                 "y := a / b;\n"
+                                                 "       ^\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::DEAD_STORE_ELIMINATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    EvaluationContext evaluationContext({4 , 2} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 5 * 3 + 4) ;
+    EvaluationContext evaluationContextError({4 , 0} , functionAst.getSymbolTable()) ;
+    ASSERT_FALSE(functionAst.evaluate(evaluationContextError).has_value()) ;
+    ASSERT_EQ(manager.runtimeErrorMessage() , expectedRuntimeError) ;
+}
+TEST(TestOptimization , TestAlgebraicSimplification)
+{
+    // y / x * 0 must not be folded since it may divide by zero
+    constexpr string_view code = "PARAM x , y;\n"
+                                 "VAR a , b;\n"
+                                 "BEGIN\n"
+                                 "a := x * 1 + 0;\n"
+                                 "b := a * 0 + 2;\n"
+                                 "RETURN -(-a) * (y / x * 0) + +(a - 0) * 0 + b\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tIdentifier -> \"x\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> Literal;\n"
+                                         "\tLiteral -> \"2\";\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> Literal;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> BinaryExpression(/);\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tBinaryExpression(/) -> Literal;\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "\tLiteral -> \"0\";\n"
+                                         "\tLiteral -> \"2\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::ALGEBRAIC_SIMPLIFICATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    EvaluationContext evaluationContext({3 , 4} , functionAst.getSymbolTable()) ;
+    ASSERT_FALSE(functionAst.evaluate(evaluationContext).has_value()) ;
+    ASSERT_FALSE(manager.runtimeErrorMessage().empty()) ;
+}
+TEST(TestOptimization , TestReassociation)
+{
+    constexpr string_view code = "PARAM density , width;\n"
+                                 "BEGIN\n"
+                                 "RETURN 2 * density * width * 3 + 1 + density / width + 4\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> Literal;\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(/);\n"
+                                         "\tBinaryExpression(*) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(*) -> Literal;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tIdentifier -> \"density\";\n"
+                                         "\tIdentifier -> \"width\";\n"
+                                         "\tLiteral -> \"6\";\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tIdentifier -> \"density\";\n"
+                                         "\tIdentifier -> \"width\";\n"
+                                         "\tLiteral -> \"5\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::REASSOCIATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    for(int64_t density = -5 ; density <= 5 ; density++)
+        for(int64_t width = 1 ; width <= 5 ; width++) {
+            EvaluationContext evaluationContext({density , width} , functionAst.getSymbolTable()) ;
+            ASSERT_EQ(functionAst.evaluate(evaluationContext) , 2 * density * width * 3 + 1 + density / width + 4) ;
+        }
+}
+TEST(TestOptimization , TestReassociationWraparound)
+{
+    // 2^62 * 4 wraps around to 0 in 64 bits
+    constexpr string_view code = "PARAM a;\n"
+                                 "BEGIN\n"
+                                 "RETURN 4611686018427387904 * a * 4\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tReturn Statement -> Literal;\n"
+                                         "\tLiteral -> \"0\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::REASSOCIATION | OptimizationVisitor::ALGEBRAIC_SIMPLIFICATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+}
+TEST(TestOptimization , TestCopyPropagation)
+{
+    constexpr string_view code = "PARAM width;\n"
+                                 "VAR a , b;\n"
+                                 "BEGIN\n"
+                                 "a := width;\n"
+                                 "b := a * a;\n"
+                                 "RETURN b\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tReturn Statement -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tIdentifier -> \"width\";\n"
+                                         "\tIdentifier -> \"width\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::COPY_PROPAGATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    EvaluationContext evaluationContext({-7} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 49) ;
+}
+TEST(TestOptimization , TestExpressionForwarding)
+{
+    // a is read twice , b may divide by zero , c is forwarded into return statement .
+    // x is changed after b is assigned , therefore b cannot be forwarded past it either
+    constexpr string_view code = "PARAM x , y;\n"
+                                 "VAR a , b , c;\n"
+                                 "BEGIN\n"
+                                 "a := x + y;\n"
+                                 "b := x / y;\n"
+                                 "x := 1;\n"
+                                 "c := a * b;\n"
+                                 "RETURN c + a\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Assignment Statement(:=);\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tIdentifier -> \"x\";\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> BinaryExpression(/);\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tBinaryExpression(/) -> Identifier;\n"
+                                         "\tIdentifier -> \"x\";\n"
+                                         "\tIdentifier -> \"y\";\n"
+                                         "\tAssignment Statement(:=) -> Identifier;\n"
+                                         "\tAssignment Statement(:=) -> Literal;\n"
+                                         "\tLiteral -> \"1\";\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "\tIdentifier -> \"b\";\n"
+                                         "\tIdentifier -> \"a\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::COPY_PROPAGATION) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+
+    EvaluationContext evaluationContext({9 , 2} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 11 * 4 + 11) ;
+}
+TEST(TestOptimization , TestForwardingAcrossReassignment)
+{
+    // a := b + 1 is forwarded into the assignment which changes b , copy c := b is only valid before it
+    constexpr string_view code = "PARAM b;\n"
+                                 "VAR a , c;\n"
+                                 "BEGIN\n"
+                                 "c := b;\n"
+                                 "a := b + 1;\n"
+                                 "b := a * c;\n"
+                                 "RETURN b - c\n"
+                                 "END.\n" ;
+    for(unsigned passes : {0u , static_cast<unsigned>(OptimizationVisitor::COPY_PROPAGATION) , OptimizationVisitor::ALL_PASSES}) {
+        CodeManager manager(code);
+        TokenStream tokenStream(&manager);
+        tokenStream.compileCode();
+        FunctionDeclaration functionDeclaration(&manager);
+        ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+        FunctionAST functionAst(&manager);
+        ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+        OptimizationVisitor optimizationVisitor(passes) ;
+        functionAst.acceptOptimization(optimizationVisitor) ;
+        for(int64_t b = -5 ; b <= 5 ; b++) {
+            EvaluationContext evaluationContext({b} , functionAst.getSymbolTable()) ;
+            ASSERT_EQ(functionAst.evaluate(evaluationContext) , (b + 1) * b - b) ;
+        }
+    }
+}
+TEST(TestOptimization , TestNonConstantReassignment)
+{
+    // constant value of a is overwritten by a non constant value
+    constexpr string_view code = "PARAM q;\n"
+                                 "VAR a;\n"
+                                 "BEGIN\n"
+                                 "a := 1;\n"
+                                 "a := q;\n"
+                                 "RETURN a\n"
+                                 "END.\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    EvaluationContext evaluationContext({5} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 5) ;
+}
+TEST(TestOptimization , TestBoundParameters)
+{
+    constexpr string_view code = "PARAM rate , amount;\n"
+                                 "VAR fee;\n"
+                                 "BEGIN\n"
+                                 "fee := rate * 10 + 5;\n"
+                                 "rate := amount;\n"
+                                 "RETURN fee * amount + rate\n"
+                                 "END.\n" ;
+    constexpr string_view optimizedDot = "digraph {\n"
+                                         "\tFunction -> Return Statement;\n"
+                                         "\tReturn Statement -> BinaryExpression(+);\n"
+                                         "\tBinaryExpression(+) -> BinaryExpression(*);\n"
+                                         "\tBinaryExpression(+) -> Identifier;\n"
+                                         "\tBinaryExpression(*) -> Literal;\n"
+                                         "\tBinaryExpression(*) -> Identifier;\n"
+                                         "\tLiteral -> \"35\";\n"
+                                         "\tIdentifier -> \"amount\";\n"
+                                         "\tIdentifier -> \"amount\";\n"
+                                         "}\n" ;
+    CodeManager manager(code);
+    TokenStream tokenStream(&manager);
+    tokenStream.compileCode();
+    FunctionDeclaration functionDeclaration(&manager);
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream));
+    FunctionAST functionAst(&manager);
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration));
+
+    OptimizationVisitor optimizationVisitor(OptimizationVisitor::ALL_PASSES , {{0 , 3} , {7 , 1}}) ;
+    functionAst.acceptOptimization(optimizationVisitor) ;
+    ASSERT_EQ(functionAst.testDot() , optimizedDot) ;
+    EvaluationContext evaluationContext({0 , 4} , functionAst.getSymbolTable()) ;
+    ASSERT_EQ(functionAst.evaluate(evaluationContext) , 35 * 4 + 4) ;
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include "pljit/semantic/AST.hpp"
+#include "pljit/semantic/EvaluationContext.hpp"
+#include "pljit/semantic/OptimizationASTVisitor.hpp"
+#include "pljit/semantic/SerializedFunction.hpp"
+
+#include <limits>
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::management;
+using namespace jitcompiler ::syntax;
+using namespace jitcompiler ::semantic;
+
+TEST(TestSerialization , TestLiteral) {
+    constexpr string_view code = "BEGIN\n"
+                                 "RETURN 1\n"
+                                 "END.\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    string buffer = functionAst.serialize() ;
+    SerializedFunction serializedFunction(buffer) ;
+    ASSERT_TRUE(serializedFunction.isValid()) ;
+    ASSERT_EQ(serializedFunction.num_parameters() , 0) ;
+    auto result = serializedFunction.evaluate({}) ;
+    ASSERT_TRUE(result.has_value()) ;
+    ASSERT_EQ(result.value() , 1) ;
+}
+TEST(TestSerialization , TestRoundTrip) {
+    constexpr string_view code = "PARAM width , height , depth;\n"
+                                 "VAR volume , area;\n"
+                                 "CONST density = 2400 , offset = 7;\n"
+                                 "BEGIN\n"
+                                 "area := width * -height;\n"
+                                 "volume := area * depth + offset;\n"
+                                 "RETURN density * volume / (depth - 2) - +width;\n"
+                                 "volume := 0\n"
+                                 "END.\n" ;
+    for(bool optimize : {false , true}) {
+        CodeManager manager(code) ;
+        TokenStream tokenStream(&manager) ;
+        tokenStream.compileCode() ;
+        FunctionDeclaration functionDeclaration(&manager) ;
+        ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+        FunctionAST functionAst(&manager) ;
+        ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+        if(optimize) {
+            OptimizationVisitor optimizationVisitor ;
+            functionAst.acceptOptimization(optimizationVisitor) ;
+        }
+
+        string buffer = functionAst.serialize() ;
+        // reader must not depend on the address of the buffer
+        string movedBuffer = "padding" + buffer ;
+        SerializedFunction serializedFunction(string_view(movedBuffer).substr(7)) ;
+        ASSERT_TRUE(serializedFunction.isValid()) ;
+        ASSERT_EQ(serializedFunction.num_parameters() , 3) ;
+        for(int64_t width = -3 ; width <= 3 ; width++)
+            for(int64_t depth = 0 ; depth <= 4 ; depth++) {
+                vector<int64_t> param = {width , 5 , depth} ;
+                EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+                auto expected = functionAst.evaluate(evaluationContext) ;
+                auto result = serializedFunction.evaluate(param) ;
+                ASSERT_EQ(result , expected) ;
+                ASSERT_EQ(serializedFunction.runtimeErrorMessage() , manager.runtimeErrorMessage()) ;
+            }
+    }
+}
+TEST(TestSerialization , TestDivideByZero) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a / b;\n"
+                                 "RETURN c\n"
+                                 "END.\n" ;
+    constexpr string_view expectedRuntimeError = "4:8: Runtime Error: Divide by Zero\n"
+                                                 "c := a / b;\n"
+                                                 "       ^\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    string buffer = functionAst.serialize() ;
+    SerializedFunction serializedFunction(buffer) ;
+    ASSERT_TRUE(serializedFunction.isValid()) ;
+    ASSERT_FALSE(serializedFunction.evaluate({1 , 0}).has_value()) ;
+    ASSERT_EQ(serializedFunction.runtimeErrorMessage() , expectedRuntimeError) ;
+    ASSERT_EQ(serializedFunction.evaluate({6 , 3}).value() , 2) ;
+    ASSERT_TRUE(serializedFunction.runtimeErrorMessage().empty()) ;
+}
+TEST(TestSerialization , TestCheckedArithmetic) {
+    constexpr string_view code = "PARAM a , b;\n"
+                                 "VAR c;\n"
+                                 "BEGIN\n"
+                                 "c := a * b + -a;\n"
+                                 "RETURN c / b - 1\n"
+                                 "END.\n" ;
+    constexpr int64_t minimum = numeric_limits<int64_t>::min() ;
+    constexpr int64_t maximum = numeric_limits<int64_t>::max() ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+
+    string buffer = functionAst.serialize(ArithmeticMode::CHECKED) ;
+    SerializedFunction serializedFunction(buffer) ;
+    ASSERT_TRUE(serializedFunction.isValid()) ;
+    // overflow triggers a runtime error at the operator
+    ASSERT_FALSE(serializedFunction.evaluate({maximum , 2}).has_value()) ;
+    ASSERT_EQ(serializedFunction.runtimeErrorMessage() , "4:8: Runtime Error: Integer Overflow\n"
+                                                          "c := a * b + -a;\n"
+                                                          "       ^\n") ;
+    ASSERT_FALSE(serializedFunction.evaluate({minimum , 1}).has_value()) ;
+    ASSERT_EQ(serializedFunction.runtimeErrorMessage() , "4:14: Runtime Error: Integer Overflow\n"
+                                                          "c := a * b + -a;\n"
+                                                          "             ^\n") ;
+    // results match checked evaluation of the tree
+    vector<int64_t> values = {minimum , minimum + 1 , -3 , -1 , 0 , 1 , 2 , maximum} ;
+    for(int64_t a : values)
+        for(int64_t b : values) {
+            vector<int64_t> param = {a , b} ;
+            EvaluationContext evaluationContext(param , functionAst.getSymbolTable()) ;
+            evaluationContext.setArithmeticMode(ArithmeticMode::CHECKED) ;
+            ASSERT_EQ(serializedFunction.evaluate(param) , functionAst.evaluate(evaluationContext)) << a << " " << b ;
+            ASSERT_EQ(serializedFunction.runtimeErrorMessage() , manager.runtimeErrorMessage()) ;
+        }
+    // the same function wraps around without the mode : c = -2 + -maximum = maximum
+    string wrappingBuffer = functionAst.serialize() ;
+    SerializedFunction wrappingFunction(wrappingBuffer) ;
+    ASSERT_EQ(wrappingFunction.evaluate({maximum , 2}) , maximum / 2 - 1) ;
+}
+TEST(TestSerialization , TestInvalidBuffer) {
+    constexpr string_view code = "PARAM a;\n"
+                                 "BEGIN\n"
+                                 "RETURN a / 2\n"
+                                 "END.\n" ;
+    CodeManager manager(code) ;
+    TokenStream tokenStream(&manager) ;
+    tokenStream.compileCode() ;
+    FunctionDeclaration functionDeclaration(&manager) ;
+    ASSERT_TRUE(functionDeclaration.compileCode(tokenStream)) ;
+    FunctionAST functionAst(&manager) ;
+    ASSERT_TRUE(functionAst.compileCode(functionDeclaration)) ;
+    string buffer = functionAst.serialize() ;
+
+    // empty buffer
+    ASSERT_FALSE(SerializedFunction("").isValid()) ;
+    // truncated buffer
+    for(size_t size = 0 ; size < buffer.size() ; size++)
+        ASSERT_FALSE(SerializedFunction(string_view(buffer).substr(0 , size)).isValid()) ;
+    // wrong magic
+    string wrongMagic = buffer ;
+    wrongMagic[0] = 'X' ;
+    ASSERT_FALSE(SerializedFunction(wrongMagic).isValid()) ;
+    // unknown version
+    string wrongVersion = buffer ;
+    wrongVersion[4] = static_cast<char>(SerializedFunction::FORMAT_VERSION + 1) ;
+    ASSERT_FALSE(SerializedFunction(wrongVersion).isValid()) ;
+    // unknown arithmetic mode
+    string wrongMode = buffer ;
+    wrongMode[6] = '\x07' ;
+    ASSERT_FALSE(SerializedFunction(wrongMode).isValid()) ;
+    // trailing bytes after return statement
+    ASSERT_FALSE(SerializedFunction(buffer + '\x09').isValid()) ;
+}
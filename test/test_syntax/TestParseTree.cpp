@@ -1783,4 +1783,31 @@ TEST(TestParseTree , TestFunctionDeclaration) {
             ASSERT_EQ(expected , manager.error_message()) ;
         }
     }
+    { // parsing stops at an invalid declaration , only its error is printed
+        constexpr array<string_view, 3> functions =
+            {
+                "PARAM a\nBEGIN\nRETURN a\nEND." ,
+                "VAR a ,\nBEGIN\nRETURN 1\nEND." ,
+                "CONST b = c ;\nBEGIN\nRETURN b\nEND."
+            };
+        constexpr array<string_view , 3 > expectedMessages = {
+            "2:1: error: expected ;\n"
+            "BEGIN\n"
+            "^~~~~\n" ,
+            "2:1: error: expected Identifier Token\n"
+            "BEGIN\n"
+            "^~~~~\n" ,
+            "1:11: error: expected Literal Token\n"
+            "CONST b = c ;\n"
+            "          ^\n"
+        };
+        for(size_t index = 0 ; index < 3 ; ++index) {
+            CodeManager manager(functions[index]) ;
+            TokenStream tokenStream(&manager) ;
+            tokenStream.compileCode() ;
+            FunctionDeclaration parseTreeNode(&manager) ;
+            ASSERT_TRUE(!parseTreeNode.compileCode(tokenStream)) ;
+            ASSERT_EQ(expectedMessages[index] , manager.error_message()) ;
+        }
+    }
 }
@@ -134,6 +134,18 @@ TEST(TestTokenStream , TestErrorMessages){
         ASSERT_TRUE(codeManager.isCodeError()) ;
         ASSERT_EQ(errorMessage , codeManager.error_message()) ;
     }
+    // characters between "Z" and "a" are not letters
+    {
+        string source_code5 = "a_b" ;
+        string errorMessage = "1:2: error: unexpected token \"_\"\n"
+                              "a_b\n"
+                              " ^\n" ;
+        CodeManager codeManager(source_code5) ;
+        TokenStream lexicalAnalyzer(&codeManager) ;
+        ASSERT_TRUE(!lexicalAnalyzer.compileCode()) ;
+        ASSERT_TRUE(codeManager.isCodeError()) ;
+        ASSERT_EQ(errorMessage , codeManager.error_message()) ;
+    }
     // concatenate literal with identifier
     {
         string source_code4 = ":=,.;123a" ;
@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include "pljit/tools/LoadDriver.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::tools;
+
+TEST(TestLoadDriver , TestRun) {
+    LoadOptions options ;
+    options.functions = 8 ;
+    options.threads = 3 ;
+    options.callsPerThread = 200 ;
+    options.profileCalls = 10 ;
+    options.shape.divisionDensity = 0.3 ;
+    LoadReport report = LoadDriver::run(options) ;
+    ASSERT_EQ(report.calls , 600) ;
+    ASSERT_LE(report.errors , report.calls) ;
+    ASSERT_GT(report.seconds , 0) ;
+    ASSERT_GT(report.throughput() , 0) ;
+    ASSERT_LE(report.latency.p50 , report.latency.p90) ;
+    ASSERT_LE(report.latency.p99 , report.latency.max) ;
+    // every called function is compiled once , hot functions are tiered up as well
+    ASSERT_GE(report.compilations , 1) ;
+    ASSERT_LE(report.compilations , 2 * options.functions) ;
+    ASSERT_GT(report.compileNanoseconds[management::CompileStatistics::LEXING] , 0) ;
+    ASSERT_NE(report.format().find("calls          600 (") , string::npos) << report.format() ;
+
+    // runs with the same options call the same functions with the same arguments
+    ASSERT_EQ(LoadDriver::run(options).errors , report.errors) ;
+}
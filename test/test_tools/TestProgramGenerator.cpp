@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include "pljit/Pljit.hpp"
+#include "pljit/tools/ProgramGenerator.hpp"
+
+using namespace std ;
+using namespace jitcompiler ;
+using namespace jitcompiler ::tools;
+
+TEST(TestProgramGenerator , TestValidPrograms) {
+    vector<ProgramShape> shapes(4) ;
+    shapes[1] = {0 , 0 , 0 , 0 , 0 , {1 , 1 , 1} , 0} ;
+    shapes[2] = {1 , 30 , 30 , 10 , 6 , {0 , 0 , 1} , 0.5} ;
+    shapes[3] = {0 , 3 , 1 , 8 , 2 , {1 , 0 , 0} , 0.1} ;
+    for(const ProgramShape& shape : shapes) {
+        ProgramGenerator generator(shape , 7) ;
+        vector<string> programs ;
+        for(size_t index = 0 ; index < 50 ; ++index)
+            programs.push_back(generator.generate()) ;
+        Pljit pljit ;
+        for(const string& program : programs) {
+            auto func = pljit.registerFunction(program) ;
+            vector<int64_t> arguments(shape.parameters , 3) ;
+            auto result = func(arguments) ;
+            // only runtime errors are possible
+            if(!result.first.has_value()) {
+                ASSERT_NE(result.second.find("Runtime Error") , string::npos) << program << result.second ;
+            }
+        }
+    }
+}
+TEST(TestProgramGenerator , TestShape) {
+    ProgramShape shape ;
+    shape.parameters = 2 ;
+    shape.variables = 3 ;
+    shape.constants = 1 ;
+    shape.statements = 1 ;
+    shape.divisionDensity = 0 ;
+    string program = ProgramGenerator(shape , 1).generate() ;
+    ASSERT_EQ(program.substr(0 , 32) , "PARAM pa , pb;\nVAR va , vb , vc;") << program ;
+    ASSERT_EQ(program.find('/') , string::npos) << program ;
+    // each variable is initialized before it is used
+    ASSERT_LT(program.find("va :=") , program.find("vb :=")) << program ;
+    ASSERT_LT(program.find("vb :=") , program.find("vc :=")) << program ;
+    // same seed generates same programs
+    ASSERT_EQ(ProgramGenerator(shape , 1).generate() , program) ;
+    ASSERT_NE(ProgramGenerator(shape , 2).generate() , program) ;
+
+    shape.divisionDensity = 1 ;
+    program = ProgramGenerator(shape , 1).generate() ;
+    string body = program.substr(program.find("BEGIN")) ;
+    ASSERT_NE(body.find(" / ") , string::npos) << program ;
+    ASSERT_EQ(body.find(" + ") , string::npos) << program ;
+    ASSERT_EQ(body.find(" * ") , string::npos) << program ;
+}